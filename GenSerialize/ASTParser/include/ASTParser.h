@@ -22,15 +22,19 @@ namespace GenTools::GenSerialize
 		std::vector<std::shared_ptr<SASTNode>> SASTTree;
 		std::unordered_map<std::string, std::shared_ptr<SASTNode>> SASTMap;
 		std::string filePath;
+		// Non system files read while parsing filePath (its includes), the output for filePath depends on them
+		std::vector<std::string> dependencies;
 	};
 
 	class ASTParser : public clang::ASTConsumer, public clang::RecursiveASTVisitor<ASTParser>
 	{
 	private:
 		SASTResult& m_result;
+		clang::ASTContext* m_context = nullptr;
 
 		void ProcessFields(clang::CXXRecordDecl* recordDecl, std::shared_ptr<SASTNode> sastNode);
 		std::shared_ptr<SASTField> ProcessFieldType(const clang::QualType& fieldType);
+		void ProcessArithmeticType(const clang::QualType& fieldType, SASTField& sastField);
 		
 	public:
 		explicit ASTParser(SASTResult& result);
@@ -38,6 +42,13 @@ namespace GenTools::GenSerialize
 		void HandleTranslationUnit(clang::ASTContext& context) override;
 
 		bool VisitCXXRecordDecl(clang::CXXRecordDecl* recordDecl);
+
+		/// <summary>
+		/// Collect the non system files read into a source manager, those loaded from a precompiled header are not included
+		/// </summary>
+		/// <param name="sourceManager">Source manager of a finished translation unit</param>
+		/// <returns>The file names, sorted and unique</returns>
+		static std::vector<std::string> CollectDependencies(const clang::SourceManager& sourceManager);
 	};
 }
 
@@ -1,9 +1,12 @@
 #include <ASTParser.h>
 
 #include <FileValidator.h>
+#include <RunStatistics.h>
 #include <PlatformInterface.h>
 
 #include <unordered_set>
+#include <set>
+#include <charconv>
 
 namespace GenTools::GenSerialize
 {
@@ -13,12 +16,22 @@ namespace GenTools::GenSerialize
 
 	void ASTParser::HandleTranslationUnit(clang::ASTContext& context)
 	{
+		m_context = &context;
+
+		RunStatistics::Scope traversal("AST traversal", m_result.filePath);
 		TraverseDecl(context.getTranslationUnitDecl());
+		m_result.dependencies = CollectDependencies(context.getSourceManager());
+		traversal.End();
 
 		if (!m_result.SASTTree.empty())
 		{
-			FileValidator validator;
-			validator.ValidateFile(m_result.filePath);
+			// Validate the buffer Clang parsed rather than reading the file again
+			const clang::SourceManager& sourceManager = context.getSourceManager();
+			if (auto contents = sourceManager.getBufferDataOrNone(sourceManager.getMainFileID()))
+			{
+				FileValidator validator;
+				validator.ValidateFile(m_result.filePath, std::string_view(contents->data(), contents->size()));
+			}
 		}
 	}
 
@@ -91,6 +104,7 @@ namespace GenTools::GenSerialize
 		// Create a new SAST node for this type
 		std::shared_ptr<SASTNode> sastNode = std::make_shared<SASTNode>();
 		sastNode->name = recordDecl->getQualifiedNameAsString();
+		sastNode->sourceFile = SM.getFilename(SM.getSpellingLoc(recordDecl->getLocation())).str();
 		sastNode->serializationPolicy = serializationPolicy;
 		sastNode->formats = formats;
 
@@ -138,6 +152,7 @@ namespace GenTools::GenSerialize
 	{
 		std::unordered_set<std::string> fieldNames;
 		std::vector<std::pair<std::string, std::string>> dynamicLengthReferences; // {arrayFieldName, LengthVar}
+		std::unordered_map<uint32_t, std::string> fieldIds; // {fieldId, fieldName}
 
 		for (const auto& field : recordDecl->fields())
 		{
@@ -149,7 +164,10 @@ namespace GenTools::GenSerialize
 			bool isStaticArray = false;
 			std::optional<std::string> dynamicLengthVar;
 
-			// Check field annotations: SERIALIZE_FIELD, SERIALIZE_FIELD_AS, SERIALIZE_EXCLUDE
+			std::optional<uint32_t> fieldId;
+			std::string defaultValue;
+
+			// Check field annotations: SERIALIZE_FIELD, SERIALIZE_FIELD_AS, SERIALIZE_EXCLUDE, SERIALIZE_ID, SERIALIZE_DEFAULT
 			for (auto attribute : field->specific_attrs<clang::AnnotateAttr>())
 			{
 				std::string annotation = attribute->getAnnotation().str();
@@ -178,6 +196,20 @@ namespace GenTools::GenSerialize
 				{
 					dynamicLengthVar = annotation.substr(14);
 				}
+				else if (annotation.find("field_id:") == 0)
+				{
+					std::string param = annotation.substr(9);
+					uint32_t id = 0;
+					auto [end, ec] = std::from_chars(param.data(), param.data() + param.size(), id);
+					if (ec != std::errc() || end != param.data() + param.size())
+						throw std::runtime_error("Field '" + field->getName().str() + "' has an invalid SERIALIZE_ID '" + param + "', expected an unsigned integer");
+
+					fieldId = id;
+				}
+				else if (annotation.find("field_default:") == 0)
+				{
+					defaultValue = annotation.substr(14);
+				}
 			}
 
 			// If not explicitly annotated but the node uses the "All" policy, include it
@@ -197,6 +229,16 @@ namespace GenTools::GenSerialize
 			SASTField sastField;
 			sastField.name = field->getName().str();
 			sastField.formattedName = customName.empty() ? sastField.name : customName;
+			sastField.defaultValue = defaultValue;
+
+			if (fieldId.has_value())
+			{
+				auto [existing, inserted] = fieldIds.emplace(fieldId.value(), sastField.name);
+				if (!inserted)
+					throw std::runtime_error("Field '" + sastField.name + "' reuses SERIALIZE_ID " + std::to_string(fieldId.value()) + " of field '" + existing->second + "'");
+
+				sastField.fieldId = fieldId;
+			}
 
 			switch (field->getAccess())
 			{
@@ -363,6 +405,7 @@ namespace GenTools::GenSerialize
 						else if (auto recordDecl = fieldType->getAsCXXRecordDecl())
 						{
 							std::string recordName = recordDecl->getQualifiedNameAsString();
+							sastField.objectTypeName = recordName;
 							if (m_result.SASTMap.find(recordName) != m_result.SASTMap.end())
 							{
 								sastField.objectNode = m_result.SASTMap[recordName];
@@ -385,6 +428,7 @@ namespace GenTools::GenSerialize
 				if (auto recordDecl = fieldType->getAsCXXRecordDecl())
 				{
 					std::string recordName = recordDecl->getQualifiedNameAsString();
+					sastField.objectTypeName = recordName;
 					if (m_result.SASTMap.find(recordName) != m_result.SASTMap.end())
 					{
 						sastField.objectNode = m_result.SASTMap[recordName];
@@ -405,11 +449,13 @@ namespace GenTools::GenSerialize
 			{
 				sastField.type = SASTType::Int;
 				sastField.originalTypeName = fieldType.getAsString();
+				ProcessArithmeticType(fieldType, sastField);
 			}
 			else if (fieldType->isFloatingType())
 			{
 				sastField.type = SASTType::Float;
 				sastField.originalTypeName = fieldType.getAsString();
+				ProcessArithmeticType(fieldType, sastField);
 			}
 			else
 			{
@@ -548,6 +594,7 @@ namespace GenTools::GenSerialize
 					else if (auto recordDecl = fieldType->getAsCXXRecordDecl())
 					{
 						std::string recordName = recordDecl->getQualifiedNameAsString();
+						sastField->objectTypeName = recordName;
 						if (m_result.SASTMap.find(recordName) != m_result.SASTMap.end())
 						{
 							sastField->objectNode = m_result.SASTMap[recordName];
@@ -574,6 +621,7 @@ namespace GenTools::GenSerialize
 			else if (auto recordDecl = fieldType->getAsCXXRecordDecl())
 			{
 				std::string recordName = recordDecl->getQualifiedNameAsString();
+				sastField->objectTypeName = recordName;
 				if (m_result.SASTMap.find(recordName) != m_result.SASTMap.end())
 				{
 					sastField->objectNode = m_result.SASTMap[recordName];
@@ -585,20 +633,23 @@ namespace GenTools::GenSerialize
 				}
 			}
 		}
+		else if (fieldType->isBooleanType())
+		{
+			// Checked before isIntegerType, which is also true for bool
+			sastField->type = SASTType::Bool;
+			sastField->originalTypeName = fieldType.getAsString();
+		}
 		else if (fieldType->isIntegerType())
 		{
 			sastField->type = SASTType::Int;
 			sastField->originalTypeName = fieldType.getAsString();
+			ProcessArithmeticType(fieldType, *sastField);
 		}
 		else if (fieldType->isFloatingType())
 		{
 			sastField->type = SASTType::Float;
 			sastField->originalTypeName = fieldType.getAsString();
-		}
-		else if (fieldType->isBooleanType())
-		{
-			sastField->type = SASTType::Bool;
-			sastField->originalTypeName = fieldType.getAsString();
+			ProcessArithmeticType(fieldType, *sastField);
 		}
 		else
 		{
@@ -609,4 +660,36 @@ namespace GenTools::GenSerialize
 
 		return sastField;
 	}
+
+	void ASTParser::ProcessArithmeticType(const clang::QualType& fieldType, SASTField& sastField)
+	{
+		if (!m_context)
+			return;
+
+		// Record the exact width and signedness so format plugins can keep 64 bit integers exact and narrow with range checks
+		clang::QualType canonicalType = fieldType.getCanonicalType();
+		sastField.arithmeticBits = static_cast<uint16_t>(m_context->getTypeSize(canonicalType));
+		sastField.arithmeticSigned = canonicalType->isSignedIntegerOrEnumerationType();
+	}
+
+	std::vector<std::string> ASTParser::CollectDependencies(const clang::SourceManager& sourceManager)
+	{
+		std::set<std::string> dependencies;
+		for (unsigned i = 0; i < sourceManager.local_sloc_entry_size(); i++)
+		{
+			const clang::SrcMgr::SLocEntry& entry = sourceManager.getLocalSLocEntry(i);
+			if (!entry.isFile())
+				continue;
+
+			// System headers only change with the toolchain, which is not tracked per file
+			const clang::SrcMgr::FileInfo& fileInfo = entry.getFile();
+			if (clang::SrcMgr::isSystem(fileInfo.getFileCharacteristic()))
+				continue;
+
+			if (auto fileEntry = fileInfo.getContentCache().OrigEntry)
+				dependencies.insert(fileEntry->getName().str());
+		}
+
+		return std::vector<std::string>(dependencies.begin(), dependencies.end());
+	}
 }
\ No newline at end of file
@@ -0,0 +1,21 @@
+#ifndef GENTOOLS_GENSERIALIZE_ATOMIC_FILE_H
+#define GENTOOLS_GENSERIALIZE_ATOMIC_FILE_H
+
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Replace a file with new contents so readers see either the old file or the whole new one. The contents are written to a
+	/// temporary file next to it, named after the process and the call so concurrent writers in any process never share one, and
+	/// renamed over the file. Missing parent directories are created
+	/// </summary>
+	/// <param name="path">The file to replace</param>
+	/// <param name="contents">The new contents</param>
+	/// <returns>Empty on success, otherwise why the file was not replaced</returns>
+	std::error_code WriteFileAtomically(const std::filesystem::path& path, std::string_view contents);
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_ATOMIC_FILE_H
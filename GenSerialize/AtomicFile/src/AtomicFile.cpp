@@ -0,0 +1,78 @@
+#include <AtomicFile.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace GenTools::GenSerialize
+{
+	namespace
+	{
+		// The error behind a failed stream operation, falling back to a generic one when the stream did not set errno
+		std::error_code StreamError()
+		{
+			return errno != 0 ? std::error_code(errno, std::generic_category()) : std::make_error_code(std::errc::io_error);
+		}
+
+		std::filesystem::path GetTempPath(const std::filesystem::path& path)
+		{
+			static std::atomic<uint64_t> nextWrite{ 0 };
+
+#if defined(_WIN32)
+			const auto processId = _getpid();
+#else
+			const auto processId = getpid();
+#endif
+
+			std::filesystem::path tempPath = path;
+			tempPath += ".tmp" + std::to_string(processId) + "." + std::to_string(nextWrite.fetch_add(1, std::memory_order_relaxed));
+			return tempPath;
+		}
+	}
+
+	std::error_code WriteFileAtomically(const std::filesystem::path& path, std::string_view contents)
+	{
+		std::error_code ec;
+		if (path.has_parent_path())
+		{
+			std::filesystem::create_directories(path.parent_path(), ec);
+			if (ec)
+				return ec;
+		}
+
+		std::filesystem::path tempPath = GetTempPath(path);
+		{
+			errno = 0;
+			std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+			if (!file.is_open())
+				return StreamError();
+
+			file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+			file.close();
+			if (file.fail())
+			{
+				std::error_code writeError = StreamError();
+				std::filesystem::remove(tempPath, ec);
+				return writeError;
+			}
+		}
+
+		std::filesystem::rename(tempPath, path, ec);
+		if (ec)
+		{
+			std::error_code renameError = ec;
+			std::filesystem::remove(tempPath, ec);
+			return renameError;
+		}
+
+		return {};
+	}
+}
@@ -0,0 +1,77 @@
+#ifndef GENTOOLS_GENSERIALIZE_CACHING_FILE_SYSTEM_H
+#define GENTOOLS_GENSERIALIZE_CACHING_FILE_SYSTEM_H
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <llvm/ADT/IntrusiveRefCntPtr.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/ErrorOr.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/VirtualFileSystem.h>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// File system shared by every parse thread that remembers the status of each path, including paths that were not found,
+	/// and the contents of each file read. A header searched for or included by several sources is stat'd and read once per
+	/// run, whichever thread gets there first, while each thread keeps its own file manager on top. Files are assumed not to
+	/// change while it is in use. The working directory is fixed when the cache is created and never forwarded to the shared
+	/// file system under it, threads keep theirs in a WorkingDirectoryFileSystem on top
+	/// </summary>
+	class CachingFileSystem : public llvm::vfs::ProxyFileSystem
+	{
+	private:
+		// Paths are spread over shards so threads looking up different files rarely wait on each other
+		static constexpr size_t SHARD_COUNT = 16;
+
+		struct Shard
+		{
+			std::mutex mutex;
+			std::unordered_map<std::string, llvm::ErrorOr<llvm::vfs::Status>> statuses;
+			std::unordered_map<std::string, std::shared_ptr<const llvm::MemoryBuffer>> contents;
+		};
+
+		std::array<Shard, SHARD_COUNT> m_shards;
+
+		// Working directory of the file system under the cache when it was created, relative paths resolve against it
+		std::string m_root;
+
+		// Absolute form of a path, the key of its entries and the path queried under the cache
+		std::string GetKey(const llvm::Twine& path) const;
+		Shard& GetShard(const std::string& key);
+
+	public:
+		explicit CachingFileSystem(llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fileSystem);
+
+		llvm::ErrorOr<llvm::vfs::Status> status(const llvm::Twine& path) override;
+#if LLVM_VERSION_MAJOR >= 17
+		bool exists(const llvm::Twine& path) override;
+#endif
+		llvm::ErrorOr<std::unique_ptr<llvm::vfs::File>> openFileForRead(const llvm::Twine& path) override;
+		llvm::vfs::directory_iterator dir_begin(const llvm::Twine& directory, std::error_code& errorCode) override;
+		std::error_code getRealPath(const llvm::Twine& path, llvm::SmallVectorImpl<char>& output) const override;
+		std::error_code isLocal(const llvm::Twine& path, bool& result) override;
+
+		/// <summary>
+		/// The fixed root relative paths resolve against
+		/// </summary>
+		llvm::ErrorOr<std::string> getCurrentWorkingDirectory() const override;
+
+		/// <summary>
+		/// Refused, moving the shared file system would move every thread using it
+		/// </summary>
+		std::error_code setCurrentWorkingDirectory(const llvm::Twine& path) override;
+
+		/// <summary>
+		/// Forget what is known of a path, for a file written while the cache is in use
+		/// </summary>
+		/// <param name="path">Path of the file</param>
+		void Invalidate(const llvm::Twine& path);
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_CACHING_FILE_SYSTEM_H
@@ -0,0 +1,171 @@
+#include <CachingFileSystem.h>
+
+#include <functional>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/Path.h>
+
+namespace GenTools::GenSerialize
+{
+	namespace
+	{
+		// A file read through the cache, handing out views of the cached contents
+		class CachedFile : public llvm::vfs::File
+		{
+		private:
+			llvm::vfs::Status m_status;
+			std::shared_ptr<const llvm::MemoryBuffer> m_contents;
+
+		public:
+			CachedFile(llvm::vfs::Status status, std::shared_ptr<const llvm::MemoryBuffer> contents)
+				: m_status(std::move(status)), m_contents(std::move(contents))
+			{}
+
+			llvm::ErrorOr<llvm::vfs::Status> status() override
+			{
+				return m_status;
+			}
+
+			// The cache outlives every parse using the file system, the view never dangles
+			llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> getBuffer(const llvm::Twine& name, [[maybe_unused]] int64_t fileSize,
+				bool requiresNullTerminator, [[maybe_unused]] bool isVolatile) override
+			{
+				return llvm::MemoryBuffer::getMemBuffer(m_contents->getBuffer(), name.str(), requiresNullTerminator);
+			}
+
+			std::error_code close() override
+			{
+				return {};
+			}
+		};
+	}
+
+	CachingFileSystem::CachingFileSystem(llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fileSystem)
+		: llvm::vfs::ProxyFileSystem(std::move(fileSystem))
+	{
+		if (auto workingDirectory = getUnderlyingFS().getCurrentWorkingDirectory())
+			m_root = std::move(*workingDirectory);
+	}
+
+	std::string CachingFileSystem::GetKey(const llvm::Twine& path) const
+	{
+		// Resolved against the fixed root, never the working directory of the shared file system
+		llvm::SmallString<256> absolutePath;
+		path.toVector(absolutePath);
+		if (!llvm::sys::path::is_absolute(absolutePath))
+		{
+			llvm::SmallString<256> relativePath = std::move(absolutePath);
+			absolutePath = m_root;
+			llvm::sys::path::append(absolutePath, relativePath);
+		}
+		return std::string(absolutePath.str());
+	}
+
+	CachingFileSystem::Shard& CachingFileSystem::GetShard(const std::string& key)
+	{
+		return m_shards[std::hash<std::string>{}(key) % SHARD_COUNT];
+	}
+
+	llvm::ErrorOr<llvm::vfs::Status> CachingFileSystem::status(const llvm::Twine& path)
+	{
+		std::string key = GetKey(path);
+		Shard& shard = GetShard(key);
+		{
+			std::lock_guard<std::mutex> lock(shard.mutex);
+			if (auto cached = shard.statuses.find(key); cached != shard.statuses.end())
+			{
+				if (!cached->second)
+					return cached->second.getError();
+
+				// Callers expect the status to carry the path they asked for
+				return llvm::vfs::Status::copyWithNewName(*cached->second, path);
+			}
+		}
+
+		// Threads racing on the same path may both query it, the first answer is kept
+		auto result = llvm::vfs::ProxyFileSystem::status(key);
+
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		const auto& cached = shard.statuses.try_emplace(std::move(key), std::move(result)).first->second;
+		if (!cached)
+			return cached.getError();
+		return llvm::vfs::Status::copyWithNewName(*cached, path);
+	}
+
+#if LLVM_VERSION_MAJOR >= 17
+	bool CachingFileSystem::exists(const llvm::Twine& path)
+	{
+		return static_cast<bool>(status(path));
+	}
+#endif
+
+	llvm::ErrorOr<std::unique_ptr<llvm::vfs::File>> CachingFileSystem::openFileForRead(const llvm::Twine& path)
+	{
+		std::string key = GetKey(path);
+		Shard& shard = GetShard(key);
+		{
+			std::lock_guard<std::mutex> lock(shard.mutex);
+			auto contents = shard.contents.find(key);
+			auto status = shard.statuses.find(key);
+			if (contents != shard.contents.end() && status != shard.statuses.end() && status->second)
+				return std::make_unique<CachedFile>(llvm::vfs::Status::copyWithNewName(*status->second, path), contents->second);
+		}
+
+		auto file = llvm::vfs::ProxyFileSystem::openFileForRead(key);
+		if (!file)
+			return file.getError();
+
+		auto fileStatus = (*file)->status();
+		if (!fileStatus)
+			return fileStatus.getError();
+
+		auto buffer = (*file)->getBuffer(key);
+		if (!buffer)
+			return buffer.getError();
+		std::shared_ptr<const llvm::MemoryBuffer> fileContents = std::move(*buffer);
+
+		// The status seen when the file was opened describes the contents kept, unless another thread kept its read first
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		auto [contents, inserted] = shard.contents.try_emplace(key, std::move(fileContents));
+		if (inserted)
+			shard.statuses.insert_or_assign(key, *fileStatus);
+
+		const auto& status = shard.statuses.at(key);
+		return std::make_unique<CachedFile>(llvm::vfs::Status::copyWithNewName(*status, path), contents->second);
+	}
+
+	llvm::vfs::directory_iterator CachingFileSystem::dir_begin(const llvm::Twine& directory, std::error_code& errorCode)
+	{
+		return llvm::vfs::ProxyFileSystem::dir_begin(GetKey(directory), errorCode);
+	}
+
+	std::error_code CachingFileSystem::getRealPath(const llvm::Twine& path, llvm::SmallVectorImpl<char>& output) const
+	{
+		return llvm::vfs::ProxyFileSystem::getRealPath(GetKey(path), output);
+	}
+
+	std::error_code CachingFileSystem::isLocal(const llvm::Twine& path, bool& result)
+	{
+		return llvm::vfs::ProxyFileSystem::isLocal(GetKey(path), result);
+	}
+
+	llvm::ErrorOr<std::string> CachingFileSystem::getCurrentWorkingDirectory() const
+	{
+		return m_root;
+	}
+
+	std::error_code CachingFileSystem::setCurrentWorkingDirectory([[maybe_unused]] const llvm::Twine& path)
+	{
+		return std::make_error_code(std::errc::operation_not_permitted);
+	}
+
+	void CachingFileSystem::Invalidate(const llvm::Twine& path)
+	{
+		std::string key = GetKey(path);
+		Shard& shard = GetShard(key);
+
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		shard.statuses.erase(key);
+		shard.contents.erase(key);
+	}
+}
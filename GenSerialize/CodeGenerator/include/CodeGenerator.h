@@ -7,6 +7,7 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace GenTools::GenSerialize
 {
@@ -14,11 +15,24 @@ namespace GenTools::GenSerialize
 	{
 	private:
 		const std::vector<std::shared_ptr<SASTNode>>& m_SASTNodes;
+		size_t m_maxThreads;
 
 	public:
-		CodeGenerator(const std::vector<std::shared_ptr<SASTNode>>& SASTNodes);
+		/// <summary>
+		/// Create a generator for the types of one source
+		/// </summary>
+		/// <param name="SASTNodes">The SAST tree of the source</param>
+		/// <param name="maxThreads">Threads that may generate the (type, format) pairs of the source concurrently, including the calling thread</param>
+		CodeGenerator(const std::vector<std::shared_ptr<SASTNode>>& SASTNodes, size_t maxThreads = 1);
 
 		GeneratedCode GenerateCode();
+
+		/// <summary>
+		/// End every line of generated code with a macro continuation, in one pass
+		/// </summary>
+		/// <param name="code">Code produced by a plugin</param>
+		/// <returns>The code with " \" appended to every line</returns>
+		static std::string EscapeMacroLines(std::string_view code);
 	};
 }
 
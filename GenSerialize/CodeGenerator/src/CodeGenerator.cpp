@@ -1,50 +1,127 @@
 #include <CodeGenerator.h>
+#include <FlatSAST.h>
+#include <RunStatistics.h>
 
-#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <optional>
+#include <thread>
 
 #include <PlatformInterface.h>
 
 namespace GenTools::GenSerialize
 {
-	CodeGenerator::CodeGenerator(const std::vector<std::shared_ptr<SASTNode>>& SASTNodes)
-		: m_SASTNodes(SASTNodes)
+	namespace
+	{
+		// Fewer tasks than this per thread are not worth starting a thread for
+		constexpr size_t MIN_TASKS_PER_THREAD = 8;
+
+		struct GenerationTask
+		{
+			size_t nodeIndex;
+			const std::string* format;
+			IFormatPlugin* plugin;
+		};
+	}
+
+	CodeGenerator::CodeGenerator(const std::vector<std::shared_ptr<SASTNode>>& SASTNodes, size_t maxThreads)
+		: m_SASTNodes(SASTNodes), m_maxThreads(std::max<size_t>(maxThreads, 1))
 	{}
 
+	std::string CodeGenerator::EscapeMacroLines(std::string_view code)
+	{
+		// Room for the continuation of every line
+		CodeSink sink(true, code.size() + code.size() / 8 + 3);
+		sink.Write(code);
+		return sink.Take();
+	}
+
 	GeneratedCode CodeGenerator::GenerateCode()
 	{
 		GeneratedCode generated;
 
-		// For each SAST node (each marked type)
-		for (const auto& node : m_SASTNodes)
+		// One task for each format of each SAST node (each marked type)
+		std::vector<GenerationTask> tasks;
+		bool needsFlatSAST = false;
+		auto& registry = FileFormatRegistry::GetInstance();
+		for (size_t nodeIndex = 0; nodeIndex < m_SASTNodes.size(); nodeIndex++)
 		{
-			std::string typeName = node->name;
+			for (const auto& format : m_SASTNodes[nodeIndex]->formats)
+			{
+				IFormatPlugin* plugin = registry.GetPlugin(format);
+				if (!plugin)
+				{
+					TERMINAL::PRINT_ERROR_S("Error: No plugin found for format: " + format);
+					continue;
+				}
+
+				needsFlatSAST |= plugin->ConsumesFlatSAST();
+				tasks.push_back({ nodeIndex, &format, plugin });
+			}
+		}
+
+		// Flattened up front when any plugin consumes it, the tasks only read it
+		std::optional<FlatSAST> flatSAST;
+		if (needsFlatSAST)
+			flatSAST = FlatSAST::Build(m_SASTNodes);
+
+		// Plugins must not modify the SAST and may be called concurrently for different types and formats. Each task writes
+		// only its own result slot
+		std::vector<std::string> results(tasks.size());
+		std::atomic<size_t> nextTask{ 0 };
+		std::exception_ptr failure;
+		std::atomic<bool> failed{ false };
+
+		// Each plugin is timed as its own phase
+		bool timed = RunStatistics::GetInstance().IsEnabled();
 
-			// For each format specified for the type
-			for (const auto& format : node->formats)
+		auto runTasks = [&]() {
+			for (size_t i = nextTask.fetch_add(1, std::memory_order_relaxed); i < tasks.size() && !failed.load(std::memory_order_relaxed);
+				i = nextTask.fetch_add(1, std::memory_order_relaxed))
 			{
-				auto plugin = FileFormatRegistry::GetInstance().GetPlugin(format);
-				if (plugin)
+				const GenerationTask& task = tasks[i];
+				RunStatistics::Scope generation(timed ? "Generate " + *task.format : std::string(), m_SASTNodes[task.nodeIndex]->name);
+				try
 				{
-					std::string code = plugin->GenerateCode(node);
-
-					std::ostringstream escapedStream;
-					std::istringstream rawStream(code);
-					std::string line;
-					while (std::getline(rawStream, line))
-					{
-						escapedStream << line << " \\\n"; // Escape newlines for macro continuation
-					}
-
-					generated.code[typeName][format] = escapedStream.str();
-					
+					// Plugins write straight into the result, macro continuations are added as the code comes in
+					CodeSink sink(true);
+					if (task.plugin->ConsumesFlatSAST())
+						task.plugin->EmitFlatCode(flatSAST->GetRoots()[task.nodeIndex], sink);
+					else
+						task.plugin->EmitCode(m_SASTNodes[task.nodeIndex], sink);
+
+					results[i] = sink.Take();
 				}
-				else
+				catch (...)
 				{
-					TERMINAL::PRINT_ERROR("Error: No plugin found for format: " + format);
+					// Keep the first failure, it is rethrown on the calling thread
+					if (!failed.exchange(true))
+						failure = std::current_exception();
 				}
 			}
+		};
+
+		size_t threadCount = std::min(m_maxThreads, tasks.size() / MIN_TASKS_PER_THREAD);
+		std::vector<std::thread> helpers;
+		for (size_t i = 1; i < threadCount; i++)
+		{
+			helpers.emplace_back(runTasks);
+		}
+		runTasks();
+		for (auto& helper : helpers)
+		{
+			helper.join();
+		}
+
+		if (failure)
+			std::rethrow_exception(failure);
+
+		for (size_t i = 0; i < tasks.size(); i++)
+		{
+			generated.code[m_SASTNodes[tasks[i].nodeIndex]->name][*tasks[i].format] = std::move(results[i]);
 		}
 
 		return generated;
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,74 @@
+#ifndef GENTOOLS_GENSERIALIZE_COMPILATION_GROUPS_H
+#define GENTOOLS_GENSERIALIZE_COMPILATION_GROUPS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <clang/Tooling/CompilationDatabase.h>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Compile flags shared by one or more sources
+	/// </summary>
+	struct CompilationGroup
+	{
+		// Working directory the flags are relative to
+		std::string directory;
+		// Compiler arguments, without the compiler, the source and any output
+		std::vector<std::string> arguments;
+		// Hash of the directory and arguments
+		uint64_t flagsHash = 0;
+		// Database answering every source of the group with the flags above
+		std::unique_ptr<clang::tooling::FixedCompilationDatabase> compilations;
+	};
+
+	/// <summary>
+	/// Sources grouped by identical compile flags. Sources in a group can share a precompiled prelude and a file manager, a PCH is
+	/// only accepted by compilations configured like the one that built it
+	/// </summary>
+	class CompilationGroups
+	{
+	private:
+		std::vector<CompilationGroup> m_groups;
+		std::unordered_map<uint64_t, std::vector<size_t>> m_groupsByHash;
+		std::unordered_map<std::string, size_t> m_sourceGroups;
+
+	public:
+		CompilationGroups() = default;
+
+		/// <summary>
+		/// Turn a command from a compilation database into flags for the parse. The compiler is dropped in favor of its driver
+		/// mode, and the source, outputs, dependency file outputs and -c are removed
+		/// </summary>
+		/// <param name="command">The compile command of a source</param>
+		/// <returns>The arguments</returns>
+		static std::vector<std::string> ArgumentsFromCommand(const clang::tooling::CompileCommand& command);
+
+		/// <summary>
+		/// Place a source in the group with the same flags, creating the group if there is none
+		/// </summary>
+		/// <param name="sourcePath">The source as it will be passed to the ClangTool</param>
+		/// <param name="directory">Working directory of the compilation</param>
+		/// <param name="arguments">Compiler arguments of the source</param>
+		/// <returns>Index of the group</returns>
+		size_t Assign(const std::string& sourcePath, std::string directory, std::vector<std::string> arguments);
+
+		/// <param name="sourcePath">A source passed to Assign</param>
+		/// <returns>Index of the group of the source</returns>
+		size_t GetSourceGroup(const std::string& sourcePath) const;
+
+		/// <param name="index">Index returned by Assign</param>
+		/// <returns>The group</returns>
+		const CompilationGroup& GetGroup(size_t index) const;
+
+		/// <returns>Number of distinct flag sets</returns>
+		size_t Size() const noexcept;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_COMPILATION_GROUPS_H
@@ -0,0 +1,90 @@
+#include <CompilationGroups.h>
+
+#include <GenerationCache.h>
+
+#include <clang/Tooling/ArgumentsAdjusters.h>
+#include <llvm/Support/Path.h>
+
+#include <filesystem>
+#include <utility>
+
+namespace GenTools::GenSerialize
+{
+	std::vector<std::string> CompilationGroups::ArgumentsFromCommand(const clang::tooling::CompileCommand& command)
+	{
+		if (command.CommandLine.empty())
+			return {};
+
+		clang::tooling::CommandLineArguments commandLine = clang::tooling::getClangStripOutputAdjuster()(command.CommandLine, command.Filename);
+		commandLine = clang::tooling::getClangStripDependencyFileAdjuster()(commandLine, command.Filename);
+
+		// The tool replaces the compiler, keep the way the compiler reads its arguments. Headers are C++ in g++ mode
+		std::vector<std::string> arguments;
+		llvm::StringRef compiler = llvm::sys::path::stem(commandLine.front());
+		arguments.push_back(compiler.equals_insensitive("cl") || compiler.ends_with_insensitive("clang-cl") ? "--driver-mode=cl" : "--driver-mode=g++");
+
+		// The source may be named relative to the directory of the command
+		std::filesystem::path sourcePath = (std::filesystem::path(command.Directory) / command.Filename).lexically_normal();
+		for (size_t i = 1; i < commandLine.size(); i++)
+		{
+			const std::string& argument = commandLine[i];
+			if (argument == "-c" || argument == "--")
+				continue;
+
+			if (!argument.starts_with("-") && (std::filesystem::path(command.Directory) / argument).lexically_normal() == sourcePath)
+				continue;
+
+			arguments.push_back(argument);
+		}
+
+		return arguments;
+	}
+
+	size_t CompilationGroups::Assign(const std::string& sourcePath, std::string directory, std::vector<std::string> arguments)
+	{
+		uint64_t flagsHash = GenerationCache::HashBytes(std::string_view(directory.c_str(), directory.size() + 1));
+		for (const auto& argument : arguments)
+		{
+			flagsHash = GenerationCache::HashBytes(std::string_view(argument.c_str(), argument.size() + 1), flagsHash);
+		}
+
+		size_t groupIndex = m_groups.size();
+		auto& candidates = m_groupsByHash[flagsHash];
+		for (size_t candidate : candidates)
+		{
+			if (m_groups[candidate].directory == directory && m_groups[candidate].arguments == arguments)
+			{
+				groupIndex = candidate;
+				break;
+			}
+		}
+
+		if (groupIndex == m_groups.size())
+		{
+			CompilationGroup& group = m_groups.emplace_back();
+			group.compilations = std::make_unique<clang::tooling::FixedCompilationDatabase>(directory, arguments);
+			group.directory = std::move(directory);
+			group.arguments = std::move(arguments);
+			group.flagsHash = flagsHash;
+			candidates.push_back(groupIndex);
+		}
+
+		m_sourceGroups[sourcePath] = groupIndex;
+		return groupIndex;
+	}
+
+	size_t CompilationGroups::GetSourceGroup(const std::string& sourcePath) const
+	{
+		return m_sourceGroups.at(sourcePath);
+	}
+
+	const CompilationGroup& CompilationGroups::GetGroup(size_t index) const
+	{
+		return m_groups.at(index);
+	}
+
+	size_t CompilationGroups::Size() const noexcept
+	{
+		return m_groups.size();
+	}
+}
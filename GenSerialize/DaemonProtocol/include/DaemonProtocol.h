@@ -0,0 +1,96 @@
+#ifndef GENTOOLS_GENSERIALIZE_DAEMON_PROTOCOL_H
+#define GENTOOLS_GENSERIALIZE_DAEMON_PROTOCOL_H
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// A generation request received by the daemon: the command line of a GenSerialize run, where it was started, and the
+	/// output streams of the client, which the daemon writes to directly
+	/// </summary>
+	class DaemonRequest
+	{
+	private:
+		int m_connection = -1;
+
+		friend class DaemonServer;
+
+	public:
+		std::string workingDirectory;
+		std::vector<std::string> arguments;
+		// Descriptors of the client's standard output and error, owned by the request
+		int outputFd = -1;
+		int errorFd = -1;
+
+		DaemonRequest() = default;
+		~DaemonRequest();
+
+		DaemonRequest(DaemonRequest&& other) noexcept;
+		DaemonRequest& operator=(DaemonRequest&& other) noexcept;
+
+		DaemonRequest(const DaemonRequest&) = delete;
+		DaemonRequest& operator=(const DaemonRequest&) = delete;
+
+		/// <summary>
+		/// Send the exit code of the run to the client, which then exits with it
+		/// </summary>
+		/// <param name="exitCode">Exit code of the run</param>
+		/// <returns>True if the client received it</returns>
+		bool Reply(int exitCode);
+	};
+
+	/// <summary>
+	/// Listening end of the daemon, a Unix domain socket. Only supported on POSIX systems
+	/// </summary>
+	class DaemonServer
+	{
+	private:
+		std::string m_socketPath;
+		int m_socket = -1;
+
+	public:
+		explicit DaemonServer(std::string socketPath);
+		~DaemonServer();
+
+		DaemonServer(const DaemonServer&) = delete;
+		DaemonServer& operator=(const DaemonServer&) = delete;
+
+		/// <summary>
+		/// Bind the socket and start listening. A socket file left behind by a daemon that is no longer running is replaced
+		/// </summary>
+		/// <returns>False if the socket could not be bound, or another daemon already listens on it</returns>
+		bool Listen();
+
+		/// <summary>
+		/// Wait for the next client. Malformed requests are dropped
+		/// </summary>
+		/// <returns>The request, or nothing once the socket is closed</returns>
+		std::optional<DaemonRequest> Accept();
+	};
+
+	/// <summary>
+	/// Requesting end of the daemon, used by GenSerializeClient
+	/// </summary>
+	class DaemonClient
+	{
+	public:
+		DaemonClient() = delete;
+
+		/// <summary>
+		/// Send a run to the daemon and wait for it to finish. Its output is written to the given descriptors by the daemon
+		/// </summary>
+		/// <param name="socketPath">Socket the daemon listens on</param>
+		/// <param name="workingDirectory">Directory relative paths of the arguments are resolved against</param>
+		/// <param name="arguments">Command line of the run, without the program name</param>
+		/// <param name="outputFd">Standard output of the run</param>
+		/// <param name="errorFd">Standard error of the run</param>
+		/// <returns>Exit code of the run, or nothing if no daemon could be reached</returns>
+		static std::optional<int> Run(const std::string& socketPath, const std::string& workingDirectory, const std::vector<std::string>& arguments,
+			int outputFd, int errorFd);
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_DAEMON_PROTOCOL_H
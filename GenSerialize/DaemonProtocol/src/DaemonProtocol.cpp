@@ -0,0 +1,426 @@
+#include <DaemonProtocol.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace GenTools::GenSerialize
+{
+#if !defined(_WIN32)
+	namespace
+	{
+		constexpr std::string_view REQUEST_MAGIC = "GSRQ";
+		constexpr uint32_t PROTOCOL_VERSION = 1;
+
+		// Magic, version and payload size, sent along with the two output descriptors
+		constexpr size_t HEADER_SIZE = 12;
+
+		// Far above any real command line, keeps a bad client from making the daemon allocate without bound
+		constexpr uint32_t MAX_PAYLOAD_SIZE = 64u << 20;
+
+		// A client has this long to deliver its request, so a stuck one cannot block the daemon
+		constexpr time_t REQUEST_TIMEOUT_SECONDS = 10;
+
+#if defined(MSG_NOSIGNAL)
+		constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+		constexpr int SEND_FLAGS = 0;
+#endif
+
+		void PutU32(std::string& out, uint32_t value)
+		{
+			for (int shift = 0; shift < 32; shift += 8)
+			{
+				out.push_back(static_cast<char>((value >> shift) & 0xFF));
+			}
+		}
+
+		bool GetU32(std::string_view& in, uint32_t& value)
+		{
+			if (in.size() < 4)
+				return false;
+
+			value = 0;
+			for (int i = 0; i < 4; i++)
+			{
+				value |= static_cast<uint32_t>(static_cast<uint8_t>(in[i])) << (i * 8);
+			}
+			in.remove_prefix(4);
+			return true;
+		}
+
+		void PutString(std::string& out, const std::string& value)
+		{
+			PutU32(out, static_cast<uint32_t>(value.size()));
+			out.append(value);
+		}
+
+		bool GetString(std::string_view& in, std::string& value)
+		{
+			uint32_t length = 0;
+			if (!GetU32(in, length) || length > in.size())
+				return false;
+
+			value.assign(in.substr(0, length));
+			in.remove_prefix(length);
+			return true;
+		}
+
+		bool SendAll(int socket, const char* data, size_t size)
+		{
+			while (size > 0)
+			{
+				ssize_t sent = send(socket, data, size, SEND_FLAGS);
+				if (sent < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					return false;
+				}
+				data += sent;
+				size -= static_cast<size_t>(sent);
+			}
+			return true;
+		}
+
+		bool ReceiveAll(int socket, char* data, size_t size)
+		{
+			while (size > 0)
+			{
+				ssize_t received = recv(socket, data, size, 0);
+				if (received < 0 && errno == EINTR)
+					continue;
+				if (received <= 0)
+					return false;
+				data += received;
+				size -= static_cast<size_t>(received);
+			}
+			return true;
+		}
+
+		bool MakeAddress(const std::string& socketPath, sockaddr_un& address)
+		{
+			std::memset(&address, 0, sizeof(address));
+			address.sun_family = AF_UNIX;
+			if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path))
+				return false;
+
+			std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+			return true;
+		}
+
+		int OpenSocket()
+		{
+			int socketFd = socket(AF_UNIX, SOCK_STREAM, 0);
+#if defined(SO_NOSIGPIPE)
+			if (socketFd >= 0)
+			{
+				int enable = 1;
+				setsockopt(socketFd, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+			}
+#endif
+			return socketFd;
+		}
+
+		int Connect(const std::string& socketPath)
+		{
+			sockaddr_un address;
+			if (!MakeAddress(socketPath, address))
+				return -1;
+
+			int socketFd = OpenSocket();
+			if (socketFd < 0)
+				return -1;
+
+			if (connect(socketFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+			{
+				close(socketFd);
+				return -1;
+			}
+			return socketFd;
+		}
+
+		void CloseFd(int& fd)
+		{
+			if (fd >= 0)
+				close(fd);
+			fd = -1;
+		}
+	}
+
+	DaemonRequest::~DaemonRequest()
+	{
+		CloseFd(outputFd);
+		CloseFd(errorFd);
+		CloseFd(m_connection);
+	}
+
+	DaemonRequest::DaemonRequest(DaemonRequest&& other) noexcept
+		: m_connection(std::exchange(other.m_connection, -1)), workingDirectory(std::move(other.workingDirectory)),
+		arguments(std::move(other.arguments)), outputFd(std::exchange(other.outputFd, -1)), errorFd(std::exchange(other.errorFd, -1))
+	{}
+
+	DaemonRequest& DaemonRequest::operator=(DaemonRequest&& other) noexcept
+	{
+		if (this != &other)
+		{
+			CloseFd(outputFd);
+			CloseFd(errorFd);
+			CloseFd(m_connection);
+
+			m_connection = std::exchange(other.m_connection, -1);
+			workingDirectory = std::move(other.workingDirectory);
+			arguments = std::move(other.arguments);
+			outputFd = std::exchange(other.outputFd, -1);
+			errorFd = std::exchange(other.errorFd, -1);
+		}
+		return *this;
+	}
+
+	bool DaemonRequest::Reply(int exitCode)
+	{
+		std::string reply;
+		PutU32(reply, static_cast<uint32_t>(exitCode));
+		bool sent = m_connection >= 0 && SendAll(m_connection, reply.data(), reply.size());
+		CloseFd(m_connection);
+		return sent;
+	}
+
+	DaemonServer::DaemonServer(std::string socketPath)
+		: m_socketPath(std::move(socketPath))
+	{}
+
+	DaemonServer::~DaemonServer()
+	{
+		if (m_socket >= 0)
+		{
+			CloseFd(m_socket);
+			unlink(m_socketPath.c_str());
+		}
+	}
+
+	bool DaemonServer::Listen()
+	{
+		sockaddr_un address;
+		if (!MakeAddress(m_socketPath, address))
+			return false;
+
+		// A socket file nobody answers on is left over from a daemon that did not shut down cleanly
+		int existing = Connect(m_socketPath);
+		if (existing >= 0)
+		{
+			close(existing);
+			return false;
+		}
+		unlink(m_socketPath.c_str());
+
+		m_socket = OpenSocket();
+		if (m_socket < 0)
+			return false;
+
+		if (bind(m_socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+			chmod(m_socketPath.c_str(), S_IRUSR | S_IWUSR) != 0 || listen(m_socket, SOMAXCONN) != 0)
+		{
+			CloseFd(m_socket);
+			return false;
+		}
+
+		// Clients may go away while their run still writes to their output
+		std::signal(SIGPIPE, SIG_IGN);
+		return true;
+	}
+
+	std::optional<DaemonRequest> DaemonServer::Accept()
+	{
+		while (m_socket >= 0)
+		{
+			int connection = accept(m_socket, nullptr, nullptr);
+			if (connection < 0)
+			{
+				if (errno == EINTR || errno == ECONNABORTED)
+					continue;
+				return std::nullopt;
+			}
+
+			DaemonRequest request;
+			request.m_connection = connection;
+
+			timeval timeout{};
+			timeout.tv_sec = REQUEST_TIMEOUT_SECONDS;
+			setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+			// The header carries the client's output descriptors
+			char header[HEADER_SIZE];
+			iovec headerVector{ header, HEADER_SIZE };
+			alignas(cmsghdr) char control[CMSG_SPACE(2 * sizeof(int))];
+			msghdr message{};
+			message.msg_iov = &headerVector;
+			message.msg_iovlen = 1;
+			message.msg_control = control;
+			message.msg_controllen = sizeof(control);
+
+			ssize_t received;
+			do
+			{
+				received = recvmsg(connection, &message, 0);
+			} while (received < 0 && errno == EINTR);
+
+			if (received <= 0)
+				continue;
+
+			for (cmsghdr* controlMessage = CMSG_FIRSTHDR(&message); controlMessage; controlMessage = CMSG_NXTHDR(&message, controlMessage))
+			{
+				if (controlMessage->cmsg_level == SOL_SOCKET && controlMessage->cmsg_type == SCM_RIGHTS &&
+					controlMessage->cmsg_len == CMSG_LEN(2 * sizeof(int)))
+				{
+					int fds[2];
+					std::memcpy(fds, CMSG_DATA(controlMessage), sizeof(fds));
+					request.outputFd = fds[0];
+					request.errorFd = fds[1];
+				}
+			}
+
+			if (request.outputFd < 0 || request.errorFd < 0 ||
+				!ReceiveAll(connection, header + received, HEADER_SIZE - static_cast<size_t>(received)))
+			{
+				continue;
+			}
+
+			std::string_view headerView(header, HEADER_SIZE);
+			uint32_t version = 0;
+			uint32_t payloadSize = 0;
+			if (!headerView.starts_with(REQUEST_MAGIC))
+				continue;
+			headerView.remove_prefix(REQUEST_MAGIC.size());
+			if (!GetU32(headerView, version) || version != PROTOCOL_VERSION || !GetU32(headerView, payloadSize) || payloadSize > MAX_PAYLOAD_SIZE)
+				continue;
+
+			std::string payload(payloadSize, '\0');
+			if (!ReceiveAll(connection, payload.data(), payload.size()))
+				continue;
+
+			std::string_view in(payload);
+			uint32_t argumentCount = 0;
+			if (!GetString(in, request.workingDirectory) || !GetU32(in, argumentCount) || argumentCount > in.size())
+				continue;
+
+			request.arguments.resize(argumentCount);
+			bool valid = true;
+			for (auto& argument : request.arguments)
+			{
+				valid = valid && GetString(in, argument);
+			}
+			if (!valid || !in.empty())
+				continue;
+
+			// Runs take as long as they take, only the request itself was timed
+			timeout.tv_sec = 0;
+			setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+			return request;
+		}
+
+		return std::nullopt;
+	}
+
+	std::optional<int> DaemonClient::Run(const std::string& socketPath, const std::string& workingDirectory, const std::vector<std::string>& arguments,
+		int outputFd, int errorFd)
+	{
+		int socketFd = Connect(socketPath);
+		if (socketFd < 0)
+			return std::nullopt;
+
+		std::string payload;
+		PutString(payload, workingDirectory);
+		PutU32(payload, static_cast<uint32_t>(arguments.size()));
+		for (const auto& argument : arguments)
+		{
+			PutString(payload, argument);
+		}
+
+		std::string header(REQUEST_MAGIC);
+		PutU32(header, PROTOCOL_VERSION);
+		PutU32(header, static_cast<uint32_t>(payload.size()));
+
+		iovec headerVector{ header.data(), header.size() };
+		alignas(cmsghdr) char control[CMSG_SPACE(2 * sizeof(int))];
+		std::memset(control, 0, sizeof(control));
+		msghdr message{};
+		message.msg_iov = &headerVector;
+		message.msg_iovlen = 1;
+		message.msg_control = control;
+		message.msg_controllen = sizeof(control);
+
+		cmsghdr* controlMessage = CMSG_FIRSTHDR(&message);
+		controlMessage->cmsg_level = SOL_SOCKET;
+		controlMessage->cmsg_type = SCM_RIGHTS;
+		controlMessage->cmsg_len = CMSG_LEN(2 * sizeof(int));
+		int fds[2] = { outputFd, errorFd };
+		std::memcpy(CMSG_DATA(controlMessage), fds, sizeof(fds));
+
+		ssize_t sent;
+		do
+		{
+			sent = sendmsg(socketFd, &message, SEND_FLAGS);
+		} while (sent < 0 && errno == EINTR);
+
+		std::string reply(4, '\0');
+		bool delivered = sent > 0 &&
+			SendAll(socketFd, header.data() + sent, header.size() - static_cast<size_t>(sent)) &&
+			SendAll(socketFd, payload.data(), payload.size()) &&
+			ReceiveAll(socketFd, reply.data(), reply.size());
+		close(socketFd);
+
+		std::string_view in(reply);
+		uint32_t exitCode = 0;
+		if (!delivered || !GetU32(in, exitCode))
+			return std::nullopt;
+
+		return static_cast<int>(exitCode);
+	}
+#else
+	DaemonRequest::~DaemonRequest() = default;
+
+	DaemonRequest::DaemonRequest(DaemonRequest&& other) noexcept = default;
+
+	DaemonRequest& DaemonRequest::operator=(DaemonRequest&& other) noexcept = default;
+
+	bool DaemonRequest::Reply([[maybe_unused]] int exitCode)
+	{
+		return false;
+	}
+
+	DaemonServer::DaemonServer(std::string socketPath)
+		: m_socketPath(std::move(socketPath))
+	{}
+
+	DaemonServer::~DaemonServer() = default;
+
+	bool DaemonServer::Listen()
+	{
+		return false;
+	}
+
+	std::optional<DaemonRequest> DaemonServer::Accept()
+	{
+		return std::nullopt;
+	}
+
+	std::optional<int> DaemonClient::Run([[maybe_unused]] const std::string& socketPath, [[maybe_unused]] const std::string& workingDirectory,
+		[[maybe_unused]] const std::vector<std::string>& arguments, [[maybe_unused]] int outputFd, [[maybe_unused]] int errorFd)
+	{
+		return std::nullopt;
+	}
+#endif
+}
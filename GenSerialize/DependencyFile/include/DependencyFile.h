@@ -0,0 +1,43 @@
+#ifndef GENTOOLS_GENSERIALIZE_DEPENDENCY_FILE_H
+#define GENTOOLS_GENSERIALIZE_DEPENDENCY_FILE_H
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Makefile style dependency file (depfile), naming the files each output was produced from, so Make and Ninja can tell when
+	/// an output is out of date. One rule per output
+	/// </summary>
+	class DependencyFile
+	{
+	private:
+		std::string m_contents;
+
+		// Escape the characters Make would otherwise read as separators, comments, or variables
+		static void AppendPath(std::string& out, std::string_view path);
+
+	public:
+		/// <summary>
+		/// Add the rule of one output
+		/// </summary>
+		/// <param name="target">The output</param>
+		/// <param name="inputs">The files it was produced from</param>
+		void AddRule(std::string_view target, const std::vector<std::string>& inputs);
+
+		/// <returns>The depfile contents</returns>
+		const std::string& GetContents() const noexcept;
+
+		/// <summary>
+		/// Write the depfile through a temporary file, so a build tool never reads a partial one
+		/// </summary>
+		/// <param name="path">Where to write the depfile</param>
+		/// <returns>True on success</returns>
+		bool Write(const std::filesystem::path& path) const;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_DEPENDENCY_FILE_H
@@ -0,0 +1,66 @@
+#include <DependencyFile.h>
+#include <AtomicFile.h>
+
+#include <PlatformInterface.h>
+
+#include <system_error>
+
+namespace GenTools::GenSerialize
+{
+	void DependencyFile::AppendPath(std::string& out, std::string_view path)
+	{
+		for (size_t i = 0; i < path.size(); i++)
+		{
+			char c = path[i];
+			switch (c)
+			{
+			case ' ':
+			case '\t':
+				// Backslashes ahead of a space are doubled, or they would escape each other instead of the space
+				for (size_t slash = i; slash > 0 && path[slash - 1] == '\\'; slash--)
+				{
+					out.push_back('\\');
+				}
+				out.push_back('\\');
+				break;
+			case '#':
+				out.push_back('\\');
+				break;
+			case '$':
+				out.push_back('$');
+				break;
+			default:
+				break;
+			}
+			out.push_back(c);
+		}
+	}
+
+	void DependencyFile::AddRule(std::string_view target, const std::vector<std::string>& inputs)
+	{
+		AppendPath(m_contents, target);
+		m_contents += ":";
+		for (const auto& input : inputs)
+		{
+			m_contents += " \\\n  ";
+			AppendPath(m_contents, input);
+		}
+		m_contents += "\n";
+	}
+
+	const std::string& DependencyFile::GetContents() const noexcept
+	{
+		return m_contents;
+	}
+
+	bool DependencyFile::Write(const std::filesystem::path& path) const
+	{
+		if (std::error_code ec = WriteFileAtomically(path, m_contents))
+		{
+			TERMINAL::PRINT_WARNING("Warning: Could not write dependency file " + path.string() + ": " + ec.message());
+			return false;
+		}
+
+		return true;
+	}
+}
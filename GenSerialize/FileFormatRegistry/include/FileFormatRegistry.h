@@ -2,37 +2,130 @@
 #define GENTOOLS_GENSERIALIZE_FILE_FORMAT_REGISTRY_H
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 #include <memory>
+#include <functional>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
 #include <IFormatPlugin.h>
 
 namespace GenTools::GenSerialize
 {
 	/// <summary>
-	/// Singleton that contains a registry of file format plugins for serialization logic generation
+	/// Interned format name, stable for the lifetime of the registry
+	/// </summary>
+	using FormatId = uint32_t;
+
+	constexpr FormatId INVALID_FORMAT_ID = UINT32_MAX;
+
+	/// <summary>
+	/// Singleton that contains a registry of file format plugins for serialization logic generation. Once frozen, lookups read an
+	/// immutable table without taking a lock. Every later change publishes a new table
 	/// </summary>
 	class FileFormatRegistry
 	{
+	public:
+		using PluginResolver = std::function<void(const std::string& formatName)>;
+
 	private:
 		/// <summary>
-		/// Simple structure that pairs a plugin instance to a priority for plugin overriding in the registry
+		/// Registration state of one interned format, guarded by m_mutex
+		/// </summary>
+		struct FormatEntry
+		{
+			std::string name;
+			IFormatPlugin* plugin = nullptr;
+			uint8_t priority = 0;
+			// The resolver was asked for the format (or there was none to ask)
+			bool resolved = false;
+		};
+
+		struct FormatNameHash
+		{
+			using is_transparent = void;
+
+			size_t operator()(std::string_view name) const noexcept
+			{
+				return std::hash<std::string_view>{}(name);
+			}
+		};
+
+		/// <summary>
+		/// Read only copy of the registration state that lookups go through. A published table is never modified
 		/// </summary>
-		struct PluginInfo
+		struct FormatTable
 		{
-			std::shared_ptr<IFormatPlugin> plugin;
-			uint8_t priority;
+			std::unordered_map<std::string, FormatId, FormatNameHash, std::equal_to<>> formatIds;
+			std::vector<IFormatPlugin*> plugins;
+			std::vector<uint8_t> resolved;
 		};
 
-		std::unordered_map<std::string, PluginInfo> m_formatPlugins;
+		std::unordered_map<std::string, FormatId, FormatNameHash, std::equal_to<>> m_formatIds;
+		std::vector<FormatEntry> m_formats;
+
+		// Every plugin ever registered, so a plugin handed out stays valid after a higher priority one replaces it
+		std::vector<std::shared_ptr<IFormatPlugin>> m_plugins;
+
+		PluginResolver m_resolver;
+		bool m_frozen = false;
+
+		std::atomic<const FormatTable*> m_table{ nullptr };
+		// Replaced tables are kept, readers may still be using them
+		std::vector<std::unique_ptr<const FormatTable>> m_tables;
+
+		// Guards everything but m_table
+		std::mutex m_mutex;
 
 		FileFormatRegistry() = default;
 
+		FormatId InternFormat(std::string_view formatName);
+		void PublishTable();
+
 	public:
 		static FileFormatRegistry& GetInstance();
 
+		FileFormatRegistry(const FileFormatRegistry&) = delete;
+		FileFormatRegistry& operator=(const FileFormatRegistry&) = delete;
+
 		void RegisterPlugin(std::shared_ptr<IFormatPlugin> plugin, uint8_t priority = 0);
 
-		std::shared_ptr<IFormatPlugin> GetPlugin(const std::string& formatName) const;
+		/// <summary>
+		/// Publish the first lookup table, called once the plugins are loaded. Lookups before this work but take a lock
+		/// </summary>
+		void Freeze();
+
+		/// <summary>
+		/// Get the id of a format. The first lookup of each format calls the resolver, even if a plugin is already registered,
+		/// so lazily created plugins can still override static ones. Later lookups are lock free once the registry is frozen
+		/// </summary>
+		/// <param name="formatName">The format name</param>
+		/// <returns>The interned id of the format</returns>
+		FormatId GetFormatId(std::string_view formatName);
+
+		/// <summary>
+		/// Get the plugin of a format id returned by GetFormatId, without taking a lock once the registry is frozen. The plugin
+		/// stays valid for the lifetime of the registry
+		/// </summary>
+		/// <param name="formatId">The interned format</param>
+		/// <returns>The plugin, or nullptr if no plugin handles the format</returns>
+		IFormatPlugin* GetPlugin(FormatId formatId) noexcept;
+
+		/// <summary>
+		/// Get the plugin of a format by name, see GetFormatId
+		/// </summary>
+		/// <param name="formatName">The requested format</param>
+		/// <returns>The plugin, or nullptr if no plugin handles the format</returns>
+		IFormatPlugin* GetPlugin(std::string_view formatName);
+
+		/// <summary>
+		/// Set the callback that registers plugins for a format on demand (for instance DynamicPluginLoader::CreatePluginsForFormat).
+		/// It is called without any lock held and may be called concurrently. Pass nullptr to stop resolving
+		/// </summary>
+		/// <param name="resolver">The callback, given the name of the requested format</param>
+		void SetPluginResolver(PluginResolver resolver);
 	};
 
 	class PluginRegistrar
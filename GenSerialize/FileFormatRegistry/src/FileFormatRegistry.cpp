@@ -10,21 +10,114 @@ namespace GenTools::GenSerialize
 
 	void FileFormatRegistry::RegisterPlugin(std::shared_ptr<IFormatPlugin> plugin, uint8_t priority)
 	{
-		const auto& name = plugin->GetFormatName();
-		auto it = m_formatPlugins.find(name);
-		if (it == m_formatPlugins.end() || priority >= it->second.priority)
+		std::string name = plugin->GetFormatName();
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		FormatEntry& entry = m_formats[InternFormat(name)];
+		if (!entry.plugin || priority >= entry.priority)
 		{
-			m_formatPlugins[name] = { plugin, priority };
+			entry.plugin = plugin.get();
+			entry.priority = priority;
+			m_plugins.push_back(std::move(plugin));
+
+			if (m_frozen)
+				PublishTable();
 		}
 	}
 
-	std::shared_ptr<IFormatPlugin> FileFormatRegistry::GetPlugin(const std::string& formatName) const
+	void FileFormatRegistry::Freeze()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_frozen = true;
+		PublishTable();
+	}
+
+	FormatId FileFormatRegistry::GetFormatId(std::string_view formatName)
 	{
-		auto it = m_formatPlugins.find(formatName);
-		if (it != m_formatPlugins.end())
+		if (const FormatTable* table = m_table.load(std::memory_order_acquire))
 		{
-			return it->second.plugin;
+			auto it = table->formatIds.find(formatName);
+			if (it != table->formatIds.end() && table->resolved[it->second])
+				return it->second;
+		}
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		FormatId formatId = InternFormat(formatName);
+		if (!m_formats[formatId].resolved)
+		{
+			if (m_resolver)
+			{
+				// The resolver registers plugins, which takes the lock again
+				PluginResolver resolver = m_resolver;
+				std::string name = m_formats[formatId].name;
+				lock.unlock();
+				resolver(name);
+				lock.lock();
+			}
+
+			m_formats[formatId].resolved = true;
+			if (m_frozen)
+				PublishTable();
 		}
-		return nullptr;
+
+		return formatId;
+	}
+
+	IFormatPlugin* FileFormatRegistry::GetPlugin(FormatId formatId) noexcept
+	{
+		// Once frozen the table covers every id handed out, each new id is published before it is returned
+		if (const FormatTable* table = m_table.load(std::memory_order_acquire))
+			return formatId < table->plugins.size() ? table->plugins[formatId] : nullptr;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return formatId < m_formats.size() ? m_formats[formatId].plugin : nullptr;
+	}
+
+	IFormatPlugin* FileFormatRegistry::GetPlugin(std::string_view formatName)
+	{
+		return GetPlugin(GetFormatId(formatName));
+	}
+
+	void FileFormatRegistry::SetPluginResolver(PluginResolver resolver)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_resolver = std::move(resolver);
+		for (auto& format : m_formats)
+		{
+			format.resolved = false;
+		}
+
+		if (m_frozen)
+			PublishTable();
+	}
+
+	FormatId FileFormatRegistry::InternFormat(std::string_view formatName)
+	{
+		auto it = m_formatIds.find(formatName);
+		if (it != m_formatIds.end())
+			return it->second;
+
+		FormatId formatId = static_cast<FormatId>(m_formats.size());
+		FormatEntry entry;
+		entry.name = formatName;
+		m_formats.push_back(std::move(entry));
+		m_formatIds.emplace(std::string(formatName), formatId);
+		return formatId;
+	}
+
+	void FileFormatRegistry::PublishTable()
+	{
+		auto table = std::make_unique<FormatTable>();
+		table->formatIds = m_formatIds;
+		table->plugins.reserve(m_formats.size());
+		table->resolved.reserve(m_formats.size());
+		for (const auto& format : m_formats)
+		{
+			table->plugins.push_back(format.plugin);
+			table->resolved.push_back(format.resolved);
+		}
+
+		m_table.store(table.get(), std::memory_order_release);
+		m_tables.push_back(std::move(table));
 	}
-}
\ No newline at end of file
+}
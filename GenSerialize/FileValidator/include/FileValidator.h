@@ -3,6 +3,7 @@
 
 #include <filesystem>
 #include <string>
+#include <string_view>
 
 namespace GenTools::GenSerialize
 {
@@ -13,7 +14,13 @@ namespace GenTools::GenSerialize
 	public:
 		explicit FileValidator() = default;
 
-		bool ValidateFile(const std::filesystem::path& sourceFilePath);
+		/// <summary>
+		/// Check that a source with serializable types includes its generated header and uses GENERATED_SERIALIZATION_BODY()
+		/// </summary>
+		/// <param name="sourceFilePath">Path of the source, its stem names the generated header</param>
+		/// <param name="sourceContents">Text of the source, as already loaded by the parser</param>
+		/// <returns>True if both are present, otherwise an error is printed</returns>
+		bool ValidateFile(const std::filesystem::path& sourceFilePath, std::string_view sourceContents);
 	};
 }
 
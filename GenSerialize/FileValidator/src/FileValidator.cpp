@@ -1,36 +1,16 @@
 #include <FileValidator.h>
 
-#include <fstream>
-#include <sstream>
-#include <regex>
+#include <SourceScanner.h>
 #include <PlatformInterface.h>
 
 namespace GenTools::GenSerialize
 {
-	bool FileValidator::ValidateFile(const std::filesystem::path& sourceFilePath)
+	bool FileValidator::ValidateFile(const std::filesystem::path& sourceFilePath, std::string_view sourceContents)
 	{
-		std::ifstream file(sourceFilePath);
-
-		if (!file)
-		{
-			TERMINAL::PRINT_ERROR("Error: Could not open file " + sourceFilePath.string() + " for validation");
-			return false;
-		}
-
-		std::stringstream buffer;
-		buffer << file.rdbuf();
-		std::string fileContents = buffer.str();
-
 		std::string headerName = sourceFilePath.stem().string();
 
-		// Regex to match #include <dir/sub/FileName.generated.h> or #include "FileName.generated.h"
-		std::regex includeRegex("#include\\s*[<\"]([a-zA-Z0-9_/]*)" + headerName + "\\.generated\\.h[>\"]");
-
-		// Regex to match GENERATED_SERIALIZATION_BODY() with optional spaces
-		std::regex bodyRegex(R"(_SERIALIZATION_BODY\s*\(\s*\))");
-
-		bool foundGeneratedHeader = std::regex_search(fileContents, includeRegex);
-		bool foundGeneratedBody = std::regex_search(fileContents, bodyRegex);
+		bool foundGeneratedHeader = SourceScanner::IncludesGeneratedHeader(sourceContents, headerName);
+		bool foundGeneratedBody = SourceScanner::ContainsGeneratedBody(sourceContents);
 
 		if (!foundGeneratedHeader)
 		{
@@ -0,0 +1,54 @@
+#ifndef GENTOOLS_GENSERIALIZE_FILE_WATCHER_H
+#define GENTOOLS_GENSERIALIZE_FILE_WATCHER_H
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Waits for a set of files to change, through inotify. The directories of the files are watched rather than the files, so
+	/// editors that save by replacing the file are seen too. Only supported on Linux
+	/// </summary>
+	class FileWatcher
+	{
+	private:
+		int m_inotify = -1;
+		// Watched directories by their watch descriptor, and the descriptor of each directory
+		std::unordered_map<int, std::string> m_directories;
+		std::unordered_map<std::string, int> m_watches;
+		// Normalized paths of the watched files
+		std::unordered_set<std::string> m_files;
+
+		// Read the pending events, adding the watched files they touch to changes
+		bool ReadEvents(std::unordered_set<std::string>& changes);
+
+	public:
+		FileWatcher();
+		~FileWatcher();
+
+		FileWatcher(const FileWatcher&) = delete;
+		FileWatcher& operator=(const FileWatcher&) = delete;
+
+		/// <summary>
+		/// Replace the set of watched files. Changes made since the previous set was watched are still reported if they touch
+		/// a file of the new set
+		/// </summary>
+		/// <param name="paths">Normalized paths of the files to watch</param>
+		/// <returns>False if the watches could not be set up</returns>
+		bool Watch(const std::vector<std::string>& paths);
+
+		/// <summary>
+		/// Wait until watched files change, then until no more changes arrive for the quiet period, so the several writes of a
+		/// single save are reported together
+		/// </summary>
+		/// <param name="timeoutMilliseconds">How long to wait for a first change, -1 to wait forever</param>
+		/// <param name="quietMilliseconds">How long the files must stay unchanged before the changes are reported</param>
+		/// <returns>Paths of the changed files, empty on timeout or error</returns>
+		std::vector<std::string> WaitForChanges(int timeoutMilliseconds = -1, int quietMilliseconds = 50);
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_FILE_WATCHER_H
@@ -0,0 +1,151 @@
+#include <FileWatcher.h>
+
+#include <PlatformInterface.h>
+
+#include <filesystem>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace GenTools::GenSerialize
+{
+#if defined(__linux__)
+	namespace
+	{
+		// Writes, and files created, deleted, or renamed over the watched one by editors that save through a temporary file
+		constexpr uint32_t WATCH_EVENTS = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+	}
+
+	FileWatcher::FileWatcher()
+		: m_inotify(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+	{}
+
+	FileWatcher::~FileWatcher()
+	{
+		if (m_inotify >= 0)
+			close(m_inotify);
+	}
+
+	bool FileWatcher::Watch(const std::vector<std::string>& paths)
+	{
+		if (m_inotify < 0)
+			return false;
+
+		std::unordered_set<std::string> directories;
+		m_files.clear();
+		for (const auto& path : paths)
+		{
+			m_files.insert(path);
+			directories.insert(std::filesystem::path(path).parent_path().string());
+		}
+
+		// Directories no longer holding a watched file stop reporting
+		for (auto watch = m_watches.begin(); watch != m_watches.end();)
+		{
+			if (directories.contains(watch->first))
+			{
+				++watch;
+				continue;
+			}
+
+			inotify_rm_watch(m_inotify, watch->second);
+			m_directories.erase(watch->second);
+			watch = m_watches.erase(watch);
+		}
+
+		for (const auto& directory : directories)
+		{
+			if (m_watches.contains(directory))
+				continue;
+
+			int watch = inotify_add_watch(m_inotify, directory.c_str(), WATCH_EVENTS);
+			if (watch < 0)
+			{
+				TERMINAL::PRINT_WARNING("Warning: Cannot watch " + directory + ": " + std::strerror(errno));
+				continue;
+			}
+
+			m_watches[directory] = watch;
+			m_directories[watch] = directory;
+		}
+
+		return true;
+	}
+
+	bool FileWatcher::ReadEvents(std::unordered_set<std::string>& changes)
+	{
+		alignas(inotify_event) char buffer[16 * (sizeof(inotify_event) + NAME_MAX + 1)];
+		while (true)
+		{
+			ssize_t count = read(m_inotify, buffer, sizeof(buffer));
+			if (count < 0)
+				return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+
+			for (ssize_t offset = 0; offset < count;)
+			{
+				const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+				offset += sizeof(inotify_event) + event->len;
+
+				// Events were dropped, any file may have changed
+				if (event->mask & IN_Q_OVERFLOW)
+				{
+					changes.insert(m_files.begin(), m_files.end());
+					continue;
+				}
+
+				auto directory = m_directories.find(event->wd);
+				if (event->len == 0 || directory == m_directories.end())
+					continue;
+
+				std::string path = (std::filesystem::path(directory->second) / event->name).string();
+				if (m_files.contains(path))
+					changes.insert(std::move(path));
+			}
+		}
+	}
+
+	std::vector<std::string> FileWatcher::WaitForChanges(int timeoutMilliseconds, int quietMilliseconds)
+	{
+		std::unordered_set<std::string> changes;
+		if (m_inotify < 0)
+			return {};
+
+		while (true)
+		{
+			pollfd descriptor{ m_inotify, POLLIN, 0 };
+			int ready = poll(&descriptor, 1, changes.empty() ? timeoutMilliseconds : quietMilliseconds);
+			if (ready < 0 && errno == EINTR)
+				continue;
+			if (ready <= 0 || !ReadEvents(changes))
+				break;
+		}
+
+		return std::vector<std::string>(changes.begin(), changes.end());
+	}
+#else
+	FileWatcher::FileWatcher() = default;
+
+	FileWatcher::~FileWatcher() = default;
+
+	bool FileWatcher::Watch([[maybe_unused]] const std::vector<std::string>& paths)
+	{
+		return false;
+	}
+
+	bool FileWatcher::ReadEvents([[maybe_unused]] std::unordered_set<std::string>& changes)
+	{
+		return false;
+	}
+
+	std::vector<std::string> FileWatcher::WaitForChanges([[maybe_unused]] int timeoutMilliseconds, [[maybe_unused]] int quietMilliseconds)
+	{
+		return {};
+	}
+#endif
+}
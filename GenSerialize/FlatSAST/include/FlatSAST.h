@@ -0,0 +1,218 @@
+#ifndef GENTOOLS_GENSERIALIZE_FLAT_SAST_H
+#define GENTOOLS_GENSERIALIZE_FLAT_SAST_H
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <SAST.h>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Immutable, arena allocated form of a SAST. Nodes and fields live in contiguous arrays and refer to each other and to their
+	/// interned names through 32 bit indices, so traversing it from many threads involves no reference counting and no pointer
+	/// chasing between scattered allocations. Consumers read it through the NodeView and FieldView handles
+	/// </summary>
+	class FlatSAST
+	{
+	public:
+		using Index = uint32_t;
+
+		// Index of a missing link
+		static constexpr Index INVALID_INDEX = 0xFFFFFFFFu;
+
+		class NodeView;
+		class FieldView;
+
+		/// <summary>
+		/// Read only sequence of views, either a contiguous run of records or a list of indices
+		/// </summary>
+		/// <typeparam name="View">NodeView, FieldView or std::string_view</typeparam>
+		template<typename View>
+		class ViewRange
+		{
+		private:
+			const FlatSAST* m_sast = nullptr;
+			const Index* m_indices = nullptr;
+			Index m_first = 0;
+			Index m_count = 0;
+
+		public:
+			class Iterator
+			{
+			private:
+				const FlatSAST* m_sast = nullptr;
+				const Index* m_indices = nullptr;
+				Index m_position = 0;
+
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = View;
+				using difference_type = std::ptrdiff_t;
+				using pointer = void;
+				using reference = View;
+
+				Iterator() = default;
+				Iterator(const FlatSAST* sast, const Index* indices, Index position) noexcept;
+
+				View operator*() const noexcept;
+				Iterator& operator++() noexcept;
+				Iterator operator++(int) noexcept;
+				bool operator==(const Iterator& other) const noexcept = default;
+			};
+
+			ViewRange() = default;
+			ViewRange(const FlatSAST* sast, const Index* indices, Index first, Index count) noexcept;
+
+			Iterator begin() const noexcept;
+			Iterator end() const noexcept;
+			size_t size() const noexcept;
+			bool empty() const noexcept;
+			View operator[](size_t position) const noexcept;
+		};
+
+		/// <summary>
+		/// Handle to a serializable type of a FlatSAST, valid as long as the FlatSAST is neither destroyed nor moved
+		/// </summary>
+		class NodeView
+		{
+		private:
+			const FlatSAST* m_sast = nullptr;
+			Index m_index = INVALID_INDEX;
+
+		public:
+			NodeView() = default;
+			NodeView(const FlatSAST* sast, Index index) noexcept;
+
+			Index GetIndex() const noexcept;
+			std::string_view GetName() const noexcept;
+			std::string_view GetSourceFile() const noexcept;
+			SASTNode::SerializationPolicy GetSerializationPolicy() const noexcept;
+			ViewRange<std::string_view> GetFormats() const noexcept;
+			ViewRange<FieldView> GetFields() const noexcept;
+			ViewRange<NodeView> GetBaseNodes() const noexcept;
+
+			/// <returns>True if the type is marked for the given format</returns>
+			bool HasFormat(std::string_view format) const noexcept;
+
+			bool operator==(const NodeView& other) const noexcept = default;
+		};
+
+		/// <summary>
+		/// Handle to a field (or the element, key or value type of a container field) of a FlatSAST
+		/// </summary>
+		class FieldView
+		{
+		private:
+			const FlatSAST* m_sast = nullptr;
+			Index m_index = INVALID_INDEX;
+
+		public:
+			FieldView() = default;
+			FieldView(const FlatSAST* sast, Index index) noexcept;
+
+			Index GetIndex() const noexcept;
+			SASTField::Access GetAccess() const noexcept;
+			std::string_view GetName() const noexcept;
+			std::string_view GetFormattedName() const noexcept;
+			SASTType GetType() const noexcept;
+			std::string_view GetOriginalTypeName() const noexcept;
+			std::string_view GetObjectTypeName() const noexcept;
+			std::optional<NodeView> GetObjectNode() const noexcept;
+			std::optional<FieldView> GetElementType() const noexcept;
+			std::optional<FieldView> GetKeyType() const noexcept;
+			std::optional<FieldView> GetValueType() const noexcept;
+			std::string_view GetLengthVar() const noexcept;
+			uint16_t GetArithmeticBits() const noexcept;
+			bool IsArithmeticSigned() const noexcept;
+			std::optional<uint32_t> GetFieldId() const noexcept;
+			std::string_view GetDefaultValue() const noexcept;
+
+			bool operator==(const FieldView& other) const noexcept = default;
+		};
+
+	private:
+		struct NodeRecord
+		{
+			Index name;
+			Index sourceFile;
+			Index firstFormat;	// Into m_indices, string indices
+			Index formatCount;
+			Index firstField;	// Into m_fields, the fields of a node are contiguous
+			Index fieldCount;
+			Index firstBase;	// Into m_indices, node indices
+			Index baseCount;
+			SASTNode::SerializationPolicy serializationPolicy;
+		};
+
+		struct FieldRecord
+		{
+			Index name;
+			Index formattedName;
+			Index originalTypeName;
+			Index objectTypeName;
+			Index lengthVar;
+			Index defaultValue;
+			Index objectNode;
+			Index elementType;
+			Index keyType;
+			Index valueType;
+			uint32_t fieldId;
+			uint16_t arithmeticBits;
+			SASTType type;
+			SASTField::Access access;
+			bool arithmeticSigned;
+			bool hasFieldId;
+		};
+
+		struct StringRecord
+		{
+			uint32_t offset;
+			uint32_t length;
+		};
+
+		std::vector<NodeRecord> m_nodes;
+		std::vector<FieldRecord> m_fields;
+		std::vector<Index> m_indices;
+		std::vector<Index> m_roots;
+
+		// Every distinct string once, back to back
+		std::string m_stringData;
+		std::vector<StringRecord> m_strings;
+
+		class Builder;
+
+		template<typename View>
+		View MakeView(Index index) const noexcept;
+
+		std::string_view GetString(Index index) const noexcept;
+
+	public:
+		FlatSAST() = default;
+
+		/// <summary>
+		/// Flatten a SAST graph. Every node linked from the given nodes (object fields, container types, base classes) is included
+		/// </summary>
+		/// <param name="roots">The nodes to flatten, typically the SAST tree of a source</param>
+		/// <returns>The flat SAST</returns>
+		static FlatSAST Build(const std::vector<std::shared_ptr<SASTNode>>& roots);
+
+		/// <returns>The nodes passed to Build, in the same order</returns>
+		ViewRange<NodeView> GetRoots() const noexcept;
+
+		/// <returns>Every node, the roots and the nodes they link to</returns>
+		ViewRange<NodeView> GetNodes() const noexcept;
+
+		/// <returns>Number of distinct strings</returns>
+		size_t GetStringCount() const noexcept;
+	};
+}
+
+#include <FlatSAST.inl>
+
+#endif // !GENTOOLS_GENSERIALIZE_FLAT_SAST_H
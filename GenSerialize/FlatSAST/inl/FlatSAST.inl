@@ -0,0 +1,257 @@
+#ifndef GENTOOLS_GENSERIALIZE_FLAT_SAST_INL
+#define GENTOOLS_GENSERIALIZE_FLAT_SAST_INL
+
+#include <algorithm>
+#include <type_traits>
+
+namespace GenTools::GenSerialize
+{
+	template<typename View>
+	View FlatSAST::MakeView(Index index) const noexcept
+	{
+		if constexpr (std::is_same_v<View, std::string_view>)
+			return GetString(index);
+		else
+			return View(this, index);
+	}
+
+	inline std::string_view FlatSAST::GetString(Index index) const noexcept
+	{
+		const StringRecord& record = m_strings[index];
+		return std::string_view(m_stringData.data() + record.offset, record.length);
+	}
+
+	// ViewRange
+
+	template<typename View>
+	FlatSAST::ViewRange<View>::Iterator::Iterator(const FlatSAST* sast, const Index* indices, Index position) noexcept
+		: m_sast(sast), m_indices(indices), m_position(position)
+	{}
+
+	template<typename View>
+	View FlatSAST::ViewRange<View>::Iterator::operator*() const noexcept
+	{
+		return m_sast->MakeView<View>(m_indices ? m_indices[m_position] : m_position);
+	}
+
+	template<typename View>
+	typename FlatSAST::ViewRange<View>::Iterator& FlatSAST::ViewRange<View>::Iterator::operator++() noexcept
+	{
+		++m_position;
+		return *this;
+	}
+
+	template<typename View>
+	typename FlatSAST::ViewRange<View>::Iterator FlatSAST::ViewRange<View>::Iterator::operator++(int) noexcept
+	{
+		Iterator previous = *this;
+		++m_position;
+		return previous;
+	}
+
+	template<typename View>
+	FlatSAST::ViewRange<View>::ViewRange(const FlatSAST* sast, const Index* indices, Index first, Index count) noexcept
+		: m_sast(sast), m_indices(indices), m_first(first), m_count(count)
+	{}
+
+	template<typename View>
+	typename FlatSAST::ViewRange<View>::Iterator FlatSAST::ViewRange<View>::begin() const noexcept
+	{
+		return Iterator(m_sast, m_indices, m_first);
+	}
+
+	template<typename View>
+	typename FlatSAST::ViewRange<View>::Iterator FlatSAST::ViewRange<View>::end() const noexcept
+	{
+		return Iterator(m_sast, m_indices, m_first + m_count);
+	}
+
+	template<typename View>
+	size_t FlatSAST::ViewRange<View>::size() const noexcept
+	{
+		return m_count;
+	}
+
+	template<typename View>
+	bool FlatSAST::ViewRange<View>::empty() const noexcept
+	{
+		return m_count == 0;
+	}
+
+	template<typename View>
+	View FlatSAST::ViewRange<View>::operator[](size_t position) const noexcept
+	{
+		Index index = m_indices ? m_indices[m_first + position] : m_first + static_cast<Index>(position);
+		return m_sast->MakeView<View>(index);
+	}
+
+	// NodeView
+
+	inline FlatSAST::NodeView::NodeView(const FlatSAST* sast, Index index) noexcept
+		: m_sast(sast), m_index(index)
+	{}
+
+	inline FlatSAST::Index FlatSAST::NodeView::GetIndex() const noexcept
+	{
+		return m_index;
+	}
+
+	inline std::string_view FlatSAST::NodeView::GetName() const noexcept
+	{
+		return m_sast->GetString(m_sast->m_nodes[m_index].name);
+	}
+
+	inline std::string_view FlatSAST::NodeView::GetSourceFile() const noexcept
+	{
+		return m_sast->GetString(m_sast->m_nodes[m_index].sourceFile);
+	}
+
+	inline SASTNode::SerializationPolicy FlatSAST::NodeView::GetSerializationPolicy() const noexcept
+	{
+		return m_sast->m_nodes[m_index].serializationPolicy;
+	}
+
+	inline FlatSAST::ViewRange<std::string_view> FlatSAST::NodeView::GetFormats() const noexcept
+	{
+		const NodeRecord& record = m_sast->m_nodes[m_index];
+		return ViewRange<std::string_view>(m_sast, m_sast->m_indices.data(), record.firstFormat, record.formatCount);
+	}
+
+	inline FlatSAST::ViewRange<FlatSAST::FieldView> FlatSAST::NodeView::GetFields() const noexcept
+	{
+		const NodeRecord& record = m_sast->m_nodes[m_index];
+		return ViewRange<FieldView>(m_sast, nullptr, record.firstField, record.fieldCount);
+	}
+
+	inline FlatSAST::ViewRange<FlatSAST::NodeView> FlatSAST::NodeView::GetBaseNodes() const noexcept
+	{
+		const NodeRecord& record = m_sast->m_nodes[m_index];
+		return ViewRange<NodeView>(m_sast, m_sast->m_indices.data(), record.firstBase, record.baseCount);
+	}
+
+	inline bool FlatSAST::NodeView::HasFormat(std::string_view format) const noexcept
+	{
+		auto formats = GetFormats();
+		return std::find(formats.begin(), formats.end(), format) != formats.end();
+	}
+
+	// FieldView
+
+	inline FlatSAST::FieldView::FieldView(const FlatSAST* sast, Index index) noexcept
+		: m_sast(sast), m_index(index)
+	{}
+
+	inline FlatSAST::Index FlatSAST::FieldView::GetIndex() const noexcept
+	{
+		return m_index;
+	}
+
+	inline SASTField::Access FlatSAST::FieldView::GetAccess() const noexcept
+	{
+		return m_sast->m_fields[m_index].access;
+	}
+
+	inline std::string_view FlatSAST::FieldView::GetName() const noexcept
+	{
+		return m_sast->GetString(m_sast->m_fields[m_index].name);
+	}
+
+	inline std::string_view FlatSAST::FieldView::GetFormattedName() const noexcept
+	{
+		return m_sast->GetString(m_sast->m_fields[m_index].formattedName);
+	}
+
+	inline SASTType FlatSAST::FieldView::GetType() const noexcept
+	{
+		return m_sast->m_fields[m_index].type;
+	}
+
+	inline std::string_view FlatSAST::FieldView::GetOriginalTypeName() const noexcept
+	{
+		return m_sast->GetString(m_sast->m_fields[m_index].originalTypeName);
+	}
+
+	inline std::string_view FlatSAST::FieldView::GetObjectTypeName() const noexcept
+	{
+		return m_sast->GetString(m_sast->m_fields[m_index].objectTypeName);
+	}
+
+	inline std::optional<FlatSAST::NodeView> FlatSAST::FieldView::GetObjectNode() const noexcept
+	{
+		Index objectNode = m_sast->m_fields[m_index].objectNode;
+		if (objectNode == INVALID_INDEX)
+			return std::nullopt;
+		return NodeView(m_sast, objectNode);
+	}
+
+	inline std::optional<FlatSAST::FieldView> FlatSAST::FieldView::GetElementType() const noexcept
+	{
+		Index elementType = m_sast->m_fields[m_index].elementType;
+		if (elementType == INVALID_INDEX)
+			return std::nullopt;
+		return FieldView(m_sast, elementType);
+	}
+
+	inline std::optional<FlatSAST::FieldView> FlatSAST::FieldView::GetKeyType() const noexcept
+	{
+		Index keyType = m_sast->m_fields[m_index].keyType;
+		if (keyType == INVALID_INDEX)
+			return std::nullopt;
+		return FieldView(m_sast, keyType);
+	}
+
+	inline std::optional<FlatSAST::FieldView> FlatSAST::FieldView::GetValueType() const noexcept
+	{
+		Index valueType = m_sast->m_fields[m_index].valueType;
+		if (valueType == INVALID_INDEX)
+			return std::nullopt;
+		return FieldView(m_sast, valueType);
+	}
+
+	inline std::string_view FlatSAST::FieldView::GetLengthVar() const noexcept
+	{
+		return m_sast->GetString(m_sast->m_fields[m_index].lengthVar);
+	}
+
+	inline uint16_t FlatSAST::FieldView::GetArithmeticBits() const noexcept
+	{
+		return m_sast->m_fields[m_index].arithmeticBits;
+	}
+
+	inline bool FlatSAST::FieldView::IsArithmeticSigned() const noexcept
+	{
+		return m_sast->m_fields[m_index].arithmeticSigned;
+	}
+
+	inline std::optional<uint32_t> FlatSAST::FieldView::GetFieldId() const noexcept
+	{
+		const FieldRecord& record = m_sast->m_fields[m_index];
+		if (!record.hasFieldId)
+			return std::nullopt;
+		return record.fieldId;
+	}
+
+	inline std::string_view FlatSAST::FieldView::GetDefaultValue() const noexcept
+	{
+		return m_sast->GetString(m_sast->m_fields[m_index].defaultValue);
+	}
+
+	// FlatSAST
+
+	inline FlatSAST::ViewRange<FlatSAST::NodeView> FlatSAST::GetRoots() const noexcept
+	{
+		return ViewRange<NodeView>(this, m_roots.data(), 0, static_cast<Index>(m_roots.size()));
+	}
+
+	inline FlatSAST::ViewRange<FlatSAST::NodeView> FlatSAST::GetNodes() const noexcept
+	{
+		return ViewRange<NodeView>(this, nullptr, 0, static_cast<Index>(m_nodes.size()));
+	}
+
+	inline size_t FlatSAST::GetStringCount() const noexcept
+	{
+		return m_strings.size();
+	}
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_FLAT_SAST_INL
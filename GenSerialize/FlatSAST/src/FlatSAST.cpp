@@ -0,0 +1,157 @@
+#include <FlatSAST.h>
+
+#include <unordered_map>
+
+namespace GenTools::GenSerialize
+{
+	class FlatSAST::Builder
+	{
+	private:
+		FlatSAST& m_sast;
+
+		// Keys view into the source graph, which outlives the builder
+		std::unordered_map<std::string_view, Index> m_stringIndices;
+
+		std::vector<const SASTNode*> m_nodes;
+		std::unordered_map<const SASTNode*, Index> m_nodeIndices;
+
+		Index InternString(const std::string& value)
+		{
+			auto [it, inserted] = m_stringIndices.try_emplace(value, static_cast<Index>(m_sast.m_strings.size()));
+			if (inserted)
+			{
+				m_sast.m_strings.push_back({ static_cast<uint32_t>(m_sast.m_stringData.size()), static_cast<uint32_t>(value.size()) });
+				m_sast.m_stringData.append(value);
+			}
+			return it->second;
+		}
+
+		Index GetNodeIndex(const std::shared_ptr<SASTNode>& node) const
+		{
+			return node ? m_nodeIndices.at(node.get()) : INVALID_INDEX;
+		}
+
+		void CollectFieldNodes(const SASTField& field)
+		{
+			if (field.objectNode)
+				CollectNode(field.objectNode.get());
+
+			for (const auto* nested : { &field.elementType, &field.keyType, &field.valueType })
+			{
+				if (*nested)
+					CollectFieldNodes(**nested);
+			}
+		}
+
+		// Fill a field record already allocated at index, nested types are appended after every record allocated so far
+		void FillField(Index index, const SASTField& field)
+		{
+			FieldRecord record{};
+			record.name = InternString(field.name);
+			record.formattedName = InternString(field.formattedName);
+			record.originalTypeName = InternString(field.originalTypeName);
+			record.objectTypeName = InternString(field.objectTypeName);
+			record.lengthVar = InternString(field.lengthVar);
+			record.defaultValue = InternString(field.defaultValue);
+			record.objectNode = GetNodeIndex(field.objectNode);
+			record.fieldId = field.fieldId.value_or(0);
+			record.arithmeticBits = field.arithmeticBits;
+			record.type = field.type;
+			record.access = field.access;
+			record.arithmeticSigned = field.arithmeticSigned;
+			record.hasFieldId = field.fieldId.has_value();
+
+			Index* nestedIndices[] = { &record.elementType, &record.keyType, &record.valueType };
+			const std::shared_ptr<SASTField>* nestedFields[] = { &field.elementType, &field.keyType, &field.valueType };
+			for (size_t i = 0; i < 3; i++)
+			{
+				*nestedIndices[i] = INVALID_INDEX;
+				if (!*nestedFields[i])
+					continue;
+
+				*nestedIndices[i] = static_cast<Index>(m_sast.m_fields.size());
+				m_sast.m_fields.emplace_back();
+				FillField(*nestedIndices[i], **nestedFields[i]);
+			}
+
+			m_sast.m_fields[index] = record;
+		}
+
+	public:
+		explicit Builder(FlatSAST& sast)
+			: m_sast(sast)
+		{}
+
+		void CollectNode(const SASTNode* node)
+		{
+			if (!m_nodeIndices.try_emplace(node, static_cast<Index>(m_nodes.size())).second)
+				return;
+
+			m_nodes.push_back(node);
+			for (const auto& field : node->fields)
+			{
+				CollectFieldNodes(field);
+			}
+			for (const auto& baseNode : node->baseNodes)
+			{
+				CollectNode(baseNode.get());
+			}
+		}
+
+		void Build(const std::vector<std::shared_ptr<SASTNode>>& roots)
+		{
+			for (const auto& root : roots)
+			{
+				CollectNode(root.get());
+			}
+
+			m_sast.m_nodes.reserve(m_nodes.size());
+			for (const SASTNode* node : m_nodes)
+			{
+				NodeRecord record{};
+				record.name = InternString(node->name);
+				record.sourceFile = InternString(node->sourceFile);
+				record.serializationPolicy = node->serializationPolicy;
+
+				record.firstFormat = static_cast<Index>(m_sast.m_indices.size());
+				record.formatCount = static_cast<Index>(node->formats.size());
+				for (const auto& format : node->formats)
+				{
+					m_sast.m_indices.push_back(InternString(format));
+				}
+
+				record.firstBase = static_cast<Index>(m_sast.m_indices.size());
+				record.baseCount = static_cast<Index>(node->baseNodes.size());
+				for (const auto& baseNode : node->baseNodes)
+				{
+					m_sast.m_indices.push_back(GetNodeIndex(baseNode));
+				}
+
+				// Allocate the fields of the node as one run before filling any, their nested types go after it
+				record.firstField = static_cast<Index>(m_sast.m_fields.size());
+				record.fieldCount = static_cast<Index>(node->fields.size());
+				m_sast.m_fields.resize(m_sast.m_fields.size() + node->fields.size());
+				for (Index i = 0; i < record.fieldCount; i++)
+				{
+					FillField(record.firstField + i, node->fields[i]);
+				}
+
+				m_sast.m_nodes.push_back(record);
+			}
+
+			m_sast.m_roots.reserve(roots.size());
+			for (const auto& root : roots)
+			{
+				m_sast.m_roots.push_back(GetNodeIndex(root));
+			}
+		}
+	};
+
+	FlatSAST FlatSAST::Build(const std::vector<std::shared_ptr<SASTNode>>& roots)
+	{
+		FlatSAST sast;
+		Builder builder(sast);
+		builder.Build(roots);
+		return sast;
+	}
+}
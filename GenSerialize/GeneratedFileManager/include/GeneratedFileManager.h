@@ -4,6 +4,7 @@
 #include <GeneratedCode.h>
 #include <filesystem>
 #include <string>
+#include <cstdint>
 
 namespace GenTools::GenSerialize
 {
@@ -12,13 +13,35 @@ namespace GenTools::GenSerialize
 	private:
 		std::filesystem::path m_sourceFilePath;
 
+	public:
+		explicit GeneratedFileManager(const std::filesystem::path& sourceFilePath);
+
 		// Utility function to compute the path of the generated file
 		std::filesystem::path GetGeneratedHeaderPath() const;
 
-	public:
-		explicit GeneratedFileManager(const std::filesystem::path& sourceFilePath);
+		/// <summary>
+		/// Build the complete contents of the generated header
+		/// </summary>
+		/// <param name="generatedCode">The code generated for the types of the source file</param>
+		/// <returns>The contents of the generated header</returns>
+		std::string RenderGeneratedFile(const GeneratedCode& generatedCode) const;
+
+		/// <summary>
+		/// Write the generated header, leaving it untouched (along with its modification time) when its contents would not change.
+		/// The existing header is compared by size then by hash, and a new header is written to a temporary file then renamed over
+		/// the old one, so readers never observe a partially written header
+		/// </summary>
+		/// <param name="generatedCode">The code generated for the types of the source file</param>
+		/// <param name="contentHash">Optional, receives the hash of the header contents</param>
+		/// <returns>True if the header is up to date</returns>
+		bool UpdateGeneratedFile(const GeneratedCode& generatedCode, uint64_t* contentHash = nullptr) const;
 
-		bool UpdateGeneratedFile(const GeneratedCode& generatedCode) const;
+		/// <summary>
+		/// Delete the generated header of a source that no longer defines serializable types, so its stale macros stop being
+		/// compiled into the build. A header generated for another source with the same stem is left alone
+		/// </summary>
+		/// <returns>True unless a stale header could not be deleted</returns>
+		bool RemoveGeneratedFile() const;
 	};
 }
 
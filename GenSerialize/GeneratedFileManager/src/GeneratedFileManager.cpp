@@ -1,11 +1,25 @@
 #include <GeneratedFileManager.h>
 
+#include <GenerationCache.h>
+#include <AtomicFile.h>
+
 #include <fstream>
 #include <sstream>
+#include <map>
+#include <system_error>
 #include <PlatformInterface.h>
 
 namespace GenTools::GenSerialize
 {
+	namespace
+	{
+		// First line of every generated header, names the source it was generated for
+		std::string GetHeaderComment(const std::filesystem::path& sourceFilePath)
+		{
+			return "// Auto-generated serialization code for " + sourceFilePath.filename().string() + ". DO NOT MODIFY MANUALLY";
+		}
+	}
+
 	std::filesystem::path GeneratedFileManager::GetGeneratedHeaderPath() const
 	{
 		// For example, if source file is "MyClass.cpp", then header is "generated/MyClass.generated.h"
@@ -16,48 +30,104 @@ namespace GenTools::GenSerialize
 		: m_sourceFilePath(sourceFilePath)
 	{}
 
-	bool GeneratedFileManager::UpdateGeneratedFile(const GeneratedCode& generatedCode) const
+	std::string GeneratedFileManager::RenderGeneratedFile(const GeneratedCode& generatedCode) const
 	{
-		auto genPath = GetGeneratedHeaderPath();
-		std::filesystem::create_directories(genPath.parent_path());
-		std::ofstream outFile(genPath);
-		if (!outFile.is_open())
-		{
-			TERMINAL::PRINT_ERROR("ERROR: Could not open " + genPath.string() + " for writing.");
-			return false;
-		}
+		std::ostringstream outFile;
 
 		// Write put file header
-		outFile << "// Auto-generated serialization code for " << m_sourceFilePath.filename().string() << ". DO NOT MODIFY MANUALLY\n\n";
+		outFile << GetHeaderComment(m_sourceFilePath) << "\n\n";
 
-		if (generatedCode.code.size() == 1)
+		// Emit types and formats in name order so identical code always renders to identical bytes
+		std::map<std::string, std::map<std::string, const std::string*>> orderedCode;
+		for (const auto& [typeName, formatMap] : generatedCode.code)
+		{
+			auto& orderedFormats = orderedCode[typeName];
+			for (const auto& [format, code] : formatMap)
+			{
+				orderedFormats[format] = &code;
+			}
+		}
+
+		if (orderedCode.size() == 1)
 		{
 			// Single type ? standard GENERATED_SERIALIZATION_BODY macro
-			auto& [typeName, formatMap] = *generatedCode.code.begin();
+			auto& [typeName, formatMap] = *orderedCode.begin();
 
 			outFile << "#define GENERATED_SERIALIZATION_BODY() \\\n";
 			for (const auto& [format, code] : formatMap)
 			{
 				outFile << "/* Format: " << format << " */ \\\n";
-				outFile << code << "\n";
+				outFile << *code << "\n";
 			}
 		}
 		else
 		{
 			// Multiple types ? create macro per type
-			for (const auto& [typeName, formatMap] : generatedCode.code)
+			for (const auto& [typeName, formatMap] : orderedCode)
 			{
 				outFile << "#define " << typeName << "_SERIALIZATION_BODY() \\\n";
 				for (const auto& [format, code] : formatMap)
 				{
 					outFile << "/* Format: " << format << " */ \\\n";
-					outFile << code << "\n";
+					outFile << *code << "\n";
 				}
 				outFile << "\n";
 			}
 		}
 
-		outFile.close();
+		return outFile.str();
+	}
+
+	bool GeneratedFileManager::UpdateGeneratedFile(const GeneratedCode& generatedCode, uint64_t* contentHash) const
+	{
+		auto genPath = GetGeneratedHeaderPath();
+		std::string content = RenderGeneratedFile(generatedCode);
+		uint64_t hash = GenerationCache::HashBytes(content);
+		if (contentHash)
+			*contentHash = hash;
+
+		// Rewriting an identical header would only bump its timestamp and trigger rebuilds of everything including it.
+		// A size mismatch settles most changes without reading the old header
+		std::error_code ec;
+		auto existingSize = std::filesystem::file_size(genPath, ec);
+		if (!ec && existingSize == content.size() && GenerationCache::HashFile(genPath) == hash)
+			return true;
+
+		// Atomically replace the old header
+		if (std::error_code writeError = WriteFileAtomically(genPath, content))
+		{
+			TERMINAL::PRINT_ERROR_S("ERROR: Could not write " + genPath.string() + ": " + writeError.message());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool GeneratedFileManager::RemoveGeneratedFile() const
+	{
+		auto genPath = GetGeneratedHeaderPath();
+
+		std::string firstLine;
+		{
+			std::ifstream file(genPath, std::ios::binary);
+			if (!file.is_open())
+				return true;
+			std::getline(file, firstLine);
+		}
+
+		if (!firstLine.empty() && firstLine.back() == '\r')
+			firstLine.pop_back();
+		if (firstLine != GetHeaderComment(m_sourceFilePath))
+			return true;
+
+		std::error_code ec;
+		std::filesystem::remove(genPath, ec);
+		if (ec)
+		{
+			TERMINAL::PRINT_ERROR_S("ERROR: Could not delete " + genPath.string() + ": " + ec.message());
+			return false;
+		}
+
 		return true;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,124 @@
+#ifndef GENTOOLS_GENSERIALIZE_GENERATION_CACHE_H
+#define GENTOOLS_GENSERIALIZE_GENERATION_CACHE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// What a previous run recorded about one source file
+	/// </summary>
+	struct GenerationCacheEntry
+	{
+		// Hash of the source file contents
+		uint64_t sourceHash = 0;
+		// Hash of the generated header written for the source, 0 if the source has no serializable types
+		uint64_t outputHash = 0;
+		// Files read while parsing the source (its includes) and the hash of their contents
+		std::vector<std::pair<std::string, uint64_t>> dependencies;
+	};
+
+	/// <summary>
+	/// Persistent record of the inputs each generated header was produced from. A source whose contents, dependencies, compile
+	/// arguments and plugins all match the previous run already has an up to date generated header, so it can skip the Clang parse
+	/// and code generation entirely
+	/// </summary>
+	class GenerationCache
+	{
+	private:
+		std::filesystem::path m_cachePath;
+		uint64_t m_configHash;
+
+		std::unordered_map<std::string, GenerationCacheEntry> m_entries;
+		bool m_dirty = false;
+
+		mutable std::mutex m_mutex;
+
+	public:
+		/// <summary>
+		/// Create a cache backed by the given file
+		/// </summary>
+		/// <param name="cachePath">Location of the cache file</param>
+		/// <param name="configHash">Hash of everything besides the sources that affects the output (compile arguments, plugins)</param>
+		GenerationCache(const std::filesystem::path& cachePath, uint64_t configHash);
+
+		/// <summary>
+		/// 64 bit FNV-1a hash of a block of bytes
+		/// </summary>
+		/// <param name="data">The bytes to hash</param>
+		/// <param name="seed">Previous hash to continue from, for hashing several blocks as one</param>
+		/// <returns>The hash</returns>
+		static uint64_t HashBytes(std::string_view data, uint64_t seed = 0xcbf29ce484222325ull) noexcept;
+
+		/// <summary>
+		/// Hash the contents of a file
+		/// </summary>
+		/// <returns>The hash, or nothing if the file could not be read</returns>
+		static std::optional<uint64_t> HashFile(const std::filesystem::path& path);
+
+		/// <summary>
+		/// Hash the size and modification time of a file, a cheap identity for large binaries such as plugins
+		/// </summary>
+		/// <returns>The hash, or nothing if the file does not exist</returns>
+		static std::optional<uint64_t> HashFileStamp(const std::filesystem::path& path);
+
+		/// <summary>
+		/// Normalize a source path so the same file always maps to the same entry
+		/// </summary>
+		static std::string NormalizePath(const std::filesystem::path& path);
+
+		/// <summary>
+		/// Read the cache file. A missing, unreadable, or outdated cache leaves the cache empty
+		/// </summary>
+		/// <returns>True if entries were loaded</returns>
+		bool Load();
+
+		/// <summary>
+		/// Write the cache file if it changed, through a temporary file so an interrupted run never leaves a partial cache
+		/// </summary>
+		/// <returns>True on success</returns>
+		bool Save();
+
+		/// <summary>
+		/// Check if the generated header of a source is up to date with its inputs
+		/// </summary>
+		/// <param name="sourcePath">Normalized path of the source</param>
+		/// <param name="sourceHash">Hash of the current contents of the source</param>
+		/// <param name="generatedPath">Path of the generated header of the source</param>
+		/// <returns>True if the source can be skipped</returns>
+		bool IsUpToDate(const std::string& sourcePath, uint64_t sourceHash, const std::filesystem::path& generatedPath) const;
+
+		/// <summary>
+		/// Record the inputs and output of a source after it was generated
+		/// </summary>
+		/// <param name="sourcePath">Normalized path of the source</param>
+		/// <param name="entry">The entry to record</param>
+		void Update(const std::string& sourcePath, GenerationCacheEntry entry);
+
+		/// <summary>
+		/// Drop the entry of a source, so it is regenerated on the next run
+		/// </summary>
+		/// <param name="sourcePath">Normalized path of the source</param>
+		void Invalidate(const std::string& sourcePath);
+
+		/// <summary>
+		/// The files a source read when it was last generated
+		/// </summary>
+		/// <param name="sourcePath">Normalized path of the source</param>
+		/// <returns>Paths of the recorded dependencies, empty if the source has no entry</returns>
+		std::vector<std::string> GetDependencies(const std::string& sourcePath) const;
+
+		GenerationCache(const GenerationCache&) = delete;
+		GenerationCache& operator=(const GenerationCache&) = delete;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_GENERATION_CACHE_H
@@ -0,0 +1,245 @@
+#include <GenerationCache.h>
+#include <AtomicFile.h>
+
+#include <fstream>
+#include <sstream>
+#include <array>
+#include <charconv>
+#include <system_error>
+
+#include <PlatformInterface.h>
+
+namespace GenTools::GenSerialize
+{
+	namespace
+	{
+		constexpr std::string_view CACHE_MAGIC = "GenSerializeCache";
+		constexpr uint32_t CACHE_VERSION = 1;
+
+		std::string ToHex(uint64_t value)
+		{
+			std::array<char, 16> buffer;
+			auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, 16);
+			return std::string(buffer.data(), result.ptr);
+		}
+
+		bool FromHex(std::string_view text, uint64_t& value)
+		{
+			auto result = std::from_chars(text.data(), text.data() + text.size(), value, 16);
+			return result.ec == std::errc() && result.ptr == text.data() + text.size();
+		}
+	}
+
+	GenerationCache::GenerationCache(const std::filesystem::path& cachePath, uint64_t configHash)
+		: m_cachePath(cachePath), m_configHash(configHash)
+	{}
+
+	uint64_t GenerationCache::HashBytes(std::string_view data, uint64_t seed) noexcept
+	{
+		uint64_t hash = seed;
+		for (unsigned char c : data)
+		{
+			hash ^= c;
+			hash *= 0x100000001b3ull;
+		}
+		return hash;
+	}
+
+	std::optional<uint64_t> GenerationCache::HashFile(const std::filesystem::path& path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open())
+			return std::nullopt;
+
+		uint64_t hash = HashBytes({});
+		std::array<char, 64 * 1024> buffer;
+		while (file)
+		{
+			file.read(buffer.data(), buffer.size());
+			hash = HashBytes(std::string_view(buffer.data(), static_cast<size_t>(file.gcount())), hash);
+		}
+
+		if (file.bad())
+			return std::nullopt;
+
+		return hash;
+	}
+
+	std::optional<uint64_t> GenerationCache::HashFileStamp(const std::filesystem::path& path)
+	{
+		std::error_code ec;
+		auto size = std::filesystem::file_size(path, ec);
+		if (ec)
+			return std::nullopt;
+
+		auto time = std::filesystem::last_write_time(path, ec);
+		if (ec)
+			return std::nullopt;
+
+		uint64_t ticks = static_cast<uint64_t>(time.time_since_epoch().count());
+		uint64_t hash = HashBytes(std::string_view(reinterpret_cast<const char*>(&size), sizeof(size)));
+		return HashBytes(std::string_view(reinterpret_cast<const char*>(&ticks), sizeof(ticks)), hash);
+	}
+
+	std::string GenerationCache::NormalizePath(const std::filesystem::path& path)
+	{
+		std::error_code ec;
+		auto absolutePath = std::filesystem::absolute(path, ec);
+		return (ec ? path : absolutePath).lexically_normal().string();
+	}
+
+	bool GenerationCache::Load()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_entries.clear();
+
+		std::ifstream file(m_cachePath);
+		if (!file.is_open())
+			return false;
+
+		std::string line;
+		if (!std::getline(file, line) || line != std::string(CACHE_MAGIC) + " " + std::to_string(CACHE_VERSION))
+		{
+			m_dirty = true;
+			return false;
+		}
+
+		// Entries produced with other compile arguments or plugins describe different output, drop them all
+		uint64_t configHash = 0;
+		if (!std::getline(file, line) || !line.starts_with("config ") || !FromHex(std::string_view(line).substr(7), configHash) || configHash != m_configHash)
+		{
+			m_dirty = true;
+			return false;
+		}
+
+		GenerationCacheEntry* current = nullptr;
+		while (std::getline(file, line))
+		{
+			std::string_view view(line);
+			if (view.starts_with("source "))
+			{
+				current = &m_entries[std::string(view.substr(7))];
+			}
+			else if (current && view.starts_with("hash "))
+			{
+				view.remove_prefix(5);
+				size_t space = view.find(' ');
+				if (space == std::string_view::npos || !FromHex(view.substr(0, space), current->sourceHash) || !FromHex(view.substr(space + 1), current->outputHash))
+					break;
+			}
+			else if (current && view.starts_with("dep "))
+			{
+				view.remove_prefix(4);
+				size_t space = view.find(' ');
+				uint64_t hash = 0;
+				if (space == std::string_view::npos || !FromHex(view.substr(0, space), hash))
+					break;
+				current->dependencies.emplace_back(std::string(view.substr(space + 1)), hash);
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		if (!file.eof())
+		{
+			// Corrupt cache, regenerate everything rather than trusting part of it
+			TERMINAL::PRINT_WARNING("Warning: Ignoring corrupt generation cache " + m_cachePath.string());
+			m_entries.clear();
+			m_dirty = true;
+			return false;
+		}
+
+		return true;
+	}
+
+	bool GenerationCache::Save()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (!m_dirty)
+			return true;
+
+		std::ostringstream oss;
+		oss << CACHE_MAGIC << " " << CACHE_VERSION << "\n";
+		oss << "config " << ToHex(m_configHash) << "\n";
+		for (const auto& [sourcePath, entry] : m_entries)
+		{
+			oss << "source " << sourcePath << "\n";
+			oss << "hash " << ToHex(entry.sourceHash) << " " << ToHex(entry.outputHash) << "\n";
+			for (const auto& [dependency, hash] : entry.dependencies)
+			{
+				oss << "dep " << ToHex(hash) << " " << dependency << "\n";
+			}
+		}
+
+		if (std::error_code ec = WriteFileAtomically(m_cachePath, oss.str()))
+		{
+			TERMINAL::PRINT_WARNING("Warning: Could not write generation cache " + m_cachePath.string() + ": " + ec.message());
+			return false;
+		}
+
+		m_dirty = false;
+		return true;
+	}
+
+	bool GenerationCache::IsUpToDate(const std::string& sourcePath, uint64_t sourceHash, const std::filesystem::path& generatedPath) const
+	{
+		GenerationCacheEntry entry;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto it = m_entries.find(sourcePath);
+			if (it == m_entries.end())
+				return false;
+			entry = it->second;
+		}
+
+		if (entry.sourceHash != sourceHash)
+			return false;
+
+		// The generated header must still be the one that was written (not deleted or edited by hand)
+		if (entry.outputHash != 0 && HashFile(generatedPath) != entry.outputHash)
+			return false;
+
+		for (const auto& [dependency, hash] : entry.dependencies)
+		{
+			if (HashFile(dependency) != hash)
+				return false;
+		}
+
+		return true;
+	}
+
+	void GenerationCache::Update(const std::string& sourcePath, GenerationCacheEntry entry)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_entries[sourcePath] = std::move(entry);
+		m_dirty = true;
+	}
+
+	void GenerationCache::Invalidate(const std::string& sourcePath)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_entries.erase(sourcePath))
+			m_dirty = true;
+	}
+
+	std::vector<std::string> GenerationCache::GetDependencies(const std::string& sourcePath) const
+	{
+		std::vector<std::string> dependencies;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_entries.find(sourcePath);
+		if (it == m_entries.end())
+			return dependencies;
+
+		dependencies.reserve(it->second.dependencies.size());
+		for (const auto& [dependency, hash] : it->second.dependencies)
+		{
+			dependencies.push_back(dependency);
+		}
+		return dependencies;
+	}
+}
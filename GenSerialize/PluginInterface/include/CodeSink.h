@@ -0,0 +1,116 @@
+#ifndef GENTOOLS_GENSERIALIZE_CODE_SINK_H
+#define GENTOOLS_GENSERIALIZE_CODE_SINK_H
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Append only output buffer that format plugins write generated code into. Every piece is copied once, straight into the final
+	/// buffer, instead of being built up in nested strings that are returned and concatenated. Optionally ends every line with a
+	/// macro continuation as it is written. Defined inline so dynamically loaded plugins do not link against the generator
+	/// </summary>
+	class CodeSink
+	{
+	private:
+		static constexpr std::string_view MACRO_CONTINUATION = " \\\n";
+
+		std::string m_buffer;
+		bool m_macroContinuation;
+
+	public:
+		/// <summary>
+		/// Create an empty sink
+		/// </summary>
+		/// <param name="macroContinuation">End every line with " \" so the code can be the body of a macro</param>
+		/// <param name="reserve">Bytes to allocate up front</param>
+		explicit CodeSink(bool macroContinuation = false, size_t reserve = 0)
+			: m_macroContinuation(macroContinuation)
+		{
+			m_buffer.reserve(reserve);
+		}
+
+		CodeSink& Write(std::string_view text)
+		{
+			if (!m_macroContinuation)
+			{
+				m_buffer.append(text);
+				return *this;
+			}
+
+			for (size_t newline = text.find('\n'); newline != std::string_view::npos; newline = text.find('\n'))
+			{
+				m_buffer.append(text.substr(0, newline));
+				m_buffer.append(MACRO_CONTINUATION);
+				text.remove_prefix(newline + 1);
+			}
+			m_buffer.append(text);
+			return *this;
+		}
+
+		CodeSink& Write(char c)
+		{
+			if (m_macroContinuation && c == '\n')
+				m_buffer.append(MACRO_CONTINUATION);
+			else
+				m_buffer.push_back(c);
+			return *this;
+		}
+
+		template<std::integral Integer>
+			requires (!std::same_as<Integer, char> && !std::same_as<Integer, bool>)
+		CodeSink& Write(Integer value)
+		{
+			std::array<char, 24> digits;
+			auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+			m_buffer.append(digits.data(), result.ptr);
+			return *this;
+		}
+
+		/// <summary>
+		/// Write one tab per indentation level
+		/// </summary>
+		CodeSink& Indent(size_t depth)
+		{
+			m_buffer.append(depth, '\t');
+			return *this;
+		}
+
+		template<typename T>
+		CodeSink& operator<<(const T& value)
+		{
+			return Write(value);
+		}
+
+		/// <returns>The code written so far</returns>
+		std::string_view View() const noexcept
+		{
+			return m_buffer;
+		}
+
+		/// <returns>Number of bytes written so far</returns>
+		size_t Size() const noexcept
+		{
+			return m_buffer.size();
+		}
+
+		/// <summary>
+		/// Finish the code and move it out, leaving the sink empty. With macro continuations a last line without a newline is ended too
+		/// </summary>
+		/// <returns>The code</returns>
+		std::string Take()
+		{
+			if (m_macroContinuation && !m_buffer.empty() && m_buffer.back() != '\n')
+				m_buffer.append(MACRO_CONTINUATION);
+
+			return std::move(m_buffer);
+		}
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_CODE_SINK_H
@@ -7,6 +7,7 @@
 #include <unordered_map>
 #include <filesystem>
 #include <iostream>
+#include <mutex>
 
 #include <IFormatPlugin.h>
 #include <FileFormatRegistry.h>
@@ -22,6 +23,10 @@ using LibraryHandle = void*;
 
 namespace GenTools::GenSerialize
 {
+	/// <summary>
+	/// Loads format plugins from shared libraries. Loading a library only opens it and reads its manifest, the plugin itself is
+	/// created the first time one of its formats is requested (see CreatePluginsForFormat)
+	/// </summary>
 	class DynamicPluginLoader
 	{
 	private:
@@ -29,21 +34,44 @@ namespace GenTools::GenSerialize
 		{
 			std::string path;
 			LibraryHandle handle = nullptr;
+			std::vector<std::string> formatNames;
+			uint8_t priority = 0;
+			uint32_t capabilities = PLUGIN_CAPABILITY_NONE;
+			// Set once the plugin was asked for, instance stays null if creating it failed
+			bool created = false;
 			IFormatPlugin* instance = nullptr;
 		};
 
 		std::vector<PluginHandle> m_loadedPlugins;
 
+		// Plugins are created on the first lookup of their format, which may come from several generation threads at once
+		mutable std::mutex m_mutex;
+
 		LibraryHandle LoadSharedLibrary(const std::string& path);
 		void UnloadSharedLibrary(LibraryHandle handle);
+		const FormatPluginManifest* GetPluginManifest(LibraryHandle handle);
 		IFormatPlugin* GetPluginInstance(LibraryHandle handle);
 
 	public:
 		DynamicPluginLoader() = default;
 		~DynamicPluginLoader();
 
+		DynamicPluginLoader(const DynamicPluginLoader&) = delete;
+		DynamicPluginLoader& operator=(const DynamicPluginLoader&) = delete;
+
 		void LoadPluginsFromDirectory(const std::string& path);
 		bool LoadPluginFromFile(const std::string& path);
+
+		/// <summary>
+		/// Create every loaded plugin whose manifest lists the format and register it with the FileFormatRegistry. Plugins not
+		/// declared thread safe are registered behind a wrapper that serializes the calls into them. Safe to call concurrently
+		/// </summary>
+		/// <param name="formatName">The requested format</param>
+		/// <returns>True if a plugin was registered for the format</returns>
+		bool CreatePluginsForFormat(const std::string& formatName);
+
+		// Paths of the plugins loaded so far, in load order, whether or not they have been created
+		std::vector<std::string> GetLoadedPluginPaths() const;
 	};
 }
 
@@ -2,8 +2,11 @@
 #define GENTOOLS_GENSERIALIZE_FORMAT_PLUGIN_INTERFACE_H
 
 #include <SAST.h>
+#include <FlatSAST.h>
+#include <CodeSink.h>
 
 #include <string>
+#include <cstdint>
 
 #if defined(_WIN32)
 #if defined(FORMAT_PLUGIN_EXPORTS)
@@ -29,10 +32,55 @@
 		return instance.get();															\
 	}
 
+// Version of the plugin interface, raised whenever IFormatPlugin or FormatPluginManifest change layout. Plugins built against
+// another version are not loaded
+#define FORMAT_PLUGIN_ABI_VERSION 1u
+
+// Exports the manifest of a dynamically loaded plugin, read before the plugin is created. Takes the priority, the capability
+// flags (FormatPluginCapabilities) and the names of the formats the plugin handles
+#define DECLARE_FORMAT_PLUGIN_MANIFEST(Priority, Capabilities, ...)										\
+	static const char* const formatPluginManifestFormats[] = { __VA_ARGS__ };							\
+	extern "C" FORMAT_PLUGIN_ABI const GenTools::GenSerialize::FormatPluginManifest GenSerializePluginManifest = {	\
+		FORMAT_PLUGIN_ABI_VERSION,																		\
+		static_cast<uint32_t>(sizeof(formatPluginManifestFormats) / sizeof(formatPluginManifestFormats[0])), \
+		formatPluginManifestFormats,																	\
+		Priority,																						\
+		Capabilities																					\
+	};
+
 namespace GenTools::GenSerialize
 {
 	/// <summary>
-	/// Interface for plugins that generate serialization code in a specific format
+	/// What a plugin declares about itself in its manifest
+	/// </summary>
+	enum FormatPluginCapabilities : uint32_t
+	{
+		PLUGIN_CAPABILITY_NONE = 0,
+		// Code generation may be called concurrently, otherwise the loader serializes every call into the plugin
+		PLUGIN_CAPABILITY_THREAD_SAFE = 1u << 0,
+		// EmitCode writes straight into the sink (IStreamingFormatPlugin)
+		PLUGIN_CAPABILITY_STREAMING = 1u << 1,
+		// Code is generated from flat SAST views (ConsumesFlatSAST)
+		PLUGIN_CAPABILITY_FLAT_SAST = 1u << 2
+	};
+
+	/// <summary>
+	/// Plain data exported by a dynamic plugin under the name GenSerializePluginManifest (see DECLARE_FORMAT_PLUGIN_MANIFEST).
+	/// The loader reads it before creating the plugin, so only plugins for the formats in use are created
+	/// </summary>
+	struct FormatPluginManifest
+	{
+		uint32_t abiVersion;
+		uint32_t formatCount;
+		const char* const* formatNames;
+		uint8_t priority;
+		uint32_t capabilities;
+	};
+
+	/// <summary>
+	/// Interface for plugins that generate serialization code in a specific format. GenerateCode and GenerateFlatCode are called
+	/// concurrently for different types, and for the same type by plugins of other formats, so they must not modify the SAST or
+	/// any state shared between calls
 	/// </summary>
 	class FORMAT_PLUGIN_ABI IFormatPlugin
 	{
@@ -60,6 +108,35 @@ namespace GenTools::GenSerialize
 		/// </summary>
 		/// <returns>Priority level (default = 0)</returns>
 		virtual uint8_t FORMAT_PLUGIN_CALL GetPluginPriority() const noexcept = 0;
+
+		/// <summary>
+		/// Whether the plugin generates code from flat SAST views. Such plugins have GenerateFlatCode called instead of GenerateCode
+		/// </summary>
+		/// <returns>True if GenerateFlatCode is implemented (default = false)</returns>
+		virtual bool FORMAT_PLUGIN_CALL ConsumesFlatSAST() const noexcept { return false; }
+
+		/// <summary>
+		/// Generate serialization code for a type of a flat SAST. The view, and every view reached from it, stays valid for the call
+		/// </summary>
+		/// <param name="node">Read only view of the type to generate code for</param>
+		/// <returns>The generated code</returns>
+		virtual std::string FORMAT_PLUGIN_CALL GenerateFlatCode([[maybe_unused]] const FlatSAST::NodeView node) { return {}; }
+
+		/// <summary>
+		/// Write serialization code for the given SAST node into a sink. By default the result of GenerateCode is copied in,
+		/// streaming plugins (IStreamingFormatPlugin) write directly
+		/// </summary>
+		/// <param name="sastNode">The SAST node to generate code for</param>
+		/// <param name="sink">Receives the generated code</param>
+		virtual void FORMAT_PLUGIN_CALL EmitCode(const std::shared_ptr<SASTNode>& sastNode, CodeSink& sink) { sink.Write(GenerateCode(sastNode)); }
+
+		/// <summary>
+		/// Write serialization code for a type of a flat SAST into a sink, only called when ConsumesFlatSAST returns true. By
+		/// default the result of GenerateFlatCode is copied in
+		/// </summary>
+		/// <param name="node">Read only view of the type to generate code for</param>
+		/// <param name="sink">Receives the generated code</param>
+		virtual void FORMAT_PLUGIN_CALL EmitFlatCode(const FlatSAST::NodeView node, CodeSink& sink) { sink.Write(GenerateFlatCode(node)); }
 	};
 }
 
@@ -0,0 +1,37 @@
+#ifndef GENTOOLS_GENSERIALIZE_STREAMING_FORMAT_PLUGIN_INTERFACE_H
+#define GENTOOLS_GENSERIALIZE_STREAMING_FORMAT_PLUGIN_INTERFACE_H
+
+#include <IFormatPlugin.h>
+#include <CodeSink.h>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Interface for plugins that write their code into the sink supplied by the generator rather than returning it. GenerateCode
+	/// is implemented on top of EmitCode, for callers that still want a string
+	/// </summary>
+	class FORMAT_PLUGIN_ABI IStreamingFormatPlugin : public IFormatPlugin
+	{
+	public:
+		/// <summary>
+		/// Write serialization code for the given SAST node
+		/// </summary>
+		/// <param name="sastNode">The SAST node to generate code for</param>
+		/// <param name="sink">Receives the generated code</param>
+		void FORMAT_PLUGIN_CALL EmitCode(const std::shared_ptr<SASTNode>& sastNode, CodeSink& sink) override = 0;
+
+		/// <summary>
+		/// Generate serialization code for the given SAST node
+		/// </summary>
+		/// <param name="sastNode">The SAST node to generate code for</param>
+		/// <returns>The generated code</returns>
+		std::string FORMAT_PLUGIN_CALL GenerateCode(const std::shared_ptr<SASTNode> sastNode) override
+		{
+			CodeSink sink;
+			EmitCode(sastNode, sink);
+			return sink.Take();
+		}
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_STREAMING_FORMAT_PLUGIN_INTERFACE_H
@@ -2,8 +2,67 @@
 
 #include <PlatformInterface.h>
 
+#include <algorithm>
+
 namespace GenTools::GenSerialize
 {
+	namespace
+	{
+		/// <summary>
+		/// Forwards to a plugin that is not declared thread safe, one call at a time
+		/// </summary>
+		class SerializedFormatPlugin : public IFormatPlugin
+		{
+		private:
+			IFormatPlugin* m_plugin;
+			std::mutex m_mutex;
+
+		public:
+			explicit SerializedFormatPlugin(IFormatPlugin* plugin)
+				: m_plugin(plugin)
+			{}
+
+			std::string FORMAT_PLUGIN_CALL GenerateCode(const std::shared_ptr<SASTNode> sastNode) override
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				return m_plugin->GenerateCode(sastNode);
+			}
+
+			std::string FORMAT_PLUGIN_CALL GetFormatName() const noexcept override
+			{
+				return m_plugin->GetFormatName();
+			}
+
+			uint8_t FORMAT_PLUGIN_CALL GetPluginPriority() const noexcept override
+			{
+				return m_plugin->GetPluginPriority();
+			}
+
+			bool FORMAT_PLUGIN_CALL ConsumesFlatSAST() const noexcept override
+			{
+				return m_plugin->ConsumesFlatSAST();
+			}
+
+			std::string FORMAT_PLUGIN_CALL GenerateFlatCode(const FlatSAST::NodeView node) override
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				return m_plugin->GenerateFlatCode(node);
+			}
+
+			void FORMAT_PLUGIN_CALL EmitCode(const std::shared_ptr<SASTNode>& sastNode, CodeSink& sink) override
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_plugin->EmitCode(sastNode, sink);
+			}
+
+			void FORMAT_PLUGIN_CALL EmitFlatCode(const FlatSAST::NodeView node, CodeSink& sink) override
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_plugin->EmitFlatCode(node, sink);
+			}
+		};
+	}
+
 	DynamicPluginLoader::~DynamicPluginLoader()
 	{
 		for (auto& plugin : m_loadedPlugins)
@@ -42,30 +101,111 @@ namespace GenTools::GenSerialize
 			return false;
 		}
 
-		IFormatPlugin* pluginInstance = GetPluginInstance(handle);
-		if (!pluginInstance)
+		const FormatPluginManifest* manifest = GetPluginManifest(handle);
+		if (!manifest)
 		{
-			TERMINAL::PRINT_WARNING("Failed to locate CreatePlugin in: " + path);
+			TERMINAL::PRINT_WARNING("Failed to locate GenSerializePluginManifest in: " + path);
 			UnloadSharedLibrary(handle);
 			return false;
 		}
 
-		auto shared = std::shared_ptr<IFormatPlugin>(pluginInstance, [](IFormatPlugin*) {
-			// Do nothing, lifetime managed statically inside the plugin
-			});
+		if (manifest->abiVersion != FORMAT_PLUGIN_ABI_VERSION)
+		{
+			TERMINAL::PRINT_WARNING("Plugin " + path + " was built for plugin interface version " + std::to_string(manifest->abiVersion) +
+				", expected version " + std::to_string(FORMAT_PLUGIN_ABI_VERSION));
+			UnloadSharedLibrary(handle);
+			return false;
+		}
 
-		FileFormatRegistry::GetInstance().RegisterPlugin(shared, shared->GetPluginPriority());
-		m_loadedPlugins.push_back({ path, handle, pluginInstance });
+		if (manifest->formatCount == 0 || !manifest->formatNames)
+		{
+			TERMINAL::PRINT_WARNING("Plugin " + path + " declares no formats");
+			UnloadSharedLibrary(handle);
+			return false;
+		}
+
+		// The manifest lives in the library, copy it so nothing points into plugins that are never created
+		PluginHandle plugin;
+		plugin.path = path;
+		plugin.handle = handle;
+		for (uint32_t i = 0; i < manifest->formatCount; i++)
+		{
+			if (manifest->formatNames[i])
+				plugin.formatNames.emplace_back(manifest->formatNames[i]);
+		}
+		plugin.priority = manifest->priority;
+		plugin.capabilities = manifest->capabilities;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_loadedPlugins.push_back(std::move(plugin));
 
 		return true;
 	}
 
+	bool DynamicPluginLoader::CreatePluginsForFormat(const std::string& formatName)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		bool registered = false;
+		for (auto& plugin : m_loadedPlugins)
+		{
+			if (plugin.created || std::find(plugin.formatNames.begin(), plugin.formatNames.end(), formatName) == plugin.formatNames.end())
+				continue;
+
+			plugin.created = true;
+			IFormatPlugin* pluginInstance = GetPluginInstance(plugin.handle);
+			if (!pluginInstance)
+			{
+				TERMINAL::PRINT_WARNING_S("Failed to locate CreatePlugin in: " + plugin.path);
+				continue;
+			}
+
+			std::string pluginFormat = pluginInstance->GetFormatName();
+			if (std::find(plugin.formatNames.begin(), plugin.formatNames.end(), pluginFormat) == plugin.formatNames.end())
+			{
+				TERMINAL::PRINT_WARNING_S("Plugin " + plugin.path + " generates format " + pluginFormat + ", which its manifest does not list");
+				continue;
+			}
+
+			std::shared_ptr<IFormatPlugin> shared;
+			if (plugin.capabilities & PLUGIN_CAPABILITY_THREAD_SAFE)
+			{
+				shared = std::shared_ptr<IFormatPlugin>(pluginInstance, [](IFormatPlugin*) {
+					// Do nothing, lifetime managed statically inside the plugin
+					});
+			}
+			else
+			{
+				shared = std::make_shared<SerializedFormatPlugin>(pluginInstance);
+			}
+
+			FileFormatRegistry::GetInstance().RegisterPlugin(shared, plugin.priority);
+			plugin.instance = pluginInstance;
+			registered = registered || pluginFormat == formatName;
+		}
+
+		return registered;
+	}
+
+	std::vector<std::string> DynamicPluginLoader::GetLoadedPluginPaths() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		std::vector<std::string> paths;
+		paths.reserve(m_loadedPlugins.size());
+		for (const auto& plugin : m_loadedPlugins)
+		{
+			paths.push_back(plugin.path);
+		}
+		return paths;
+	}
+
 	LibraryHandle DynamicPluginLoader::LoadSharedLibrary(const std::string& path)
 	{
 #if defined(_WIN32)
 		return LoadLibrary(path.c_str());
 #else
-		return dlopen(path.c_str(), RTLD_NOW);
+		return dlopen(path.c_str(), RTLD_LAZY | RTLD_LOCAL);
 #endif
 	}
 
@@ -78,6 +218,16 @@ namespace GenTools::GenSerialize
 #endif
 	}
 
+	const FormatPluginManifest* DynamicPluginLoader::GetPluginManifest(LibraryHandle handle)
+	{
+#if defined(_WIN32)
+		FARPROC symbol = GetProcAddress(handle, "GenSerializePluginManifest");
+#else
+		void* symbol = dlsym(handle, "GenSerializePluginManifest");
+#endif
+		return reinterpret_cast<const FormatPluginManifest*>(symbol);
+	}
+
 	IFormatPlugin* DynamicPluginLoader::GetPluginInstance(LibraryHandle handle)
 	{
 #if defined(_WIN32)
@@ -0,0 +1,62 @@
+#ifndef GENTOOLS_GENSERIALIZE_PRECOMPILED_PRELUDE_H
+#define GENTOOLS_GENSERIALIZE_PRECOMPILED_PRELUDE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <llvm/ADT/IntrusiveRefCntPtr.h>
+#include <llvm/Support/VirtualFileSystem.h>
+#include <clang/Basic/FileManager.h>
+#include <clang/Serialization/PCHContainerOperations.h>
+#include <clang/Tooling/ArgumentsAdjusters.h>
+#include <clang/Tooling/CompilationDatabase.h>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Precompiled header built once from a user supplied prelude, a header that includes the heavy headers common to the sources.
+	/// Every source parse then loads the prelude from the PCH instead of parsing those headers again
+	/// </summary>
+	class PrecompiledPrelude
+	{
+	private:
+		std::string m_preludePath;
+		std::string m_pchPath;
+
+		// Non system files the prelude read, every source parsed with the PCH depends on them
+		std::vector<std::string> m_dependencies;
+
+	public:
+		/// <summary>
+		/// Describe a prelude, nothing is built until Build is called
+		/// </summary>
+		/// <param name="preludePath">The header to precompile</param>
+		/// <param name="pchPath">Where to write the precompiled header</param>
+		PrecompiledPrelude(std::string preludePath, std::string pchPath);
+
+		/// <summary>
+		/// Precompile the prelude with the same compile arguments and serialization macros the sources are parsed with, a PCH is
+		/// only accepted by compilations configured like the one that built it
+		/// </summary>
+		/// <param name="compilations">The compilation database the sources are parsed with</param>
+		/// <param name="fileSystem">The file system the sources are parsed with</param>
+		/// <param name="fileManager">The file manager the sources are parsed with</param>
+		/// <param name="PCHContainerOps">The container operations shared by every ClangTool of the run</param>
+		/// <returns>True if the PCH was written</returns>
+		bool Build(const clang::tooling::CompilationDatabase& compilations,
+			llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fileSystem,
+			llvm::IntrusiveRefCntPtr<clang::FileManager> fileManager,
+			std::shared_ptr<clang::PCHContainerOperations> PCHContainerOps);
+
+		/// <summary>
+		/// Adjuster that makes a ClangTool include the PCH ahead of each source
+		/// </summary>
+		clang::tooling::ArgumentsAdjuster GetArgumentsAdjuster() const;
+
+		/// <returns>The non system files the prelude read</returns>
+		const std::vector<std::string>& GetDependencies() const noexcept;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_PRECOMPILED_PRELUDE_H
@@ -0,0 +1,112 @@
+#include <PrecompiledPrelude.h>
+
+#include <ASTParser.h>
+#include <SASTGeneratorAction.h>
+
+#include <clang/Frontend/CompilerInstance.h>
+#include <clang/Frontend/FrontendActions.h>
+#include <clang/Tooling/Tooling.h>
+
+#include <utility>
+
+#include <PlatformInterface.h>
+
+namespace GenTools::GenSerialize
+{
+	namespace
+	{
+		/// <summary>
+		/// Writes the PCH of the prelude to a fixed path and records the files the prelude read
+		/// </summary>
+		class PreludePCHAction : public clang::GeneratePCHAction
+		{
+		private:
+			const std::string& m_pchPath;
+			std::vector<std::string>& m_dependencies;
+
+		protected:
+			bool BeginInvocation(clang::CompilerInstance& CI) override
+			{
+				AddSerializationMacroDefs(CI.getPreprocessorOpts());
+				CI.getFrontendOpts().SkipFunctionBodies = true;
+
+				// ClangTool strips -o from the command line, so the output is set here
+				CI.getFrontendOpts().OutputFile = m_pchPath;
+				return clang::GeneratePCHAction::BeginInvocation(CI);
+			}
+
+			void EndSourceFileAction() override
+			{
+				m_dependencies = ASTParser::CollectDependencies(getCompilerInstance().getSourceManager());
+				clang::GeneratePCHAction::EndSourceFileAction();
+			}
+
+		public:
+			PreludePCHAction(const std::string& pchPath, std::vector<std::string>& dependencies)
+				: m_pchPath(pchPath), m_dependencies(dependencies)
+			{}
+		};
+
+		class PreludePCHActionFactory : public clang::tooling::FrontendActionFactory
+		{
+		private:
+			const std::string& m_pchPath;
+			std::vector<std::string>& m_dependencies;
+
+		public:
+			PreludePCHActionFactory(const std::string& pchPath, std::vector<std::string>& dependencies)
+				: m_pchPath(pchPath), m_dependencies(dependencies)
+			{}
+
+			std::unique_ptr<clang::FrontendAction> create() override
+			{
+				return std::make_unique<PreludePCHAction>(m_pchPath, m_dependencies);
+			}
+		};
+	}
+
+	PrecompiledPrelude::PrecompiledPrelude(std::string preludePath, std::string pchPath)
+		: m_preludePath(std::move(preludePath)), m_pchPath(std::move(pchPath))
+	{}
+
+	bool PrecompiledPrelude::Build(const clang::tooling::CompilationDatabase& compilations,
+		llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fileSystem,
+		llvm::IntrusiveRefCntPtr<clang::FileManager> fileManager,
+		std::shared_ptr<clang::PCHContainerOperations> PCHContainerOps)
+	{
+		m_dependencies.clear();
+
+		clang::tooling::ClangTool tool(compilations, { m_preludePath }, std::move(PCHContainerOps), std::move(fileSystem), std::move(fileManager));
+
+		// The prelude is a header, parse it as one
+		tool.appendArgumentsAdjuster([](const clang::tooling::CommandLineArguments& args, llvm::StringRef) {
+			clang::tooling::CommandLineArguments adjustedArgs;
+			adjustedArgs.reserve(args.size());
+			for (const auto& arg : args)
+			{
+				adjustedArgs.push_back(arg == "-xc++" ? "-xc++-header" : arg);
+			}
+			return adjustedArgs;
+		});
+
+		PreludePCHActionFactory factory(m_pchPath, m_dependencies);
+		if (tool.run(&factory))
+		{
+			TERMINAL::PRINT_WARNING("Warning: Failed to precompile prelude " + m_preludePath + ", sources will be parsed without it");
+			m_dependencies.clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	clang::tooling::ArgumentsAdjuster PrecompiledPrelude::GetArgumentsAdjuster() const
+	{
+		return clang::tooling::getInsertArgumentAdjuster({ "-include-pch", m_pchPath }, clang::tooling::ArgumentInsertPosition::BEGIN);
+	}
+
+	const std::vector<std::string>& PrecompiledPrelude::GetDependencies() const noexcept
+	{
+		return m_dependencies;
+	}
+}
@@ -0,0 +1,126 @@
+#ifndef GENTOOLS_GENSERIALIZE_RUN_STATISTICS_H
+#define GENTOOLS_GENSERIALIZE_RUN_STATISTICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Wall and CPU time of the phases of a run, and counts of what it produced. Phases are timed by Scope objects on any
+	/// thread, which cost nothing while the statistics are not enabled
+	/// </summary>
+	class RunStatistics
+	{
+	public:
+		/// <summary>
+		/// One timed phase on one thread, times in microseconds from the start of the run
+		/// </summary>
+		struct Span
+		{
+			std::string phase;
+			// What the phase worked on, such as the source file, may be empty
+			std::string detail;
+			uint32_t threadId = 0;
+			int64_t start = 0;
+			int64_t wallTime = 0;
+			int64_t cpuTime = 0;
+		};
+
+		/// <summary>
+		/// Times the phase from construction until End is called or the scope is left
+		/// </summary>
+		class Scope
+		{
+		private:
+			// Null while the statistics are disabled
+			RunStatistics* m_statistics = nullptr;
+			std::string m_phase;
+			std::string m_detail;
+			std::chrono::steady_clock::time_point m_wallStart;
+			int64_t m_cpuStart = 0;
+
+		public:
+			explicit Scope(std::string_view phase, std::string_view detail = {});
+			~Scope();
+
+			Scope(const Scope&) = delete;
+			Scope& operator=(const Scope&) = delete;
+
+			/// <summary>
+			/// Record the phase now rather than when the scope is left
+			/// </summary>
+			void End();
+		};
+
+	private:
+		std::atomic<bool> m_enabled = false;
+		std::chrono::steady_clock::time_point m_start;
+
+		std::vector<Span> m_spans;
+		// Counters in the order they were first added
+		std::vector<std::pair<std::string, uint64_t>> m_counts;
+		mutable std::mutex m_mutex;
+
+		RunStatistics() = default;
+
+		void Record(Span span);
+
+		// CPU time used by the calling thread so far, in microseconds
+		static int64_t ThreadCpuTime();
+		// Small stable number of the calling thread
+		static uint32_t ThreadId();
+
+	public:
+		static RunStatistics& GetInstance();
+
+		RunStatistics(const RunStatistics&) = delete;
+		RunStatistics& operator=(const RunStatistics&) = delete;
+
+		/// <summary>
+		/// Drop what an earlier run recorded and start recording
+		/// </summary>
+		void Start();
+
+		/// <summary>
+		/// Stop recording, what was recorded is kept for the reports
+		/// </summary>
+		void Stop() noexcept;
+
+		bool IsEnabled() const noexcept;
+
+		/// <summary>
+		/// Add to a counter, ignored while the statistics are disabled
+		/// </summary>
+		/// <param name="counter">Name of the counter</param>
+		/// <param name="value">Amount to add</param>
+		void AddCount(std::string_view counter, uint64_t value);
+
+		/// <returns>Every recorded phase, in the order they ended</returns>
+		std::vector<Span> GetSpans() const;
+
+		/// <returns>Value of the counter, 0 if it was never added to</returns>
+		uint64_t GetCount(std::string_view counter) const;
+
+		/// <summary>
+		/// Print the total, calls, maximum wall time and CPU time of each phase, and the counters
+		/// </summary>
+		void PrintSummary(std::ostream& out) const;
+
+		/// <summary>
+		/// Write the phases as a Chrome trace event file, viewable as a timeline of the threads in chrome://tracing or Perfetto
+		/// </summary>
+		/// <param name="path">Where to write the trace</param>
+		/// <returns>True on success</returns>
+		bool WriteChromeTrace(const std::filesystem::path& path) const;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_RUN_STATISTICS_H
@@ -0,0 +1,310 @@
+#include <RunStatistics.h>
+
+#include <PlatformInterface.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace GenTools::GenSerialize
+{
+	namespace
+	{
+		void AppendJSONString(std::string& out, std::string_view value)
+		{
+			out.push_back('"');
+			for (char c : value)
+			{
+				switch (c)
+				{
+				case '"': out += "\\\""; break;
+				case '\\': out += "\\\\"; break;
+				case '\n': out += "\\n"; break;
+				case '\r': out += "\\r"; break;
+				case '\t': out += "\\t"; break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20)
+					{
+						char escaped[8];
+						std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+						out += escaped;
+					}
+					else
+					{
+						out.push_back(c);
+					}
+					break;
+				}
+			}
+			out.push_back('"');
+		}
+
+		std::string Milliseconds(int64_t microseconds)
+		{
+			char text[32];
+			std::snprintf(text, sizeof(text), "%.1f", static_cast<double>(microseconds) / 1000.0);
+			return text;
+		}
+
+		std::string PadLeft(const std::string& text, size_t width)
+		{
+			return text.size() >= width ? text : std::string(width - text.size(), ' ') + text;
+		}
+
+		std::string PadRight(const std::string& text, size_t width)
+		{
+			return text.size() >= width ? text : text + std::string(width - text.size(), ' ');
+		}
+	}
+
+	RunStatistics::Scope::Scope(std::string_view phase, std::string_view detail)
+	{
+		RunStatistics& statistics = RunStatistics::GetInstance();
+		if (!statistics.IsEnabled())
+			return;
+
+		m_statistics = &statistics;
+		m_phase = phase;
+		m_detail = detail;
+		m_cpuStart = ThreadCpuTime();
+		m_wallStart = std::chrono::steady_clock::now();
+	}
+
+	RunStatistics::Scope::~Scope()
+	{
+		End();
+	}
+
+	void RunStatistics::Scope::End()
+	{
+		if (!m_statistics)
+			return;
+
+		auto wallEnd = std::chrono::steady_clock::now();
+
+		Span span;
+		span.phase = std::move(m_phase);
+		span.detail = std::move(m_detail);
+		span.threadId = ThreadId();
+		span.start = std::chrono::duration_cast<std::chrono::microseconds>(m_wallStart - m_statistics->m_start).count();
+		span.wallTime = std::chrono::duration_cast<std::chrono::microseconds>(wallEnd - m_wallStart).count();
+		span.cpuTime = ThreadCpuTime() - m_cpuStart;
+		m_statistics->Record(std::move(span));
+
+		m_statistics = nullptr;
+	}
+
+	RunStatistics& RunStatistics::GetInstance()
+	{
+		static RunStatistics instance;
+		return instance;
+	}
+
+	int64_t RunStatistics::ThreadCpuTime()
+	{
+#if defined(_WIN32)
+		FILETIME creationTime, exitTime, kernelTime, userTime;
+		if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+			return 0;
+
+		// In units of 100 nanoseconds
+		auto toTicks = [](const FILETIME& time) { return (static_cast<int64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime; };
+		return (toTicks(kernelTime) + toTicks(userTime)) / 10;
+#else
+		timespec time;
+		if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0)
+			return 0;
+		return static_cast<int64_t>(time.tv_sec) * 1000000 + time.tv_nsec / 1000;
+#endif
+	}
+
+	uint32_t RunStatistics::ThreadId()
+	{
+		static std::atomic<uint32_t> nextThreadId{ 1 };
+		thread_local uint32_t threadId = nextThreadId.fetch_add(1, std::memory_order_relaxed);
+		return threadId;
+	}
+
+	void RunStatistics::Record(Span span)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_spans.push_back(std::move(span));
+	}
+
+	void RunStatistics::Start()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_spans.clear();
+		m_counts.clear();
+		m_start = std::chrono::steady_clock::now();
+		m_enabled.store(true, std::memory_order_release);
+	}
+
+	void RunStatistics::Stop() noexcept
+	{
+		m_enabled.store(false, std::memory_order_release);
+	}
+
+	bool RunStatistics::IsEnabled() const noexcept
+	{
+		return m_enabled.load(std::memory_order_acquire);
+	}
+
+	void RunStatistics::AddCount(std::string_view counter, uint64_t value)
+	{
+		if (!IsEnabled())
+			return;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto count = std::find_if(m_counts.begin(), m_counts.end(), [&](const auto& entry) { return entry.first == counter; });
+		if (count == m_counts.end())
+			m_counts.emplace_back(std::string(counter), value);
+		else
+			count->second += value;
+	}
+
+	std::vector<RunStatistics::Span> RunStatistics::GetSpans() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_spans;
+	}
+
+	uint64_t RunStatistics::GetCount(std::string_view counter) const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto count = std::find_if(m_counts.begin(), m_counts.end(), [&](const auto& entry) { return entry.first == counter; });
+		return count == m_counts.end() ? 0 : count->second;
+	}
+
+	void RunStatistics::PrintSummary(std::ostream& out) const
+	{
+		struct PhaseTotals
+		{
+			std::string phase;
+			size_t calls = 0;
+			int64_t wallTime = 0;
+			int64_t cpuTime = 0;
+			int64_t maxWallTime = 0;
+		};
+
+		std::vector<PhaseTotals> phases;
+		std::vector<std::pair<std::string, uint64_t>> counts;
+		int64_t runTime = 0;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			// Phases in the order they first started
+			std::vector<const Span*> spans;
+			spans.reserve(m_spans.size());
+			for (const auto& span : m_spans)
+			{
+				spans.push_back(&span);
+				runTime = std::max(runTime, span.start + span.wallTime);
+			}
+			std::stable_sort(spans.begin(), spans.end(), [](const Span* a, const Span* b) { return a->start < b->start; });
+
+			std::unordered_map<std::string_view, size_t> phaseIndices;
+			for (const Span* span : spans)
+			{
+				auto [phaseIndex, inserted] = phaseIndices.try_emplace(span->phase, phases.size());
+				if (inserted)
+					phases.push_back({ span->phase });
+
+				PhaseTotals& totals = phases[phaseIndex->second];
+				totals.calls++;
+				totals.wallTime += span->wallTime;
+				totals.cpuTime += span->cpuTime;
+				totals.maxWallTime = std::max(totals.maxWallTime, span->wallTime);
+			}
+
+			counts = m_counts;
+		}
+
+		// Wall times of phases running on several threads at once add up past the length of the run
+		std::ostringstream table;
+		table << "[INFO] Run statistics, " << Milliseconds(runTime) << " ms from the first to the last phase\n";
+		table << PadRight("Phase", 32) << PadLeft("Calls", 8) << PadLeft("Wall ms", 12) << PadLeft("CPU ms", 12) << PadLeft("Max ms", 12) << "\n";
+		for (const auto& totals : phases)
+		{
+			table << PadRight(totals.phase, 32) << PadLeft(std::to_string(totals.calls), 8) << PadLeft(Milliseconds(totals.wallTime), 12)
+				<< PadLeft(Milliseconds(totals.cpuTime), 12) << PadLeft(Milliseconds(totals.maxWallTime), 12) << "\n";
+		}
+
+		if (!counts.empty())
+		{
+			table << PadRight("Counter", 32) << PadLeft("Value", 8) << "\n";
+			for (const auto& [counter, value] : counts)
+			{
+				table << PadRight(counter, 32) << PadLeft(std::to_string(value), 8) << "\n";
+			}
+		}
+
+		out << table.str();
+		out.flush();
+	}
+
+	bool RunStatistics::WriteChromeTrace(const std::filesystem::path& path) const
+	{
+		std::string trace = "{\"traceEvents\":[";
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			bool first = true;
+			for (const auto& span : m_spans)
+			{
+				if (!first)
+					trace += ",";
+				first = false;
+
+				trace += "\n{\"name\":";
+				AppendJSONString(trace, span.phase);
+				trace += ",\"cat\":\"GenSerialize\",\"ph\":\"X\",\"pid\":1,\"tid\":" + std::to_string(span.threadId);
+				trace += ",\"ts\":" + std::to_string(span.start) + ",\"dur\":" + std::to_string(span.wallTime);
+				trace += ",\"args\":{\"cpu_us\":" + std::to_string(span.cpuTime);
+				if (!span.detail.empty())
+				{
+					trace += ",\"detail\":";
+					AppendJSONString(trace, span.detail);
+				}
+				trace += "}}";
+			}
+
+			// Counters are attached to the trace as metadata
+			trace += "\n],\"otherData\":{";
+			first = true;
+			for (const auto& [counter, value] : m_counts)
+			{
+				if (!first)
+					trace += ",";
+				first = false;
+
+				AppendJSONString(trace, counter);
+				trace += ":";
+				AppendJSONString(trace, std::to_string(value));
+			}
+			trace += "}}\n";
+		}
+
+		std::error_code ec;
+		if (path.has_parent_path())
+			std::filesystem::create_directories(path.parent_path(), ec);
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			TERMINAL::PRINT_WARNING("Warning: Could not write trace " + path.string());
+			return false;
+		}
+		file << trace;
+		return static_cast<bool>(file);
+	}
+}
@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <optional>
+#include <cstdint>
 
 namespace GenTools::GenSerialize
 {
@@ -43,6 +45,7 @@ namespace GenTools::GenSerialize
 		SASTType type;							// The type of the field
 		std::string originalTypeName;			// The C++ type name of the field, for debugging or further processing
 		std::shared_ptr<SASTNode> objectNode;	// For complex types, a link to the SASTNode representing that type
+		std::string objectTypeName;				// For complex types, the fully qualified name of the type, used to link objectNode
 
 		// For container types
 		// For Array, Vector, and Set the contained type
@@ -52,11 +55,24 @@ namespace GenTools::GenSerialize
 		std::shared_ptr<SASTField> valueType;
 		// For dynamic arrays, the name of the variable that contains its length
 		std::string lengthVar;
+
+		// For Int and Float, the exact arithmetic type
+		// The width of the type in bits (0 when unknown)
+		uint16_t arithmeticBits = 0;
+		// Whether the integer type is signed
+		bool arithmeticSigned = false;
+
+		// For schema evolution
+		// The stable identifier of the field (SERIALIZE_ID), independent of declaration order
+		std::optional<uint32_t> fieldId;
+		// The C++ expression for the value of the field when it is absent from serialized data (SERIALIZE_DEFAULT)
+		std::string defaultValue;
 	};
 
 	struct SASTNode
 	{
 		std::string name; 						// The fully qualified type name of the class or struct
+		std::string sourceFile;					// The file the type is defined in
 		
 		// The serialization or "access" policy for this type
 		enum class SerializationPolicy
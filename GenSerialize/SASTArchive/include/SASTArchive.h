@@ -0,0 +1,39 @@
+#ifndef GENTOOLS_GENSERIALIZE_SAST_ARCHIVE_H
+#define GENTOOLS_GENSERIALIZE_SAST_ARCHIVE_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <SAST.h>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Compact binary form of a SAST graph, for keeping it on disk between runs. Every string is stored once in a string table and
+	/// nodes refer to strings and to each other by index, so an archive is restored in a single pass over one buffer
+	/// </summary>
+	class SASTArchive
+	{
+	public:
+		SASTArchive() = delete;
+
+		/// <summary>
+		/// Serialize nodes along with every node they link to (object fields, container types, base classes)
+		/// </summary>
+		/// <param name="roots">The nodes to store</param>
+		/// <returns>The archive bytes</returns>
+		static std::string Write(const std::vector<std::shared_ptr<SASTNode>>& roots);
+
+		/// <summary>
+		/// Restore the nodes of an archive with the links between them
+		/// </summary>
+		/// <param name="data">The archive bytes</param>
+		/// <returns>The nodes passed to Write, in the same order</returns>
+		/// <exception cref="std::runtime_error">The data is truncated or is not a valid archive</exception>
+		static std::vector<std::shared_ptr<SASTNode>> Read(std::string_view data);
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_SAST_ARCHIVE_H
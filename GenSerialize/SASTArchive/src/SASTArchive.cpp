@@ -0,0 +1,364 @@
+#include <SASTArchive.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace GenTools::GenSerialize
+{
+	namespace
+	{
+		constexpr std::string_view ARCHIVE_MAGIC = "GSAST";
+		constexpr uint32_t ARCHIVE_VERSION = 1;
+
+		// Guards against corrupt data, no real SAST nests containers this deeply
+		constexpr uint32_t MAX_FIELD_DEPTH = 64;
+
+		// Index of a missing link
+		constexpr uint32_t NO_INDEX = 0xFFFFFFFFu;
+
+		class ArchiveWriter
+		{
+		private:
+			std::string m_strings;
+			uint32_t m_stringCount = 0;
+			std::unordered_map<std::string_view, uint32_t> m_stringIndices;
+
+			std::vector<const SASTNode*> m_nodes;
+			std::unordered_map<const SASTNode*, uint32_t> m_nodeIndices;
+
+			std::string m_body;
+
+			static void PutU8(std::string& out, uint8_t value)
+			{
+				out.push_back(static_cast<char>(value));
+			}
+
+			static void PutU32(std::string& out, uint32_t value)
+			{
+				for (int shift = 0; shift < 32; shift += 8)
+				{
+					out.push_back(static_cast<char>((value >> shift) & 0xFF));
+				}
+			}
+
+			// The string table keys view into the nodes, which outlive the writer
+			void PutString(const std::string& value)
+			{
+				auto [it, inserted] = m_stringIndices.try_emplace(value, m_stringCount);
+				if (inserted)
+				{
+					PutU32(m_strings, static_cast<uint32_t>(value.size()));
+					m_strings.append(value);
+					m_stringCount++;
+				}
+
+				PutU32(m_body, it->second);
+			}
+
+			void PutNodeLink(const std::shared_ptr<SASTNode>& node)
+			{
+				PutU32(m_body, node ? m_nodeIndices.at(node.get()) : NO_INDEX);
+			}
+
+			void CollectFieldNodes(const SASTField& field)
+			{
+				if (field.objectNode)
+					CollectNode(field.objectNode.get());
+
+				for (const auto* nested : { &field.elementType, &field.keyType, &field.valueType })
+				{
+					if (*nested)
+						CollectFieldNodes(**nested);
+				}
+			}
+
+			void PutField(const SASTField& field)
+			{
+				PutU8(m_body, static_cast<uint8_t>(field.access));
+				PutString(field.name);
+				PutString(field.formattedName);
+				PutU8(m_body, static_cast<uint8_t>(field.type));
+				PutString(field.originalTypeName);
+				PutString(field.objectTypeName);
+				PutNodeLink(field.objectNode);
+				PutString(field.lengthVar);
+				PutU32(m_body, field.arithmeticBits);
+				PutU8(m_body, field.arithmeticSigned);
+				PutU8(m_body, field.fieldId.has_value());
+				PutU32(m_body, field.fieldId.value_or(0));
+				PutString(field.defaultValue);
+
+				uint8_t nestedMask = (field.elementType ? 1 : 0) | (field.keyType ? 2 : 0) | (field.valueType ? 4 : 0);
+				PutU8(m_body, nestedMask);
+				for (const auto* nested : { &field.elementType, &field.keyType, &field.valueType })
+				{
+					if (*nested)
+						PutField(**nested);
+				}
+			}
+
+		public:
+			void CollectNode(const SASTNode* node)
+			{
+				if (!m_nodeIndices.try_emplace(node, static_cast<uint32_t>(m_nodes.size())).second)
+					return;
+
+				m_nodes.push_back(node);
+				for (const auto& field : node->fields)
+				{
+					CollectFieldNodes(field);
+				}
+				for (const auto& baseNode : node->baseNodes)
+				{
+					CollectNode(baseNode.get());
+				}
+			}
+
+			std::string Finish(const std::vector<std::shared_ptr<SASTNode>>& roots)
+			{
+				PutU32(m_body, static_cast<uint32_t>(m_nodes.size()));
+				for (const SASTNode* node : m_nodes)
+				{
+					PutString(node->name);
+					PutString(node->sourceFile);
+					PutU8(m_body, static_cast<uint8_t>(node->serializationPolicy));
+
+					PutU32(m_body, static_cast<uint32_t>(node->formats.size()));
+					for (const auto& format : node->formats)
+					{
+						PutString(format);
+					}
+
+					PutU32(m_body, static_cast<uint32_t>(node->fields.size()));
+					for (const auto& field : node->fields)
+					{
+						PutField(field);
+					}
+
+					PutU32(m_body, static_cast<uint32_t>(node->baseNodes.size()));
+					for (const auto& baseNode : node->baseNodes)
+					{
+						PutNodeLink(baseNode);
+					}
+				}
+
+				PutU32(m_body, static_cast<uint32_t>(roots.size()));
+				for (const auto& root : roots)
+				{
+					PutNodeLink(root);
+				}
+
+				std::string archive(ARCHIVE_MAGIC);
+				PutU32(archive, ARCHIVE_VERSION);
+				PutU32(archive, m_stringCount);
+				archive.reserve(archive.size() + m_strings.size() + m_body.size());
+				archive.append(m_strings);
+				archive.append(m_body);
+				return archive;
+			}
+		};
+
+		class ArchiveReader
+		{
+		private:
+			std::string_view m_data;
+			size_t m_position = 0;
+
+			std::vector<std::string> m_strings;
+			std::vector<std::shared_ptr<SASTNode>> m_nodes;
+
+			[[noreturn]] static void Fail(const char* reason)
+			{
+				throw std::runtime_error(std::string("Invalid SAST archive: ") + reason);
+			}
+
+			void Require(size_t bytes) const
+			{
+				if (m_data.size() - m_position < bytes)
+					Fail("data ends unexpectedly");
+			}
+
+			uint8_t GetU8()
+			{
+				Require(1);
+				return static_cast<uint8_t>(m_data[m_position++]);
+			}
+
+			uint32_t GetU32()
+			{
+				Require(4);
+				uint32_t value = 0;
+				for (int shift = 0; shift < 32; shift += 8)
+				{
+					value |= static_cast<uint32_t>(static_cast<uint8_t>(m_data[m_position++])) << shift;
+				}
+				return value;
+			}
+
+			// Every counted item takes at least one byte, so a count larger than the remaining data is corrupt
+			uint32_t GetCount()
+			{
+				uint32_t count = GetU32();
+				if (count > m_data.size() - m_position)
+					Fail("count exceeds the data");
+				return count;
+			}
+
+			template<typename Enum>
+			Enum GetEnum(Enum last)
+			{
+				uint8_t value = GetU8();
+				if (value > static_cast<uint8_t>(last))
+					Fail("enumerator out of range");
+				return static_cast<Enum>(value);
+			}
+
+			const std::string& GetString()
+			{
+				uint32_t index = GetU32();
+				if (index >= m_strings.size())
+					Fail("string index out of range");
+				return m_strings[index];
+			}
+
+			std::shared_ptr<SASTNode> GetNodeLink()
+			{
+				uint32_t index = GetU32();
+				if (index == NO_INDEX)
+					return nullptr;
+				if (index >= m_nodes.size())
+					Fail("node index out of range");
+				return m_nodes[index];
+			}
+
+			void GetField(SASTField& field, uint32_t depth)
+			{
+				if (depth > MAX_FIELD_DEPTH)
+					Fail("fields nested too deeply");
+
+				field.access = GetEnum(SASTField::Access::Private);
+				field.name = GetString();
+				field.formattedName = GetString();
+				field.type = GetEnum(SASTType::Unordered_Map);
+				field.originalTypeName = GetString();
+				field.objectTypeName = GetString();
+				field.objectNode = GetNodeLink();
+				field.lengthVar = GetString();
+				field.arithmeticBits = static_cast<uint16_t>(GetU32());
+				field.arithmeticSigned = GetU8() != 0;
+				bool hasFieldId = GetU8() != 0;
+				uint32_t fieldId = GetU32();
+				if (hasFieldId)
+					field.fieldId = fieldId;
+				field.defaultValue = GetString();
+
+				uint8_t nestedMask = GetU8();
+				uint8_t bit = 1;
+				for (auto* nested : { &field.elementType, &field.keyType, &field.valueType })
+				{
+					if (nestedMask & bit)
+					{
+						*nested = std::make_shared<SASTField>();
+						GetField(**nested, depth + 1);
+					}
+					bit <<= 1;
+				}
+			}
+
+		public:
+			explicit ArchiveReader(std::string_view data)
+				: m_data(data)
+			{}
+
+			std::vector<std::shared_ptr<SASTNode>> Read()
+			{
+				Require(ARCHIVE_MAGIC.size());
+				if (m_data.substr(0, ARCHIVE_MAGIC.size()) != ARCHIVE_MAGIC)
+					Fail("not an archive");
+				m_position = ARCHIVE_MAGIC.size();
+
+				if (GetU32() != ARCHIVE_VERSION)
+					Fail("unsupported version");
+
+				uint32_t stringCount = GetCount();
+				m_strings.reserve(stringCount);
+				for (uint32_t i = 0; i < stringCount; i++)
+				{
+					uint32_t length = GetU32();
+					Require(length);
+					m_strings.emplace_back(m_data.substr(m_position, length));
+					m_position += length;
+				}
+
+				// Links may point forward, so every node exists before any of them is filled in
+				uint32_t nodeCount = GetCount();
+				m_nodes.reserve(nodeCount);
+				for (uint32_t i = 0; i < nodeCount; i++)
+				{
+					m_nodes.push_back(std::make_shared<SASTNode>());
+				}
+
+				for (auto& node : m_nodes)
+				{
+					node->name = GetString();
+					node->sourceFile = GetString();
+					node->serializationPolicy = GetEnum(SASTNode::SerializationPolicy::Custom);
+
+					uint32_t formatCount = GetCount();
+					node->formats.reserve(formatCount);
+					for (uint32_t i = 0; i < formatCount; i++)
+					{
+						node->formats.push_back(GetString());
+					}
+
+					node->fields.resize(GetCount());
+					for (auto& field : node->fields)
+					{
+						GetField(field, 0);
+					}
+
+					uint32_t baseCount = GetCount();
+					node->baseNodes.reserve(baseCount);
+					for (uint32_t i = 0; i < baseCount; i++)
+					{
+						auto baseNode = GetNodeLink();
+						if (!baseNode)
+							Fail("missing base class");
+						node->baseNodes.push_back(std::move(baseNode));
+					}
+				}
+
+				uint32_t rootCount = GetCount();
+				std::vector<std::shared_ptr<SASTNode>> roots;
+				roots.reserve(rootCount);
+				for (uint32_t i = 0; i < rootCount; i++)
+				{
+					auto root = GetNodeLink();
+					if (!root)
+						Fail("missing root node");
+					roots.push_back(std::move(root));
+				}
+
+				return roots;
+			}
+		};
+	}
+
+	std::string SASTArchive::Write(const std::vector<std::shared_ptr<SASTNode>>& roots)
+	{
+		ArchiveWriter writer;
+		for (const auto& root : roots)
+		{
+			writer.CollectNode(root.get());
+		}
+
+		return writer.Finish(roots);
+	}
+
+	std::vector<std::shared_ptr<SASTNode>> SASTArchive::Read(std::string_view data)
+	{
+		ArchiveReader reader(data);
+		return reader.Read();
+	}
+}
@@ -0,0 +1,80 @@
+#ifndef GENTOOLS_GENSERIALIZE_SAST_CACHE_H
+#define GENTOOLS_GENSERIALIZE_SAST_CACHE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <SAST.h>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// A SAST restored from the cache, with the files it was parsed from
+	/// </summary>
+	struct SASTCacheEntry
+	{
+		std::vector<std::shared_ptr<SASTNode>> SASTTree;
+		// Files the SAST depends on besides the source itself, normalized
+		std::vector<std::string> dependencies;
+	};
+
+	/// <summary>
+	/// Per source store of parsed SASTs, one archive file for each source. A source whose contents, compile flags and includes
+	/// did not change since it was stored can have its code generated from the archive without running Clang
+	/// </summary>
+	class SASTCache
+	{
+	private:
+		std::filesystem::path m_directory;
+		uint64_t m_parserHash;
+
+		// Entry bytes by source path, kept when the cache lives across runs so valid entries are not read from disk again
+		bool m_keepInMemory;
+		mutable std::unordered_map<std::string, std::shared_ptr<const std::string>> m_memory;
+		mutable std::mutex m_memoryMutex;
+
+		std::optional<SASTCacheEntry> Decode(std::string_view data, const std::string& sourcePath, uint64_t sourceHash) const;
+
+	public:
+		/// <summary>
+		/// Create a cache storing its archives in the given directory
+		/// </summary>
+		/// <param name="directory">Directory of the archives, created on the first store</param>
+		/// <param name="parserHash">Identifies the parser, archives written by another parser are ignored</param>
+		/// <param name="keepInMemory">Keep the bytes of every entry read or stored, for a cache used by many runs of a daemon</param>
+		SASTCache(const std::filesystem::path& directory, uint64_t parserHash, bool keepInMemory = false);
+
+		/// <param name="sourcePath">Normalized path of a source</param>
+		/// <returns>Location of the archive for the source</returns>
+		std::filesystem::path GetEntryPath(const std::string& sourcePath) const;
+
+		/// <summary>
+		/// Write the SAST of a source, through a temporary file so a concurrent or interrupted run never reads a partial archive
+		/// </summary>
+		/// <param name="sourcePath">Normalized path of the source</param>
+		/// <param name="sourceHash">Hash of the contents and compile flags of the source</param>
+		/// <param name="dependencies">Files the SAST depends on and the hash of their contents</param>
+		/// <param name="SASTTree">The SAST of the source</param>
+		/// <returns>True on success</returns>
+		bool Store(const std::string& sourcePath, uint64_t sourceHash, const std::vector<std::pair<std::string, uint64_t>>& dependencies,
+			const std::vector<std::shared_ptr<SASTNode>>& SASTTree) const;
+
+		/// <summary>
+		/// Read the SAST of a source if it is still valid, its source hash matches and none of its dependencies changed
+		/// </summary>
+		/// <param name="sourcePath">Normalized path of the source</param>
+		/// <param name="sourceHash">Hash of the current contents and compile flags of the source</param>
+		/// <returns>The stored SAST, or nothing when there is no valid archive</returns>
+		std::optional<SASTCacheEntry> Load(const std::string& sourcePath, uint64_t sourceHash) const;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_SAST_CACHE_H
@@ -0,0 +1,195 @@
+#include <SASTCache.h>
+
+#include <SASTArchive.h>
+#include <GenerationCache.h>
+#include <AtomicFile.h>
+
+#include <array>
+#include <charconv>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+#include <PlatformInterface.h>
+
+namespace GenTools::GenSerialize
+{
+	namespace
+	{
+		constexpr std::string_view ENTRY_MAGIC = "GenSerializeSAST";
+
+		void PutU64(std::string& out, uint64_t value)
+		{
+			for (int shift = 0; shift < 64; shift += 8)
+			{
+				out.push_back(static_cast<char>((value >> shift) & 0xFF));
+			}
+		}
+
+		void PutString(std::string& out, const std::string& value)
+		{
+			PutU64(out, value.size());
+			out.append(value);
+		}
+
+		bool GetU64(std::string_view& in, uint64_t& value)
+		{
+			if (in.size() < 8)
+				return false;
+
+			value = 0;
+			for (int i = 0; i < 8; i++)
+			{
+				value |= static_cast<uint64_t>(static_cast<uint8_t>(in[i])) << (i * 8);
+			}
+			in.remove_prefix(8);
+			return true;
+		}
+
+		bool GetString(std::string_view& in, std::string_view& value)
+		{
+			uint64_t length = 0;
+			if (!GetU64(in, length) || length > in.size())
+				return false;
+
+			value = in.substr(0, length);
+			in.remove_prefix(length);
+			return true;
+		}
+	}
+
+	SASTCache::SASTCache(const std::filesystem::path& directory, uint64_t parserHash, bool keepInMemory)
+		: m_directory(directory), m_parserHash(parserHash), m_keepInMemory(keepInMemory)
+	{}
+
+	std::filesystem::path SASTCache::GetEntryPath(const std::string& sourcePath) const
+	{
+		// Keep the file name readable, the hash keeps sources with the same name in different directories apart
+		std::array<char, 16> buffer;
+		auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), GenerationCache::HashBytes(sourcePath), 16);
+
+		std::string fileName = std::filesystem::path(sourcePath).filename().string();
+		fileName += ".";
+		fileName.append(buffer.data(), result.ptr);
+		fileName += ".sast";
+		return m_directory / fileName;
+	}
+
+	bool SASTCache::Store(const std::string& sourcePath, uint64_t sourceHash, const std::vector<std::pair<std::string, uint64_t>>& dependencies,
+		const std::vector<std::shared_ptr<SASTNode>>& SASTTree) const
+	{
+		std::string data(ENTRY_MAGIC);
+		PutU64(data, m_parserHash);
+		PutString(data, sourcePath);
+		PutU64(data, sourceHash);
+		PutU64(data, dependencies.size());
+		for (const auto& [dependency, hash] : dependencies)
+		{
+			PutString(data, dependency);
+			PutU64(data, hash);
+		}
+		data += SASTArchive::Write(SASTTree);
+
+		// Sources are stored from several generation threads, every write gets its own temporary file
+		std::filesystem::path entryPath = GetEntryPath(sourcePath);
+		if (std::error_code ec = WriteFileAtomically(entryPath, data))
+		{
+			TERMINAL::PRINT_WARNING_S("Warning: Could not write SAST cache " + entryPath.string() + ": " + ec.message());
+			return false;
+		}
+
+		if (m_keepInMemory)
+		{
+			std::lock_guard<std::mutex> lock(m_memoryMutex);
+			m_memory[sourcePath] = std::make_shared<const std::string>(std::move(data));
+		}
+
+		return true;
+	}
+
+	std::optional<SASTCacheEntry> SASTCache::Load(const std::string& sourcePath, uint64_t sourceHash) const
+	{
+		if (m_keepInMemory)
+		{
+			std::shared_ptr<const std::string> data;
+			{
+				std::lock_guard<std::mutex> lock(m_memoryMutex);
+				if (auto it = m_memory.find(sourcePath); it != m_memory.end())
+					data = it->second;
+			}
+
+			// Another process may have stored a newer entry, fall back to the file when the kept one is outdated
+			if (data)
+			{
+				if (auto entry = Decode(*data, sourcePath, sourceHash))
+					return entry;
+			}
+		}
+
+		std::ifstream file(GetEntryPath(sourcePath), std::ios::binary);
+		if (!file.is_open())
+			return std::nullopt;
+
+		std::stringstream buffer;
+		buffer << file.rdbuf();
+		auto data = std::make_shared<const std::string>(buffer.str());
+
+		auto entry = Decode(*data, sourcePath, sourceHash);
+		if (entry && m_keepInMemory)
+		{
+			std::lock_guard<std::mutex> lock(m_memoryMutex);
+			m_memory[sourcePath] = std::move(data);
+		}
+
+		return entry;
+	}
+
+	std::optional<SASTCacheEntry> SASTCache::Decode(std::string_view data, const std::string& sourcePath, uint64_t sourceHash) const
+	{
+		// Cheap checks first, the archive itself is only decoded once everything it was built from is known to be unchanged
+		std::string_view in(data);
+		if (!in.starts_with(ENTRY_MAGIC))
+			return std::nullopt;
+		in.remove_prefix(ENTRY_MAGIC.size());
+
+		uint64_t parserHash = 0;
+		std::string_view storedPath;
+		uint64_t storedHash = 0;
+		uint64_t dependencyCount = 0;
+		if (!GetU64(in, parserHash) || parserHash != m_parserHash ||
+			!GetString(in, storedPath) || storedPath != sourcePath ||
+			!GetU64(in, storedHash) || storedHash != sourceHash ||
+			!GetU64(in, dependencyCount) || dependencyCount > in.size())
+		{
+			return std::nullopt;
+		}
+
+		SASTCacheEntry entry;
+		entry.dependencies.reserve(dependencyCount);
+		for (uint64_t i = 0; i < dependencyCount; i++)
+		{
+			std::string_view dependency;
+			uint64_t hash = 0;
+			if (!GetString(in, dependency) || !GetU64(in, hash))
+				return std::nullopt;
+
+			entry.dependencies.emplace_back(dependency);
+			if (GenerationCache::HashFile(entry.dependencies.back()) != hash)
+				return std::nullopt;
+		}
+
+		try
+		{
+			entry.SASTTree = SASTArchive::Read(in);
+		}
+		catch (const std::runtime_error& ex)
+		{
+			TERMINAL::PRINT_WARNING("Warning: Ignoring SAST cache for " + sourcePath + ": " + ex.what());
+			return std::nullopt;
+		}
+
+		return entry;
+	}
+}
@@ -8,9 +8,17 @@
 #include <ASTParser.h>
 
 #include <clang/Frontend/FrontendAction.h>
+#include <clang/Lex/PreprocessorOptions.h>
 
 namespace GenTools::GenSerialize
 {
+	/// <summary>
+	/// Define the serialization macros as the annotations the ASTParser looks for. Every compilation that shares a precompiled
+	/// header must define them identically
+	/// </summary>
+	/// <param name="ppOpts">Preprocessor options of the compilation</param>
+	void AddSerializationMacroDefs(clang::PreprocessorOptions& ppOpts);
+
 	class SASTGeneratorAction : public clang::ASTFrontendAction
 	{
 	private:
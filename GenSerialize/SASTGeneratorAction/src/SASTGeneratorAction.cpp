@@ -9,20 +9,8 @@
 
 namespace GenTools::GenSerialize
 {
-    SASTGeneratorAction::SASTGeneratorAction(SASTResult& result)
-        : m_result(result)
-    {}
-
-    std::unique_ptr<clang::ASTConsumer> SASTGeneratorAction::CreateASTConsumer(clang::CompilerInstance& ci, llvm::StringRef inFile)
-    {
-        m_result.filePath = inFile.str();
-
-        return std::make_unique<ASTParser>(m_result);
-    }
-
-    bool SASTGeneratorAction::BeginInvocation(clang::CompilerInstance& CI)
+    void AddSerializationMacroDefs(clang::PreprocessorOptions& ppOpts)
     {
-        auto& ppOpts = CI.getPreprocessorOpts();
         ppOpts.addMacroDef("SERIALIZABLE(...)=__attribute__((annotate(\"serializable:\" #__VA_ARGS__)))");
         ppOpts.addMacroDef("SERIALIZABLE_ALL(...)=__attribute__((annotate(\"serializable:all\")))");
         ppOpts.addMacroDef("SERIALIZABLE_PUBLIC(...)=__attribute__((annotate(\"serializable:public\")))");
@@ -33,8 +21,30 @@ namespace GenTools::GenSerialize
         ppOpts.addMacroDef("SERIALIZE_FIELD_AS(name)=__attribute__((annotate(\"serialize:\" #name)))");
         ppOpts.addMacroDef("STATIC_ARRAY=__attribute__((annotate(\"static_array\")))");
         ppOpts.addMacroDef("DYNAMIC_ARRAY(lengthVar)=__attribute__((annotate(\"dynamic_array:\" #lengthVar)))");
+        ppOpts.addMacroDef("SERIALIZE_ID(id)=__attribute__((annotate(\"field_id:\" #id)))");
+        ppOpts.addMacroDef("SERIALIZE_DEFAULT(...)=__attribute__((annotate(\"field_default:\" #__VA_ARGS__)))");
         ppOpts.addMacroDef("SERIALIZE_EXCLUDE=__attribute__((annotate(\"serialize:exclude\")))");
         ppOpts.addMacroDef("GENERATED_SERIALIZATION_BODY()=");
+    }
+
+    SASTGeneratorAction::SASTGeneratorAction(SASTResult& result)
+        : m_result(result)
+    {}
+
+    std::unique_ptr<clang::ASTConsumer> SASTGeneratorAction::CreateASTConsumer(clang::CompilerInstance& ci, llvm::StringRef inFile)
+    {
+        m_result.filePath = inFile.str();
+
+        return std::make_unique<ASTParser>(m_result);
+    }
+
+    bool SASTGeneratorAction::BeginInvocation(clang::CompilerInstance& CI)
+    {
+        AddSerializationMacroDefs(CI.getPreprocessorOpts());
+
+        // The ASTParser only looks at record declarations, so skip parsing function bodies along with the template
+        // instantiations they would trigger. Clang still parses the bodies it needs, those of constexpr and auto functions
+        CI.getFrontendOpts().SkipFunctionBodies = true;
         return clang::ASTFrontendAction::BeginInvocation(CI);
     }
 }
\ No newline at end of file
@@ -18,6 +18,20 @@ namespace GenTools::GenSerialize
 
 		std::unique_ptr<clang::FrontendAction> create() override;
 
+		/// <summary>
+		/// The result of each action run by this factory, one per parsed source
+		/// </summary>
+		const std::vector<SASTResult>& GetResults() const noexcept;
+
+		/// <summary>
+		/// Move the results out of this factory, leaving it without results
+		/// </summary>
+		std::vector<SASTResult> TakeResults() noexcept;
+
+		/// <summary>
+		/// Move the results of this factory into the given storage, leaving the factory without results. Not synchronized,
+		/// concurrent parses merge into storage of their own
+		/// </summary>
 		void MergeResults(
 			std::unordered_map<std::string, std::vector<std::shared_ptr<SASTNode>>>& globalSASTTrees,
 			std::unordered_map<std::string, std::shared_ptr<SASTNode>>& globalSASTMap
@@ -9,19 +9,34 @@ namespace GenTools::GenSerialize
 		return std::make_unique<SASTGeneratorAction>(m_results.back());
 	}
 
+	const std::vector<SASTResult>& SASTGeneratorActionFactory::GetResults() const noexcept
+	{
+		return m_results;
+	}
+
+	std::vector<SASTResult> SASTGeneratorActionFactory::TakeResults() noexcept
+	{
+		std::vector<SASTResult> results = std::move(m_results);
+		m_results.clear();
+		return results;
+	}
+
 	void SASTGeneratorActionFactory::MergeResults(
 		std::unordered_map<std::string, std::vector<std::shared_ptr<SASTNode>>>& globalSASTTrees,
 		std::unordered_map<std::string, std::shared_ptr<SASTNode>>& globalSASTMap
 	)
 	{
+		// The nodes are shared, move the pointers instead of bumping their reference counts
 		for (auto& result : m_results)
 		{
-			globalSASTTrees[result.filePath] = result.SASTTree;
-
-			for (const auto& [name, node] : result.SASTMap)
+			for (auto& [name, node] : result.SASTMap)
 			{
-				globalSASTMap[name] = node;
+				globalSASTMap[name] = std::move(node);
 			}
+
+			globalSASTTrees[std::move(result.filePath)] = std::move(result.SASTTree);
 		}
+
+		m_results.clear();
 	}
 }
\ No newline at end of file
@@ -4,7 +4,6 @@
 #include <vector>
 #include <unordered_map>
 #include <memory>
-#include <mutex>
 #include <SAST.h>
 
 namespace GenTools::GenSerialize
@@ -15,10 +14,33 @@ namespace GenTools::GenSerialize
 		std::vector<std::shared_ptr<SASTNode>>& m_localSASTTree;
 		const std::unordered_map<std::string, std::shared_ptr<SASTNode>>& m_globalSASTMap;
 
+		// Nodes found in the global map by the last Link
+		std::vector<std::shared_ptr<SASTNode>> m_linkedNodes;
+
+		void LinkField(SASTField& field, bool relink);
+
+		static bool IsFieldLinked(const SASTField& field);
+
 	public:
 		SASTLinker(std::vector<std::shared_ptr<SASTNode>>& localSASTTree, const std::unordered_map<std::string, std::shared_ptr<SASTNode>>& globalSASTMap);
 
-		void Link();
+		/// <summary>
+		/// Point the object fields of the local tree at their nodes in the global map, including the element, key and value types
+		/// of containers
+		/// </summary>
+		/// <param name="relink">Replace links that are already set, for a global map holding newer nodes</param>
+		void Link(bool relink = false);
+
+		/// <returns>The nodes the last Link took from the global map</returns>
+		const std::vector<std::shared_ptr<SASTNode>>& GetLinkedNodes() const noexcept;
+
+		/// <summary>
+		/// Check whether every object field of a tree (container types included) has its node, the ASTParser can only link types
+		/// defined in the same translation unit
+		/// </summary>
+		/// <param name="SASTTree">The tree to check</param>
+		/// <returns>True if nothing is left to link</returns>
+		static bool IsLinked(const std::vector<std::shared_ptr<SASTNode>>& SASTTree);
 	};
 }
 
@@ -6,21 +6,70 @@ namespace GenTools::GenSerialize
 		: m_localSASTTree(localSASTTree), m_globalSASTMap(globalSASTMap)
 	{}
 
-	void SASTLinker::Link()
+	void SASTLinker::Link(bool relink)
 	{
+		m_linkedNodes.clear();
+
 		for (auto& node : m_localSASTTree)
 		{
 			for (auto& field : node->fields)
 			{
-				if (field.type == SASTType::Object && !field.objectNode)
-				{
-					auto it = m_globalSASTMap.find(field.originalTypeName);
-					if (it != m_globalSASTMap.end())
-					{
-						field.objectNode = it->second;
-					}
-				}
+				LinkField(field, relink);
+			}
+		}
+	}
+
+	void SASTLinker::LinkField(SASTField& field, bool relink)
+	{
+		if ((field.type == SASTType::Object || field.type == SASTType::POD) && (!field.objectNode || relink))
+		{
+			// Fields parsed before the qualified name was recorded only have the spelled type name
+			const std::string& typeName = field.objectTypeName.empty() ? field.originalTypeName : field.objectTypeName;
+
+			auto it = m_globalSASTMap.find(typeName);
+			if (it != m_globalSASTMap.end() && it->second != field.objectNode)
+			{
+				field.objectNode = it->second;
+				m_linkedNodes.push_back(it->second);
+
+				field.type = field.objectNode->serializationPolicy == SASTNode::SerializationPolicy::POD ? SASTType::POD : SASTType::Object;
+			}
+		}
+
+		if (field.elementType)
+			LinkField(*field.elementType, relink);
+		if (field.keyType)
+			LinkField(*field.keyType, relink);
+		if (field.valueType)
+			LinkField(*field.valueType, relink);
+	}
+
+	const std::vector<std::shared_ptr<SASTNode>>& SASTLinker::GetLinkedNodes() const noexcept
+	{
+		return m_linkedNodes;
+	}
+
+	bool SASTLinker::IsFieldLinked(const SASTField& field)
+	{
+		if (field.type == SASTType::Object && !field.objectNode && !field.objectTypeName.empty())
+			return false;
+
+		return (!field.elementType || IsFieldLinked(*field.elementType)) &&
+			(!field.keyType || IsFieldLinked(*field.keyType)) &&
+			(!field.valueType || IsFieldLinked(*field.valueType));
+	}
+
+	bool SASTLinker::IsLinked(const std::vector<std::shared_ptr<SASTNode>>& SASTTree)
+	{
+		for (const auto& node : SASTTree)
+		{
+			for (const auto& field : node->fields)
+			{
+				if (!IsFieldLinked(field))
+					return false;
 			}
 		}
+
+		return true;
 	}
-}
\ No newline at end of file
+}
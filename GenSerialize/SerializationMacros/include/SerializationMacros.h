@@ -83,6 +83,22 @@
 #define DYNAMIC_ARRAY(lengthVar)
 #endif
 
+#ifdef __clang__
+// MACRO to give a serialized field a stable identifier. Formats supporting schema evolution use it instead of declaration order.
+#define SERIALIZE_ID(id) __attribute__((annotate("field_id:" #id)))
+#else
+// MACRO to give a serialized field a stable identifier. Formats supporting schema evolution use it instead of declaration order.
+#define SERIALIZE_ID(id)
+#endif
+
+#ifdef __clang__
+// MACRO to specify the value of a serialized field when it is absent from the serialized data.
+#define SERIALIZE_DEFAULT(...) __attribute__((annotate("field_default:" #__VA_ARGS__)))
+#else
+// MACRO to specify the value of a serialized field when it is absent from the serialized data.
+#define SERIALIZE_DEFAULT(...)
+#endif
+
 #ifdef __clang__
 // MACRO to mark a field for exclusion from serialization.
 #define SERIALIZE_EXCLUDE __attribute__((annotate("serialize:exclude")))
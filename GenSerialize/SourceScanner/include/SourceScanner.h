@@ -0,0 +1,44 @@
+#ifndef GENTOOLS_GENSERIALIZE_SOURCE_SCANNER_H
+#define GENTOOLS_GENSERIALIZE_SOURCE_SCANNER_H
+
+#include <string_view>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Fast byte level checks on source text, run before (or instead of) a Clang parse. The scans do not allocate
+	/// </summary>
+	class SourceScanner
+	{
+	public:
+		SourceScanner() = delete;
+
+		/// <summary>
+		/// Check a source for anything that can mark a type serializable: the SERIALIZABLE macros (or a macro whose name
+		/// contains SERIALIZABLE) and the raw "serializable" annotation. Types marked only through differently named macros are
+		/// not detected. Comments and strings are not skipped, a false positive only costs a parse
+		/// </summary>
+		/// <param name="source">The source text</param>
+		/// <returns>False only if no type in the source can be serializable</returns>
+		static bool ContainsSerializationMarkers(std::string_view source) noexcept;
+
+		/// <summary>
+		/// Check a source for an include of its generated header: #include followed by &lt;FileName.generated.h&gt; or
+		/// "FileName.generated.h", optionally behind a directory made of letters, digits, underscores and slashes
+		/// </summary>
+		/// <param name="source">The source text</param>
+		/// <param name="headerStem">File name of the source without its extension</param>
+		/// <returns>True if the generated header is included</returns>
+		static bool IncludesGeneratedHeader(std::string_view source, std::string_view headerStem) noexcept;
+
+		/// <summary>
+		/// Check a source for a GENERATED_SERIALIZATION_BODY() expansion (any macro ending in _SERIALIZATION_BODY), allowing
+		/// whitespace around the parentheses
+		/// </summary>
+		/// <param name="source">The source text</param>
+		/// <returns>True if the macro is used</returns>
+		static bool ContainsGeneratedBody(std::string_view source) noexcept;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_SOURCE_SCANNER_H
@@ -0,0 +1,105 @@
+#include <SourceScanner.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace GenTools::GenSerialize
+{
+	namespace
+	{
+		constexpr std::string_view MacroMarker = "SERIALIZABLE";
+		constexpr std::string_view AnnotationMarker = "\"serializable";
+
+		// Built once, the searchers only read their pattern when searching
+		const std::boyer_moore_horspool_searcher MacroSearcher(MacroMarker.begin(), MacroMarker.end());
+		const std::boyer_moore_horspool_searcher AnnotationSearcher(AnnotationMarker.begin(), AnnotationMarker.end());
+
+		constexpr std::string_view IncludeDirective = "#include";
+		constexpr std::string_view GeneratedHeaderSuffix = ".generated.h";
+		constexpr std::string_view BodyMarker = "_SERIALIZATION_BODY";
+
+		const std::boyer_moore_horspool_searcher IncludeSearcher(IncludeDirective.begin(), IncludeDirective.end());
+		const std::boyer_moore_horspool_searcher BodySearcher(BodyMarker.begin(), BodyMarker.end());
+
+		// Same set as the \s regex class
+		bool IsSpace(char c) noexcept
+		{
+			return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+		}
+
+		bool IsIncludeDirectoryChar(char c) noexcept
+		{
+			return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '/';
+		}
+
+		size_t SkipSpaces(std::string_view source, size_t position) noexcept
+		{
+			while (position < source.size() && IsSpace(source[position]))
+			{
+				position++;
+			}
+			return position;
+		}
+
+		// Whether the include starting right after an opening < or " names FileName.generated.h
+		bool NamesGeneratedHeader(std::string_view target, std::string_view headerStem) noexcept
+		{
+			size_t directoryEnd = 0;
+			while (directoryEnd < target.size() && IsIncludeDirectoryChar(target[directoryEnd]))
+			{
+				directoryEnd++;
+			}
+
+			// The directory may end in part of the stem, try every split of the run of directory characters
+			for (size_t stemStart = 0; stemStart <= directoryEnd; stemStart++)
+			{
+				std::string_view rest = target.substr(stemStart);
+				if (rest.size() > headerStem.size() + GeneratedHeaderSuffix.size() && rest.starts_with(headerStem) &&
+					rest.substr(headerStem.size(), GeneratedHeaderSuffix.size()) == GeneratedHeaderSuffix)
+				{
+					char close = rest[headerStem.size() + GeneratedHeaderSuffix.size()];
+					if (close == '>' || close == '"')
+						return true;
+				}
+			}
+			return false;
+		}
+	}
+
+	bool SourceScanner::ContainsSerializationMarkers(std::string_view source) noexcept
+	{
+		return std::search(source.begin(), source.end(), MacroSearcher) != source.end() ||
+			std::search(source.begin(), source.end(), AnnotationSearcher) != source.end();
+	}
+
+	bool SourceScanner::IncludesGeneratedHeader(std::string_view source, std::string_view headerStem) noexcept
+	{
+		for (auto it = std::search(source.begin(), source.end(), IncludeSearcher); it != source.end();
+			it = std::search(it + 1, source.end(), IncludeSearcher))
+		{
+			size_t position = SkipSpaces(source, static_cast<size_t>(it - source.begin()) + IncludeDirective.size());
+			if (position < source.size() && (source[position] == '<' || source[position] == '"') &&
+				NamesGeneratedHeader(source.substr(position + 1), headerStem))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool SourceScanner::ContainsGeneratedBody(std::string_view source) noexcept
+	{
+		for (auto it = std::search(source.begin(), source.end(), BodySearcher); it != source.end();
+			it = std::search(it + 1, source.end(), BodySearcher))
+		{
+			size_t position = SkipSpaces(source, static_cast<size_t>(it - source.begin()) + BodyMarker.size());
+			if (position < source.size() && source[position] == '(')
+			{
+				position = SkipSpaces(source, position + 1);
+				if (position < source.size() && source[position] == ')')
+					return true;
+			}
+		}
+		return false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+#ifndef GENTOOLS_GENSERIALIZE_BINARY_VIEW_H
+#define GENTOOLS_GENSERIALIZE_BINARY_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <span>
+#include <string>
+#include <string_view>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Magic number stored at the beginning of every BinaryView buffer ("GSBV")
+	/// </summary>
+	constexpr uint32_t BINARY_VIEW_MAGIC = 0x56425347;
+
+	/// <summary>
+	/// Version of the BinaryView buffer layout
+	/// </summary>
+	constexpr uint32_t BINARY_VIEW_VERSION = 1;
+
+	/// <summary>
+	/// Minimum alignment required of the start of a BinaryView buffer (heap allocations and memory mapped files satisfy this)
+	/// </summary>
+	constexpr size_t BINARY_VIEW_BUFFER_ALIGNMENT = 8;
+
+	/// <summary>
+	/// Reference to out of line data in a BinaryView buffer. Offsets are absolute from the start of the buffer
+	/// </summary>
+	struct BinaryViewRef
+	{
+		uint64_t offset;
+		uint64_t count;
+	};
+
+	/// <summary>
+	/// Bounds of a BinaryView buffer. Views carry them so every offset and length read from the buffer is range checked, a
+	/// truncated or corrupt file reads as absent fields instead of past the end of the buffer
+	/// </summary>
+	struct BinaryViewBuffer
+	{
+		const std::byte* data = nullptr;
+		uint64_t size = 0;
+
+		/// <returns>True if the length bytes at offset lie inside the buffer</returns>
+		constexpr bool Contains(uint64_t offset, uint64_t length) const noexcept
+		{
+			return offset <= size && length <= size - offset;
+		}
+	};
+
+	/// <summary>
+	/// Header written at the start of every BinaryView buffer
+	/// </summary>
+	struct BinaryViewHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint64_t rootOffset;
+	};
+
+	/// <summary>
+	/// Round an offset up to the next multiple of alignment
+	/// </summary>
+	constexpr uint64_t BinaryViewAlign(uint64_t offset, uint64_t alignment) noexcept
+	{
+		return (offset + alignment - 1) & ~(alignment - 1);
+	}
+
+	/// <summary>
+	/// Size of the field table at the start of a record. The table holds the number of entries followed by one 32 bit slot offset
+	/// per field id (0 when the field is absent), so readers find fields by id in constant time and never visit fields they do not know
+	/// </summary>
+	constexpr uint64_t BinaryViewFieldTableSize(uint32_t idCount) noexcept
+	{
+		return BinaryViewAlign(sizeof(uint32_t) * (uint64_t(idCount) + 1), alignof(uint64_t));
+	}
+
+	template<typename T>
+	concept BinaryViewTrivial = std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>;
+
+	/// <summary>
+	/// Builds an aligned BinaryView buffer. Generated BinaryViewWrite functions reserve a fixed size record per object and
+	/// append variable length data (strings, arrays, nested records) behind it
+	/// </summary>
+	class BinaryViewWriter
+	{
+	private:
+		std::vector<std::byte> m_buffer;
+
+	public:
+		BinaryViewWriter();
+		BinaryViewWriter(BinaryViewWriter&&) noexcept = default;
+
+		BinaryViewWriter& operator=(BinaryViewWriter&&) noexcept = default;
+
+		/// <summary>
+		/// Reserve a zero filled block in the buffer
+		/// </summary>
+		/// <param name="size">Size of the block in bytes</param>
+		/// <param name="alignment">Required alignment of the block, must be a power of two</param>
+		/// <returns>Offset of the block from the start of the buffer</returns>
+		uint64_t Allocate(uint64_t size, uint64_t alignment);
+
+		/// <summary>
+		/// Reserve a record and initialize its field table with every field absent
+		/// </summary>
+		/// <param name="idCount">Number of entries in the field table (highest field id + 1)</param>
+		/// <param name="recordSize">Size of the record in bytes, including the field table</param>
+		/// <returns>Offset of the record from the start of the buffer</returns>
+		uint64_t BeginRecord(uint32_t idCount, uint64_t recordSize);
+
+		template<BinaryViewTrivial T>
+		void Store(uint64_t offset, const T& value) noexcept;
+
+		/// <summary>
+		/// Store a field into its record slot and mark it present in the field table
+		/// </summary>
+		template<BinaryViewTrivial T>
+		void StoreField(uint64_t record, uint32_t id, uint64_t slot, const T& value) noexcept;
+
+		template<BinaryViewTrivial T>
+		BinaryViewRef WriteArray(const T* data, uint64_t count);
+
+		BinaryViewRef WriteString(std::string_view str);
+
+		template<typename Container>
+		BinaryViewRef WriteStringList(const Container& strings);
+
+		/// <summary>
+		/// Write the buffer header, marking the record at rootOffset as the root object
+		/// </summary>
+		void Finish(uint64_t rootOffset) noexcept;
+
+		const std::vector<std::byte>& GetBuffer() const noexcept;
+		std::vector<std::byte> TakeBuffer() noexcept;
+
+		BinaryViewWriter(const BinaryViewWriter&) = delete;
+		BinaryViewWriter& operator=(const BinaryViewWriter&) = delete;
+	};
+
+	/// <summary>
+	/// Validate the header of a BinaryView buffer
+	/// </summary>
+	/// <returns>Offset of the root record</returns>
+	uint64_t BinaryViewOpenRoot(const std::byte* data, size_t size);
+
+	/// <summary>
+	/// Find the slot of a field in a record
+	/// </summary>
+	/// <returns>Offset of the slot from the start of the record, 0 if the field is absent (older data, no record, or a field table
+	/// outside of the buffer)</returns>
+	uint64_t BinaryViewFieldOffset(BinaryViewBuffer buffer, uint64_t record, uint32_t id) noexcept;
+
+	/// <returns>The value at offset, a value initialized T if it does not fit in the buffer</returns>
+	template<BinaryViewTrivial T>
+	T BinaryViewLoad(BinaryViewBuffer buffer, uint64_t offset) noexcept;
+
+	/// <returns>The string referenced from the slot, empty if it does not fit in the buffer</returns>
+	std::string_view BinaryViewLoadString(BinaryViewBuffer buffer, uint64_t slotOffset) noexcept;
+
+	/// <returns>The array referenced from the slot, empty if it does not fit in the buffer or is misaligned</returns>
+	template<BinaryViewTrivial T>
+	std::span<const T> BinaryViewLoadSpan(BinaryViewBuffer buffer, uint64_t slotOffset) noexcept;
+
+	/// <summary>
+	/// Read only view over a list of strings stored in a BinaryView buffer
+	/// </summary>
+	class BinaryViewStringList
+	{
+	private:
+		BinaryViewBuffer m_buffer;
+		BinaryViewRef m_ref{ 0, 0 };
+
+	public:
+		BinaryViewStringList() = default;
+		BinaryViewStringList(BinaryViewBuffer buffer, uint64_t slotOffset) noexcept;
+
+		size_t size() const noexcept;
+		bool empty() const noexcept;
+		std::string_view operator[](size_t index) const noexcept;
+	};
+
+	/// <summary>
+	/// Read only view over a list of nested records stored in a BinaryView buffer
+	/// </summary>
+	/// <typeparam name="View">The generated view type of the element</typeparam>
+	template<typename View>
+	class BinaryViewList
+	{
+	private:
+		BinaryViewBuffer m_buffer;
+		BinaryViewRef m_ref{ 0, 0 };
+
+	public:
+		BinaryViewList() = default;
+		BinaryViewList(BinaryViewBuffer buffer, uint64_t slotOffset) noexcept;
+
+		size_t size() const noexcept;
+		bool empty() const noexcept;
+		View operator[](size_t index) const noexcept;
+	};
+}
+
+#include <BinaryView.inl>
+
+#endif // !GENTOOLS_GENSERIALIZE_BINARY_VIEW_H
@@ -0,0 +1,225 @@
+#ifndef GENTOOLS_GENSERIALIZE_BINARY_VIEW_INL
+#define GENTOOLS_GENSERIALIZE_BINARY_VIEW_INL
+
+#if defined(__GNUC__) or defined(__clang__)
+#define FORCE_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define FORCE_INLINE __forceinline
+#else
+#define FORCE_INLINE inline
+#endif
+
+namespace GenTools::GenSerialize
+{
+	// BinaryViewWriter
+	//**********************************************************************************************
+	inline BinaryViewWriter::BinaryViewWriter()
+	{
+		m_buffer.resize(sizeof(BinaryViewHeader));
+	}
+
+	FORCE_INLINE uint64_t BinaryViewWriter::Allocate(uint64_t size, uint64_t alignment)
+	{
+		uint64_t offset = BinaryViewAlign(m_buffer.size(), alignment);
+		m_buffer.resize(offset + size);
+		return offset;
+	}
+
+	FORCE_INLINE uint64_t BinaryViewWriter::BeginRecord(uint32_t idCount, uint64_t recordSize)
+	{
+		uint64_t record = Allocate(recordSize, alignof(uint64_t));
+		Store(record, idCount);
+		return record;
+	}
+
+	template<BinaryViewTrivial T>
+	FORCE_INLINE void BinaryViewWriter::Store(uint64_t offset, const T& value) noexcept
+	{
+		std::memcpy(m_buffer.data() + offset, &value, sizeof(T));
+	}
+
+	template<BinaryViewTrivial T>
+	FORCE_INLINE void BinaryViewWriter::StoreField(uint64_t record, uint32_t id, uint64_t slot, const T& value) noexcept
+	{
+		Store(record + slot, value);
+		Store(record + sizeof(uint32_t) * (uint64_t(id) + 1), static_cast<uint32_t>(slot));
+	}
+
+	template<BinaryViewTrivial T>
+	FORCE_INLINE BinaryViewRef BinaryViewWriter::WriteArray(const T* data, uint64_t count)
+	{
+		if (count == 0)
+			return BinaryViewRef{ 0, 0 };
+
+		uint64_t offset = Allocate(sizeof(T) * count, alignof(T));
+		std::memcpy(m_buffer.data() + offset, data, sizeof(T) * count);
+		return BinaryViewRef{ offset, count };
+	}
+
+	FORCE_INLINE BinaryViewRef BinaryViewWriter::WriteString(std::string_view str)
+	{
+		return WriteArray(str.data(), str.size());
+	}
+
+	template<typename Container>
+	inline BinaryViewRef BinaryViewWriter::WriteStringList(const Container& strings)
+	{
+		uint64_t count = static_cast<uint64_t>(std::size(strings));
+		if (count == 0)
+			return BinaryViewRef{ 0, 0 };
+
+		uint64_t offset = Allocate(sizeof(BinaryViewRef) * count, alignof(BinaryViewRef));
+		uint64_t slot = offset;
+		for (const auto& str : strings)
+		{
+			Store(slot, WriteString(std::string_view(str)));
+			slot += sizeof(BinaryViewRef);
+		}
+		return BinaryViewRef{ offset, count };
+	}
+
+	FORCE_INLINE void BinaryViewWriter::Finish(uint64_t rootOffset) noexcept
+	{
+		Store(0, BinaryViewHeader{ BINARY_VIEW_MAGIC, BINARY_VIEW_VERSION, rootOffset });
+	}
+
+	FORCE_INLINE const std::vector<std::byte>& BinaryViewWriter::GetBuffer() const noexcept
+	{
+		return m_buffer;
+	}
+
+	FORCE_INLINE std::vector<std::byte> BinaryViewWriter::TakeBuffer() noexcept
+	{
+		return std::move(m_buffer);
+	}
+	//**********************************************************************************************
+
+	// Load helpers
+	//**********************************************************************************************
+	inline uint64_t BinaryViewOpenRoot(const std::byte* data, size_t size)
+	{
+		if (data == nullptr || size < sizeof(BinaryViewHeader))
+			throw std::runtime_error("BinaryView buffer is too small to contain a header");
+
+		if (reinterpret_cast<uintptr_t>(data) % BINARY_VIEW_BUFFER_ALIGNMENT != 0)
+			throw std::invalid_argument("BinaryView buffer is not aligned to " + std::to_string(BINARY_VIEW_BUFFER_ALIGNMENT) + " bytes");
+
+		BinaryViewHeader header;
+		std::memcpy(&header, data, sizeof(BinaryViewHeader));
+
+		if (header.magic != BINARY_VIEW_MAGIC)
+			throw std::runtime_error("Buffer is not a BinaryView buffer (bad magic number)");
+
+		if (header.version != BINARY_VIEW_VERSION)
+			throw std::runtime_error("Unsupported BinaryView version " + std::to_string(header.version));
+
+		if (header.rootOffset < sizeof(BinaryViewHeader) || header.rootOffset >= size)
+			throw std::runtime_error("BinaryView root offset is outside of the buffer");
+
+		return header.rootOffset;
+	}
+
+	FORCE_INLINE uint64_t BinaryViewFieldOffset(BinaryViewBuffer buffer, uint64_t record, uint32_t id) noexcept
+	{
+		if (buffer.data == nullptr || !buffer.Contains(record, sizeof(uint32_t)))
+			return 0;
+
+		// Ids past the end of the table belong to fields added after the data was written
+		if (id >= BinaryViewLoad<uint32_t>(buffer, record))
+			return 0;
+
+		return BinaryViewLoad<uint32_t>(buffer, record + sizeof(uint32_t) * (uint64_t(id) + 1));
+	}
+
+	template<BinaryViewTrivial T>
+	FORCE_INLINE T BinaryViewLoad(BinaryViewBuffer buffer, uint64_t offset) noexcept
+	{
+		T value{};
+		if (buffer.Contains(offset, sizeof(T)))
+			std::memcpy(&value, buffer.data + offset, sizeof(T));
+		return value;
+	}
+
+	FORCE_INLINE std::string_view BinaryViewLoadString(BinaryViewBuffer buffer, uint64_t slotOffset) noexcept
+	{
+		BinaryViewRef ref = BinaryViewLoad<BinaryViewRef>(buffer, slotOffset);
+		if (ref.count == 0 || !buffer.Contains(ref.offset, ref.count))
+			return std::string_view();
+
+		return std::string_view(reinterpret_cast<const char*>(buffer.data + ref.offset), static_cast<size_t>(ref.count));
+	}
+
+	template<BinaryViewTrivial T>
+	FORCE_INLINE std::span<const T> BinaryViewLoadSpan(BinaryViewBuffer buffer, uint64_t slotOffset) noexcept
+	{
+		BinaryViewRef ref = BinaryViewLoad<BinaryViewRef>(buffer, slotOffset);
+		if (ref.count == 0 || ref.count > buffer.size / sizeof(T) || !buffer.Contains(ref.offset, ref.count * sizeof(T)))
+			return std::span<const T>();
+
+		// Arrays are written aligned to alignof(T) relative to an aligned buffer start
+		if (ref.offset % alignof(T) != 0)
+			return std::span<const T>();
+
+		return std::span<const T>(reinterpret_cast<const T*>(buffer.data + ref.offset), static_cast<size_t>(ref.count));
+	}
+	//**********************************************************************************************
+
+	// BinaryViewStringList
+	//**********************************************************************************************
+	FORCE_INLINE BinaryViewStringList::BinaryViewStringList(BinaryViewBuffer buffer, uint64_t slotOffset) noexcept
+		: m_buffer(buffer), m_ref(BinaryViewLoad<BinaryViewRef>(buffer, slotOffset))
+	{
+		// A list that does not fit in the buffer is empty, the strings it references are checked as they are loaded
+		if (m_ref.count > buffer.size / sizeof(BinaryViewRef) || !buffer.Contains(m_ref.offset, m_ref.count * sizeof(BinaryViewRef)))
+			m_ref = BinaryViewRef{ 0, 0 };
+	}
+
+	FORCE_INLINE size_t BinaryViewStringList::size() const noexcept
+	{
+		return static_cast<size_t>(m_ref.count);
+	}
+
+	FORCE_INLINE bool BinaryViewStringList::empty() const noexcept
+	{
+		return m_ref.count == 0;
+	}
+
+	FORCE_INLINE std::string_view BinaryViewStringList::operator[](size_t index) const noexcept
+	{
+		return BinaryViewLoadString(m_buffer, m_ref.offset + index * sizeof(BinaryViewRef));
+	}
+	//**********************************************************************************************
+
+	// BinaryViewList
+	//**********************************************************************************************
+	template<typename View>
+	FORCE_INLINE BinaryViewList<View>::BinaryViewList(BinaryViewBuffer buffer, uint64_t slotOffset) noexcept
+		: m_buffer(buffer), m_ref(BinaryViewLoad<BinaryViewRef>(buffer, slotOffset))
+	{
+		// The records the list references are checked as they are read
+		if (m_ref.count > buffer.size / sizeof(uint64_t) || !buffer.Contains(m_ref.offset, m_ref.count * sizeof(uint64_t)))
+			m_ref = BinaryViewRef{ 0, 0 };
+	}
+
+	template<typename View>
+	FORCE_INLINE size_t BinaryViewList<View>::size() const noexcept
+	{
+		return static_cast<size_t>(m_ref.count);
+	}
+
+	template<typename View>
+	FORCE_INLINE bool BinaryViewList<View>::empty() const noexcept
+	{
+		return m_ref.count == 0;
+	}
+
+	template<typename View>
+	FORCE_INLINE View BinaryViewList<View>::operator[](size_t index) const noexcept
+	{
+		// Each element of the list is the offset of a nested record
+		return View(m_buffer, BinaryViewLoad<uint64_t>(m_buffer, m_ref.offset + index * sizeof(uint64_t)));
+	}
+	//**********************************************************************************************
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_BINARY_VIEW_INL
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <BinaryView.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+
+TEST(BinaryViewTests, WriteAndLoadScalars)
+{
+	BinaryViewWriter writer;
+	uint64_t record = writer.Allocate(16, 8);
+	writer.Store<int32_t>(record, -7);
+	writer.Store<double>(record + 8, 2.5);
+	writer.Finish(record);
+
+	std::vector<std::byte> buffer = writer.TakeBuffer();
+	uint64_t root = BinaryViewOpenRoot(buffer.data(), buffer.size());
+
+	BinaryViewBuffer view{ buffer.data(), buffer.size() };
+
+	EXPECT_EQ(root, record);
+	EXPECT_EQ(BinaryViewLoad<int32_t>(view, root), -7);
+	EXPECT_EQ(BinaryViewLoad<double>(view, root + 8), 2.5);
+}
+
+TEST(BinaryViewTests, StringsAndArraysAreViewedInPlace)
+{
+	BinaryViewWriter writer;
+	uint64_t record = writer.Allocate(sizeof(BinaryViewRef) * 3, alignof(BinaryViewRef));
+
+	std::vector<float> values = { 1.0f, 2.0f, 3.0f };
+	std::vector<std::string> names = { "first", "", "third" };
+
+	writer.Store(record, writer.WriteString("hello"));
+	writer.Store(record + sizeof(BinaryViewRef), writer.WriteArray(values.data(), values.size()));
+	writer.Store(record + sizeof(BinaryViewRef) * 2, writer.WriteStringList(names));
+	writer.Finish(record);
+
+	const std::vector<std::byte>& buffer = writer.GetBuffer();
+	uint64_t root = BinaryViewOpenRoot(buffer.data(), buffer.size());
+	BinaryViewBuffer view{ buffer.data(), buffer.size() };
+
+	std::string_view str = BinaryViewLoadString(view, root);
+	EXPECT_EQ(str, "hello");
+	EXPECT_GE(reinterpret_cast<const std::byte*>(str.data()), buffer.data());
+	EXPECT_LT(reinterpret_cast<const std::byte*>(str.data()), buffer.data() + buffer.size());
+
+	std::span<const float> span = BinaryViewLoadSpan<float>(view, root + sizeof(BinaryViewRef));
+	ASSERT_EQ(span.size(), 3u);
+	EXPECT_EQ(span[2], 3.0f);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(span.data()) % alignof(float), 0u);
+
+	BinaryViewStringList list(view, root + sizeof(BinaryViewRef) * 2);
+	ASSERT_EQ(list.size(), 3u);
+	EXPECT_EQ(list[0], "first");
+	EXPECT_TRUE(list[1].empty());
+	EXPECT_EQ(list[2], "third");
+}
+
+TEST(BinaryViewTests, EmptyArraysProduceEmptyViews)
+{
+	BinaryViewWriter writer;
+	uint64_t record = writer.Allocate(sizeof(BinaryViewRef), alignof(BinaryViewRef));
+	writer.Store(record, writer.WriteArray<int>(nullptr, 0));
+	writer.Finish(record);
+
+	const std::vector<std::byte>& buffer = writer.GetBuffer();
+	BinaryViewBuffer view{ buffer.data(), buffer.size() };
+	EXPECT_TRUE(BinaryViewLoadSpan<int>(view, record).empty());
+	EXPECT_TRUE(BinaryViewLoadString(view, record).empty());
+}
+
+TEST(BinaryViewTests, OpenRejectsInvalidBuffers)
+{
+	BinaryViewWriter writer;
+	uint64_t record = writer.Allocate(8, 8);
+	writer.Finish(record);
+	std::vector<std::byte> buffer = writer.TakeBuffer();
+
+	EXPECT_THROW(BinaryViewOpenRoot(buffer.data(), sizeof(BinaryViewHeader) - 1), std::runtime_error);
+	EXPECT_THROW(BinaryViewOpenRoot(buffer.data(), sizeof(BinaryViewHeader)), std::runtime_error);
+
+	std::vector<std::byte> badMagic = buffer;
+	badMagic[0] = std::byte{ 0 };
+	EXPECT_THROW(BinaryViewOpenRoot(badMagic.data(), badMagic.size()), std::runtime_error);
+
+	std::vector<std::byte> badVersion = buffer;
+	badVersion[4] = std::byte{ 0xFF };
+	EXPECT_THROW(BinaryViewOpenRoot(badVersion.data(), badVersion.size()), std::runtime_error);
+
+	EXPECT_NO_THROW(BinaryViewOpenRoot(buffer.data(), buffer.size()));
+}
+
+TEST(BinaryViewTests, FieldTableReportsAbsentAndUnknownFields)
+{
+	BinaryViewWriter writer;
+	const uint64_t slot = BinaryViewFieldTableSize(3);
+	uint64_t record = writer.BeginRecord(3, slot + sizeof(int32_t));
+	writer.StoreField<int32_t>(record, 2, slot, 42);
+	writer.Finish(record);
+
+	const std::vector<std::byte>& buffer = writer.GetBuffer();
+	BinaryViewBuffer view{ buffer.data(), buffer.size() };
+	EXPECT_EQ(BinaryViewFieldOffset(view, record, 2), slot);
+	EXPECT_EQ(BinaryViewLoad<int32_t>(view, record + slot), 42);
+
+	// Id 0 was never stored, id 7 is newer than the data
+	EXPECT_EQ(BinaryViewFieldOffset(view, record, 0), 0u);
+	EXPECT_EQ(BinaryViewFieldOffset(view, record, 7), 0u);
+	EXPECT_EQ(BinaryViewFieldOffset(BinaryViewBuffer{}, 0, 2), 0u);
+}
+
+TEST(BinaryViewTests, TruncatedBuffersReadAsAbsent)
+{
+	BinaryViewWriter writer;
+	const uint64_t intSlot = BinaryViewFieldTableSize(3);
+	const uint64_t stringSlot = BinaryViewAlign(intSlot + sizeof(int32_t), alignof(BinaryViewRef));
+	const uint64_t listSlot = stringSlot + sizeof(BinaryViewRef);
+	uint64_t record = writer.BeginRecord(3, listSlot + sizeof(BinaryViewRef));
+	writer.StoreField<int32_t>(record, 0, intSlot, 42);
+	writer.StoreField(record, 1, stringSlot, writer.WriteString("a string stored behind the record"));
+	std::vector<std::string> names = { "first", "second" };
+	writer.StoreField(record, 2, listSlot, writer.WriteStringList(names));
+	writer.Finish(record);
+
+	const std::vector<std::byte>& buffer = writer.GetBuffer();
+
+	// The record fits, the out of line data it references is cut off
+	BinaryViewBuffer truncated{ buffer.data(), record + listSlot + sizeof(BinaryViewRef) };
+	ASSERT_EQ(BinaryViewOpenRoot(buffer.data(), truncated.size), record);
+	EXPECT_EQ(BinaryViewLoad<int32_t>(truncated, record + BinaryViewFieldOffset(truncated, record, 0)), 42);
+	EXPECT_TRUE(BinaryViewLoadString(truncated, record + BinaryViewFieldOffset(truncated, record, 1)).empty());
+	EXPECT_TRUE(BinaryViewStringList(truncated, record + BinaryViewFieldOffset(truncated, record, 2)).empty());
+
+	// The field table itself is cut off
+	BinaryViewBuffer tableCut{ buffer.data(), record + sizeof(uint32_t) * 2 };
+	EXPECT_EQ(BinaryViewFieldOffset(tableCut, record, 0), intSlot);
+	EXPECT_EQ(BinaryViewFieldOffset(tableCut, record, 2), 0u);
+	EXPECT_EQ(BinaryViewLoad<int32_t>(tableCut, record + intSlot), 0);
+
+	// A corrupt reference whose length runs past the end of the buffer
+	std::vector<std::byte> corrupt = buffer;
+	BinaryViewRef huge{ sizeof(BinaryViewHeader), UINT64_MAX / 2 };
+	std::memcpy(corrupt.data() + record + stringSlot, &huge, sizeof(huge));
+	BinaryViewBuffer corruptView{ corrupt.data(), corrupt.size() };
+	EXPECT_TRUE(BinaryViewLoadString(corruptView, record + stringSlot).empty());
+	EXPECT_TRUE(BinaryViewLoadSpan<uint64_t>(corruptView, record + stringSlot).empty());
+}
@@ -0,0 +1,66 @@
+#ifndef GENTOOLS_GENSERIALIZE_BINARY_VIEW_FORMAT_PLUGIN_H
+#define GENTOOLS_GENSERIALIZE_BINARY_VIEW_FORMAT_PLUGIN_H
+
+#include <IFormatPlugin.h>
+#include <FileFormatRegistry.h>
+
+#include <string>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Format plugin producing a flat, aligned binary layout that can be read in place. Every serialized object is a fixed size record
+	/// of slots, variable length data is referenced by offset. Generated code exposes a nested BinaryView class whose accessors read
+	/// directly from the buffer (scalars by value, strings as std::string_view, trivially copyable arrays as std::span) so no
+	/// deserialization pass or allocation is needed to consume the data. Types using the format must include BinaryView.h
+	/// </summary>
+	class FORMAT_PLUGIN_ABI BinaryViewFormatPlugin : public IFormatPlugin
+	{
+	protected:
+		/// <summary>
+		/// Get the type stored in the fixed size record slot for a field
+		/// </summary>
+		/// <param name="field">The field to get the slot type for</param>
+		/// <returns>The fully qualified type name of the slot</returns>
+		virtual std::string GetSlotType(const SASTField& field);
+
+		/// <summary>
+		/// Helper for generating the accessor of the view class for a given field
+		/// </summary>
+		/// <param name="field">The field to generate the accessor for</param>
+		/// <param name="depth">Indentation level of the generated code</param>
+		/// <returns>The accessor member function definition</returns>
+		virtual std::string GenerateFieldAccessorCode(const SASTField& field, size_t depth = 2);
+
+		/// <summary>
+		/// Helper for generating the code writing a given field into its record slot
+		/// </summary>
+		/// <param name="field">The field in the source object to generate the write logic for</param>
+		/// <param name="objSource">The literal text to access the source object</param>
+		/// <param name="depth">Indentation level of the generated code</param>
+		/// <returns>The write logic for the field entered</returns>
+		virtual std::string GenerateFieldWriteCode(const SASTField& field, const std::string& objSource, size_t depth = 1);
+
+	public:
+		/// <summary>
+		/// Generate serialization code for the given SAST node
+		/// </summary>
+		/// <param name="sastNode">The SAST node to generate code for</param>
+		/// <returns>The generated code</returns>
+		std::string FORMAT_PLUGIN_CALL GenerateCode(const std::shared_ptr<SASTNode> sastNode) override;
+
+		/// <summary>
+		/// Get the name of the format (for instance JSON)
+		/// </summary>
+		/// <returns>Name of the format this plugin hangles</returns>
+		std::string FORMAT_PLUGIN_CALL GetFormatName() const noexcept override;
+
+		/// <summary>
+		/// Get the priority level assigned to the plugin. Higher priorities can override lower priority plugins with the same format name
+		/// </summary>
+		/// <returns>Priority level (default = 0)</returns>
+		virtual uint8_t FORMAT_PLUGIN_CALL GetPluginPriority() const noexcept override;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_BINARY_VIEW_FORMAT_PLUGIN_H
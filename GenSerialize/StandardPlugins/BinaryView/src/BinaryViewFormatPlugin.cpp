@@ -0,0 +1,440 @@
+#include <BinaryViewFormatPlugin.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+namespace GenTools::GenSerialize
+{
+	DECLARE_FORMAT_PLUGIN(BinaryViewFormatPlugin)
+	DECLARE_FORMAT_PLUGIN_MANIFEST(0, PLUGIN_CAPABILITY_THREAD_SAFE, "BinaryView")
+	REGISTER_STATIC_PLUGIN(BinaryViewFormatPlugin, 0);
+
+	namespace
+	{
+		const std::string RUNTIME_NAMESPACE = "GenTools::GenSerialize::";
+
+		// How the elements of a container field are laid out in the buffer
+		enum class ElementLayout
+		{
+			Trivial,	// Contiguous array of trivially copyable elements, viewed as a std::span
+			String,		// Array of BinaryViewRef, viewed as a BinaryViewStringList
+			Object		// Array of nested record offsets, viewed as a BinaryViewList
+		};
+
+		std::string IndentOf(size_t depth)
+		{
+			return std::string(depth, '\t');
+		}
+
+		std::string GetObjectViewType(const SASTField& field)
+		{
+			if (!field.objectNode)
+				throw std::runtime_error("BinaryView: Object field '" + field.name + "' has no resolved type (" + field.originalTypeName + ")");
+
+			const auto& formats = field.objectNode->formats;
+			if (std::find(formats.begin(), formats.end(), "BinaryView") == formats.end())
+				throw std::runtime_error("BinaryView: Nested type " + field.objectNode->name + " must also be marked SERIALIZABLE(BinaryView)");
+
+			return field.objectNode->name + "::BinaryView";
+		}
+
+		/// <summary>
+		/// Get the innermost element of a container field. Nested static arrays are flattened into a single contiguous run of elements
+		/// </summary>
+		const SASTField& GetInnermostElement(const SASTField& field, size_t& nesting)
+		{
+			if (!field.elementType)
+				throw std::runtime_error("BinaryView: Container field '" + field.name + "' has no element type (" + field.originalTypeName + ")");
+
+			nesting = 1;
+			const SASTField* element = field.elementType.get();
+			while (field.type == SASTType::Array && element->type == SASTType::Array && element->elementType)
+			{
+				element = element->elementType.get();
+				++nesting;
+			}
+
+			return *element;
+		}
+
+		ElementLayout GetElementLayout(const SASTField& field, const SASTField& element, size_t nesting)
+		{
+			switch (element.type)
+			{
+			case SASTType::Int:
+			case SASTType::Float:
+			case SASTType::POD:
+				return ElementLayout::Trivial;
+
+			case SASTType::Bool:
+				// std::vector<bool> is bit packed and has no contiguous storage to view
+				if (field.type == SASTType::Vector)
+					throw std::runtime_error("BinaryView: std::vector<bool> is not supported, field '" + field.name + "'");
+				return ElementLayout::Trivial;
+
+			case SASTType::String:
+				if (nesting > 1)
+					break;
+				return ElementLayout::String;
+
+			case SASTType::Object:
+				if (nesting > 1)
+					break;
+				return ElementLayout::Object;
+
+			default:
+				break;
+			}
+
+			throw std::runtime_error("BinaryView: Unsupported element type " + element.originalTypeName + " in field '" + field.name + "' (" + field.originalTypeName + ")");
+		}
+
+		/// <summary>
+		/// Resolve the field table id of every field. Types either give every field a stable SERIALIZE_ID, or none, in which case
+		/// declaration order is used (and appending fields is the only compatible change)
+		/// </summary>
+		std::vector<uint32_t> AssignFieldIds(const std::string& typeName, const std::vector<const SASTField*>& fields)
+		{
+			constexpr uint32_t MAX_FIELD_ID = 0xFFFF;
+
+			size_t explicitIds = std::count_if(fields.begin(), fields.end(), [](const SASTField* field) { return field->fieldId.has_value(); });
+			if (explicitIds != 0 && explicitIds != fields.size())
+				throw std::runtime_error("BinaryView: Either all or none of the serialized fields of " + typeName + " (including inherited fields) must have a SERIALIZE_ID");
+
+			std::vector<uint32_t> ids;
+			ids.reserve(fields.size());
+			for (size_t i = 0; i < fields.size(); ++i)
+			{
+				uint32_t id = explicitIds != 0 ? fields[i]->fieldId.value() : static_cast<uint32_t>(i);
+				if (id > MAX_FIELD_ID)
+					throw std::runtime_error("BinaryView: SERIALIZE_ID of field '" + fields[i]->name + "' exceeds the maximum of " + std::to_string(MAX_FIELD_ID));
+
+				if (std::find(ids.begin(), ids.end(), id) != ids.end())
+					throw std::runtime_error("BinaryView: Field '" + fields[i]->name + "' of " + typeName + " reuses SERIALIZE_ID " + std::to_string(id));
+
+				ids.push_back(id);
+			}
+
+			return ids;
+		}
+	}
+
+	std::string BinaryViewFormatPlugin::GetSlotType(const SASTField& field)
+	{
+		switch (field.type)
+		{
+		case SASTType::Int:
+		case SASTType::Float:
+		case SASTType::Bool:
+		case SASTType::POD:
+			return field.originalTypeName;
+
+		case SASTType::String:
+		case SASTType::Array:
+		case SASTType::Dynamic_Array:
+		case SASTType::Vector:
+			return RUNTIME_NAMESPACE + "BinaryViewRef";
+
+		case SASTType::Object:
+			return "uint64_t";
+
+		default:
+			throw std::runtime_error("BinaryView: Unsupported field type for '" + field.name + "' (" + field.originalTypeName + "). Sets and maps have no in place layout");
+		}
+	}
+
+	std::string BinaryViewFormatPlugin::GenerateFieldAccessorCode(const SASTField& field, size_t depth)
+	{
+		std::string returnType;
+		std::string presentExpr;
+		std::string absentExpr;
+		bool supportsDefault = false;
+
+		switch (field.type)
+		{
+		case SASTType::Int:
+		case SASTType::Float:
+		case SASTType::Bool:
+			returnType = field.originalTypeName;
+			presentExpr = RUNTIME_NAMESPACE + "BinaryViewLoad<" + returnType + ">(m_buffer, m_record + slot)";
+			// Brace initialized like the POD defaults, so a default of several arguments is not a comma expression. type_identity_t
+			// keeps type names of several words such as "unsigned int" valid in the expression
+			absentExpr = field.defaultValue.empty() ? returnType + "{}" : "std::type_identity_t<" + returnType + ">{ " + field.defaultValue + " }";
+			supportsDefault = true;
+			break;
+
+		case SASTType::POD:
+			returnType = field.originalTypeName;
+			presentExpr = RUNTIME_NAMESPACE + "BinaryViewLoad<" + returnType + ">(m_buffer, m_record + slot)";
+			if (field.defaultValue.empty())
+				absentExpr = returnType + "{}";
+			else if (field.defaultValue.front() == '{')
+				absentExpr = returnType + field.defaultValue;
+			else
+				absentExpr = returnType + "{ " + field.defaultValue + " }";
+			supportsDefault = true;
+			break;
+
+		case SASTType::String:
+			returnType = "std::string_view";
+			presentExpr = RUNTIME_NAMESPACE + "BinaryViewLoadString(m_buffer, m_record + slot)";
+			absentExpr = "std::string_view(" + field.defaultValue + ")";
+			supportsDefault = true;
+			break;
+
+		case SASTType::Object:
+			returnType = GetObjectViewType(field);
+			presentExpr = returnType + "(m_buffer, " + RUNTIME_NAMESPACE + "BinaryViewLoad<uint64_t>(m_buffer, m_record + slot))";
+			break;
+
+		case SASTType::Array:
+		case SASTType::Dynamic_Array:
+		case SASTType::Vector:
+		{
+			size_t nesting = 0;
+			const SASTField& element = GetInnermostElement(field, nesting);
+
+			switch (GetElementLayout(field, element, nesting))
+			{
+			case ElementLayout::Trivial:
+				returnType = "std::span<const " + element.originalTypeName + ">";
+				presentExpr = RUNTIME_NAMESPACE + "BinaryViewLoadSpan<" + element.originalTypeName + ">(m_buffer, m_record + slot)";
+				break;
+
+			case ElementLayout::String:
+				returnType = RUNTIME_NAMESPACE + "BinaryViewStringList";
+				presentExpr = returnType + "(m_buffer, m_record + slot)";
+				break;
+
+			case ElementLayout::Object:
+				returnType = RUNTIME_NAMESPACE + "BinaryViewList<" + GetObjectViewType(element) + ">";
+				presentExpr = returnType + "(m_buffer, m_record + slot)";
+				break;
+			}
+			break;
+		}
+		default:
+			throw std::runtime_error("BinaryView: Unsupported field type for '" + field.name + "' (" + field.originalTypeName + ")");
+		}
+
+		if (!supportsDefault)
+		{
+			if (!field.defaultValue.empty())
+				throw std::runtime_error("BinaryView: SERIALIZE_DEFAULT is only supported on scalar, string and POD fields, field '" + field.name + "'");
+
+			absentExpr = returnType + "()";
+		}
+
+		// Fields absent from the record (data written before the field was added) read as their default
+		return IndentOf(depth) + returnType + " " + field.name + "() const noexcept { const uint64_t slot = FieldSlot(" + field.name + "_Id); return slot ? " + presentExpr + " : " + absentExpr + "; }\n";
+	}
+
+	std::string BinaryViewFormatPlugin::GenerateFieldWriteCode(const SASTField& field, const std::string& objSource, size_t depth)
+	{
+		std::string indent = IndentOf(depth);
+		std::string source = objSource + "." + field.name;
+		std::string store = "writer.StoreField(record, BinaryView::" + field.name + "_Id, BinaryView::" + field.name + "_Slot, ";
+
+		switch (field.type)
+		{
+		case SASTType::POD:
+			return indent + "static_assert(std::is_trivially_copyable_v<" + field.originalTypeName + ">, \"BinaryView requires POD field '" + field.name + "' to be trivially copyable\");\n" +
+				indent + store + source + ");\n";
+
+		case SASTType::Int:
+		case SASTType::Float:
+		case SASTType::Bool:
+			return indent + store + source + ");\n";
+
+		case SASTType::String:
+			return indent + store + "writer.WriteString(" + source + "));\n";
+
+		case SASTType::Object:
+		{
+			GetObjectViewType(field);
+			return indent + store + field.objectNode->name + "::BinaryViewWrite(writer, " + source + "));\n";
+		}
+		case SASTType::Array:
+		case SASTType::Dynamic_Array:
+		case SASTType::Vector:
+		{
+			size_t nesting = 0;
+			const SASTField& element = GetInnermostElement(field, nesting);
+			ElementLayout layout = GetElementLayout(field, element, nesting);
+
+			std::string elementType = element.originalTypeName;
+			if (layout == ElementLayout::Object)
+			{
+				GetObjectViewType(element);
+				elementType = element.objectNode->name;
+			}
+
+			std::string data;
+			std::string count;
+			if (field.type == SASTType::Vector)
+			{
+				data = source + ".data()";
+				count = source + ".size()";
+			}
+			else if (field.type == SASTType::Dynamic_Array)
+			{
+				data = source;
+				count = objSource + "." + field.lengthVar;
+			}
+			else if (nesting > 1)
+			{
+				// Multi-dimensional static arrays are contiguous, so they are written as one flat run of their innermost element
+				data = "reinterpret_cast<const " + elementType + "*>(" + source + ")";
+				count = "sizeof(" + source + ") / sizeof(" + elementType + ")";
+			}
+			else
+			{
+				data = source;
+				count = "std::size(" + source + ")";
+			}
+
+			std::ostringstream oss;
+			switch (layout)
+			{
+			case ElementLayout::Trivial:
+				if (element.type == SASTType::POD)
+					oss << indent << "static_assert(std::is_trivially_copyable_v<" << elementType << ">, \"BinaryView requires the elements of '" << field.name << "' to be trivially copyable\");\n";
+				oss << indent << store << "writer.WriteArray<" << elementType << ">(" << data << ", " << count << "));\n";
+				break;
+
+			case ElementLayout::String:
+				oss << indent << store << "writer.WriteStringList(std::span<const " << elementType << ">(" << data << ", " << count << ")));\n";
+				break;
+
+			case ElementLayout::Object:
+			{
+				std::string list = field.name + "_list";
+				oss << indent << "{\n";
+				oss << indent << "\tconst uint64_t " << list << " = writer.Allocate(sizeof(uint64_t) * " << count << ", alignof(uint64_t));\n";
+				oss << indent << "\tfor (size_t i = 0; i < static_cast<size_t>(" << count << "); ++i)\n";
+				oss << indent << "\t\twriter.Store(" << list << " + i * sizeof(uint64_t), " << elementType << "::BinaryViewWrite(writer, " << data << "[i]));\n";
+				oss << indent << "\t" << store << RUNTIME_NAMESPACE << "BinaryViewRef{ " << list << ", static_cast<uint64_t>(" << count << ") });\n";
+				oss << indent << "}\n";
+				break;
+			}
+			}
+			return oss.str();
+		}
+		default:
+			throw std::runtime_error("BinaryView: Unsupported field type for '" + field.name + "' (" + field.originalTypeName + ")");
+		}
+	}
+
+	std::string BinaryViewFormatPlugin::GenerateCode(const std::shared_ptr<SASTNode> sastNode)
+	{
+		// Build a flattened list of fields: base class fields (only if accessible) then own fields
+		std::vector<const SASTField*> flattenedFields;
+		for (const auto& baseNode : sastNode->baseNodes)
+		{
+			for (const auto& field : baseNode->fields)
+			{
+				if (field.access != SASTField::Access::Private)
+					flattenedFields.push_back(&field);
+			}
+		}
+		for (const auto& field : sastNode->fields)
+		{
+			flattenedFields.push_back(&field);
+		}
+
+		std::ostringstream oss;
+
+		// The generated code is expanded inside the class body, access specifiers stay inside the nested view so the members
+		// declared after the macro keep the access they had before it, like the code of every other plugin
+		std::vector<uint32_t> fieldIds = AssignFieldIds(sastNode->name, flattenedFields);
+		uint32_t idCount = fieldIds.empty() ? 0 : *std::max_element(fieldIds.begin(), fieldIds.end()) + 1;
+
+		// Generate the view class. A record starts with its field table, followed by the slots. The ids are the stable identity of
+		// the fields, the slot offsets are only valid for records written by this version of the type and are looked up through the table
+		oss << "class BinaryView\n";
+		oss << "{\n";
+		oss << "private:\n";
+		oss << "\t" << RUNTIME_NAMESPACE << "BinaryViewBuffer m_buffer;\n";
+		oss << "\tuint64_t m_record = 0;\n\n";
+		oss << "\tuint64_t FieldSlot(uint32_t id) const noexcept { return " << RUNTIME_NAMESPACE << "BinaryViewFieldOffset(m_buffer, m_record, id); }\n\n";
+		oss << "public:\n";
+
+		for (size_t i = 0; i < flattenedFields.size(); ++i)
+		{
+			oss << "\tstatic constexpr uint32_t " << flattenedFields[i]->name << "_Id = " << fieldIds[i] << ";\n";
+		}
+		oss << "\tstatic constexpr uint32_t IdCount = " << idCount << ";\n\n";
+
+		std::string previousSlot;
+		std::string previousType;
+		for (const auto& field : flattenedFields)
+		{
+			std::string slotType = GetSlotType(*field);
+			oss << "\tstatic constexpr uint64_t " << field->name << "_Slot = ";
+			if (previousSlot.empty())
+				oss << RUNTIME_NAMESPACE << "BinaryViewFieldTableSize(IdCount);\n";
+			else
+				oss << RUNTIME_NAMESPACE << "BinaryViewAlign(" << previousSlot << " + sizeof(" << previousType << "), alignof(" << slotType << "));\n";
+
+			previousSlot = field->name + "_Slot";
+			previousType = slotType;
+		}
+
+		if (previousSlot.empty())
+			oss << "\tstatic constexpr uint64_t RecordSize = " << RUNTIME_NAMESPACE << "BinaryViewFieldTableSize(IdCount);\n\n";
+		else
+			oss << "\tstatic constexpr uint64_t RecordSize = " << RUNTIME_NAMESPACE << "BinaryViewAlign(" << previousSlot << " + sizeof(" << previousType << "), alignof(uint64_t));\n\n";
+
+		oss << "\tBinaryView() = default;\n";
+		oss << "\tBinaryView(" << RUNTIME_NAMESPACE << "BinaryViewBuffer buffer, uint64_t record) noexcept : m_buffer(buffer), m_record(record) {}\n\n";
+
+		for (const auto& field : flattenedFields)
+		{
+			oss << GenerateFieldAccessorCode(*field, 1);
+		}
+
+		oss << "};\n\n";
+
+		// Generate the function writing the object as a record into a writer
+		oss << "static uint64_t BinaryViewWrite(" << RUNTIME_NAMESPACE << "BinaryViewWriter& writer, const " << sastNode->name << "& objSource)\n";
+		oss << "{\n";
+		oss << "\tconst uint64_t record = writer.BeginRecord(BinaryView::IdCount, BinaryView::RecordSize);\n";
+
+		for (const auto& field : flattenedFields)
+		{
+			oss << GenerateFieldWriteCode(*field, "objSource");
+		}
+
+		oss << "\treturn record;\n";
+		oss << "}\n\n";
+
+		// Generate the Serialize to buffer function
+		oss << "static std::vector<std::byte> BinaryViewSerialize(const " << sastNode->name << "& objSource)\n";
+		oss << "{\n";
+		oss << "\t" << RUNTIME_NAMESPACE << "BinaryViewWriter writer;\n";
+		oss << "\twriter.Finish(BinaryViewWrite(writer, objSource));\n";
+		oss << "\treturn writer.TakeBuffer();\n";
+		oss << "}\n\n";
+
+		// Generate the function opening a view over a buffer, in place
+		oss << "static BinaryView BinaryViewOpen(const std::byte* data, size_t size)\n";
+		oss << "{\n";
+		oss << "\treturn BinaryView(" << RUNTIME_NAMESPACE << "BinaryViewBuffer{ data, size }, " << RUNTIME_NAMESPACE << "BinaryViewOpenRoot(data, size));\n";
+		oss << "}\n";
+
+		return oss.str();
+	}
+
+	std::string BinaryViewFormatPlugin::GetFormatName() const noexcept
+	{
+		return "BinaryView";
+	}
+
+	uint8_t BinaryViewFormatPlugin::GetPluginPriority() const noexcept
+	{
+		return 0;
+	}
+}
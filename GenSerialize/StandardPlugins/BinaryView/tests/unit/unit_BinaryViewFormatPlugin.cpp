@@ -0,0 +1,416 @@
+#include <gtest/gtest.h>
+
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/VirtualFileSystem.h>
+#include <llvm/ADT/IntrusiveRefCntPtr.h>
+#include <clang/Tooling/CommonOptionsParser.h>
+#include <clang/Tooling/Tooling.h>
+#include <clang/Tooling/CompilationDatabase.h>
+#include <clang/Frontend/ASTUnit.h>
+#include <clang/Frontend/FrontendActions.h>
+
+#include <unordered_map>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include <filesystem>
+
+#include <SASTGeneratorActionFactory.h>
+#include <SASTGeneratorAction.h>
+#include <SAST.h>
+#include <BinaryViewFormatPlugin.h>
+
+#include <sstream>
+#include <streambuf>
+#include <iostream>
+
+struct OutputCapture
+{
+	std::stringstream outBuffer;
+	std::stringstream errBuffer;
+
+	std::streambuf* oldOut = nullptr;
+	std::streambuf* oldErr = nullptr;
+
+	void start() {
+		oldOut = std::cout.rdbuf(outBuffer.rdbuf());
+		oldErr = std::cerr.rdbuf(errBuffer.rdbuf());
+	}
+
+	void stop() {
+		std::cout.rdbuf(oldOut);
+		std::cerr.rdbuf(oldErr);
+	}
+
+	std::string getStdOut() const { return outBuffer.str(); }
+	std::string getStdErr() const { return errBuffer.str(); }
+};
+
+
+using namespace GenTools::GenSerialize;
+using namespace clang::tooling;
+
+using namespace GenTools::GenSerialize;
+
+class BinaryViewFormatPluginTest : public ::testing::Test
+{
+protected:
+	std::unordered_map<std::string, std::vector<std::shared_ptr<SASTNode>>> globalSASTTrees;
+	std::unordered_map<std::string, std::shared_ptr<SASTNode>> globalSASTMap;
+
+	static void AssertCodeEqual(const std::string& actual, const std::string& expected)
+	{
+		std::string normA, normB;
+		std::remove_copy(actual.begin(), actual.end(), std::back_inserter(normA), '\r');
+		std::remove_copy(expected.begin(), expected.end(), std::back_inserter(normB), '\r');
+		EXPECT_EQ(normA, normB);
+	}
+
+	void GenerateSASTFromSources(const std::vector<std::pair<std::string, std::string>>& virtualFiles)
+	{
+		// Extract paths
+		std::vector<std::string> sourcePaths;
+		for (const auto& [filename, _] : virtualFiles) {
+			sourcePaths.push_back(filename);
+		}
+
+		std::vector<std::string> compilationArgs = {
+			"-xc++",                            // Treat all input as C++
+			"-std=c++20",                       // Use C++20
+			"-fsyntax-only",                    // Don't generate code, just parse
+			"-Wno-pragma-once-outside-header",  // Silence warnings for #pragma once
+			"-nostdinc++",                      // Skip system C++ headers (for speed/stability)
+			"-fno-exceptions",                  // Optional: disable exceptions
+			"-fno-rtti",                        // Optional: disable RTTI
+		};
+		auto Compilations = std::make_unique<FixedCompilationDatabase>(".", compilationArgs);
+
+		// === Create Virtual FS ===
+		using namespace llvm;
+		using namespace clang::tooling;
+
+		auto RealFS = vfs::getRealFileSystem();
+		auto InMemFS = llvm::makeIntrusiveRefCnt<vfs::InMemoryFileSystem>();
+
+		// Add SerializationMacros.h
+		auto EmptyBuffer = llvm::MemoryBuffer::getMemBuffer("", "EmptyBuffer");
+		InMemFS->addFile("SerializationMacros.h", 0, std::move(EmptyBuffer));
+
+		// Add dummy generated.h includes
+		for (const auto& [filename, _] : virtualFiles) {
+			std::filesystem::path path(filename);
+			std::string genHeader = path.filename().replace_extension(".generated.h").string();
+			auto EmptyBufferGen = llvm::MemoryBuffer::getMemBuffer("", "EmptyBufferGen");
+			InMemFS->addFile(genHeader, 0, std::move(EmptyBufferGen));
+		}
+
+		auto OverlayFS = llvm::makeIntrusiveRefCnt<vfs::OverlayFileSystem>(InMemFS);
+		OverlayFS->pushOverlay(RealFS);
+
+		// === Set up ClangTool with overlay FS ===
+		SASTGeneratorActionFactory factory;
+		ClangTool tool(*Compilations, sourcePaths, std::make_shared<clang::PCHContainerOperations>(), OverlayFS);
+
+		for (const auto& [filename, content] : virtualFiles) {
+			tool.mapVirtualFile(filename, content);
+		}
+
+		OutputCapture capture;
+		capture.start();
+
+		int result = tool.run(&factory);
+
+		capture.stop();
+
+		// If the tool fails, show diagnostics
+		if (result != 0) {
+			std::cerr << "ClangTool failed\n";
+			std::cerr << "Captured stdout:\n" << capture.getStdOut();
+			std::cerr << "Captured stderr:\n" << capture.getStdErr();
+		}
+
+		ASSERT_EQ(result, 0) << "Clang tool run failed";
+
+		// Merge results
+		factory.MergeResults(globalSASTTrees, globalSASTMap);
+	}
+};
+
+
+TEST_F(BinaryViewFormatPluginTest, HandlesScalarAndVectorOfInts)
+{
+	GenerateSASTFromSources({
+		{"VectorType.h", R"cpp(
+			#pragma once
+			#include <vector>
+			#include "SerializationMacros.h"
+
+			class SERIALIZABLE(BinaryView) VectorType {
+				SERIALIZE_FIELD
+				int count;
+
+				SERIALIZE_FIELD
+				std::vector<int> intVec;
+
+				GENERATED_SERIALIZATION_BODY();
+			};
+		)cpp"}
+		});
+
+	ASSERT_NE(globalSASTMap.find("VectorType"), globalSASTMap.end());
+	BinaryViewFormatPlugin plugin;
+	std::string code = plugin.GenerateCode(globalSASTMap["VectorType"]);
+	ASSERT_FALSE(code.empty());
+
+	const char* expected = R"cpp(class BinaryView
+{
+private:
+	GenTools::GenSerialize::BinaryViewBuffer m_buffer;
+	uint64_t m_record = 0;
+
+	uint64_t FieldSlot(uint32_t id) const noexcept { return GenTools::GenSerialize::BinaryViewFieldOffset(m_buffer, m_record, id); }
+
+public:
+	static constexpr uint32_t count_Id = 0;
+	static constexpr uint32_t intVec_Id = 1;
+	static constexpr uint32_t IdCount = 2;
+
+	static constexpr uint64_t count_Slot = GenTools::GenSerialize::BinaryViewFieldTableSize(IdCount);
+	static constexpr uint64_t intVec_Slot = GenTools::GenSerialize::BinaryViewAlign(count_Slot + sizeof(int), alignof(GenTools::GenSerialize::BinaryViewRef));
+	static constexpr uint64_t RecordSize = GenTools::GenSerialize::BinaryViewAlign(intVec_Slot + sizeof(GenTools::GenSerialize::BinaryViewRef), alignof(uint64_t));
+
+	BinaryView() = default;
+	BinaryView(GenTools::GenSerialize::BinaryViewBuffer buffer, uint64_t record) noexcept : m_buffer(buffer), m_record(record) {}
+
+	int count() const noexcept { const uint64_t slot = FieldSlot(count_Id); return slot ? GenTools::GenSerialize::BinaryViewLoad<int>(m_buffer, m_record + slot) : int{}; }
+	std::span<const int> intVec() const noexcept { const uint64_t slot = FieldSlot(intVec_Id); return slot ? GenTools::GenSerialize::BinaryViewLoadSpan<int>(m_buffer, m_record + slot) : std::span<const int>(); }
+};
+
+static uint64_t BinaryViewWrite(GenTools::GenSerialize::BinaryViewWriter& writer, const VectorType& objSource)
+{
+	const uint64_t record = writer.BeginRecord(BinaryView::IdCount, BinaryView::RecordSize);
+	writer.StoreField(record, BinaryView::count_Id, BinaryView::count_Slot, objSource.count);
+	writer.StoreField(record, BinaryView::intVec_Id, BinaryView::intVec_Slot, writer.WriteArray<int>(objSource.intVec.data(), objSource.intVec.size()));
+	return record;
+}
+
+static std::vector<std::byte> BinaryViewSerialize(const VectorType& objSource)
+{
+	GenTools::GenSerialize::BinaryViewWriter writer;
+	writer.Finish(BinaryViewWrite(writer, objSource));
+	return writer.TakeBuffer();
+}
+
+static BinaryView BinaryViewOpen(const std::byte* data, size_t size)
+{
+	return BinaryView(GenTools::GenSerialize::BinaryViewBuffer{ data, size }, GenTools::GenSerialize::BinaryViewOpenRoot(data, size));
+}
+)cpp";
+
+	AssertCodeEqual(code, expected);
+}
+
+TEST_F(BinaryViewFormatPluginTest, HandlesNestedObjectAndStrings)
+{
+	GenerateSASTFromSources({
+		{"Nested.h", R"cpp(
+			#pragma once
+			#include <string>
+			#include <vector>
+			#include "SerializationMacros.h"
+			#include "Nested.generated.h"
+
+			class SERIALIZABLE(BinaryView) InnerObject {
+				SERIALIZE_FIELD
+				int innerVal;
+
+				SERIALIZE_FIELD
+				std::string innerText;
+
+				InnerObject_SERIALIZATION_BODY();
+			};
+
+			class SERIALIZABLE(BinaryView) OuterObject {
+				SERIALIZE_FIELD
+				InnerObject obj;
+
+				SERIALIZE_FIELD
+				std::vector<InnerObject> objs;
+
+				SERIALIZE_FIELD
+				std::vector<std::string> names;
+
+				OuterObject_SERIALIZATION_BODY();
+			};
+		)cpp"}
+		});
+
+	ASSERT_NE(globalSASTMap.find("OuterObject"), globalSASTMap.end());
+	BinaryViewFormatPlugin plugin;
+
+	std::string innerCode = plugin.GenerateCode(globalSASTMap["InnerObject"]);
+	EXPECT_NE(innerCode.find("std::string_view innerText() const noexcept"), std::string::npos);
+	EXPECT_NE(innerCode.find("writer.StoreField(record, BinaryView::innerText_Id, BinaryView::innerText_Slot, writer.WriteString(objSource.innerText));"), std::string::npos);
+
+	std::string outerCode = plugin.GenerateCode(globalSASTMap["OuterObject"]);
+	EXPECT_NE(outerCode.find("InnerObject::BinaryView obj() const noexcept"), std::string::npos);
+	EXPECT_NE(outerCode.find("GenTools::GenSerialize::BinaryViewList<InnerObject::BinaryView> objs() const noexcept"), std::string::npos);
+	EXPECT_NE(outerCode.find("GenTools::GenSerialize::BinaryViewStringList names() const noexcept"), std::string::npos);
+	EXPECT_NE(outerCode.find("writer.StoreField(record, BinaryView::obj_Id, BinaryView::obj_Slot, InnerObject::BinaryViewWrite(writer, objSource.obj));"), std::string::npos);
+}
+
+TEST_F(BinaryViewFormatPluginTest, RejectsTypesWithoutInPlaceLayout)
+{
+	GenerateSASTFromSources({
+		{"MapType.h", R"cpp(
+			#pragma once
+			#include <map>
+			#include "SerializationMacros.h"
+
+			class SERIALIZABLE(BinaryView) MapType {
+				SERIALIZE_FIELD
+				std::map<int, int> values;
+
+				GENERATED_SERIALIZATION_BODY();
+			};
+		)cpp"}
+		});
+
+	ASSERT_NE(globalSASTMap.find("MapType"), globalSASTMap.end());
+	BinaryViewFormatPlugin plugin;
+	EXPECT_THROW(plugin.GenerateCode(globalSASTMap["MapType"]), std::runtime_error);
+}
+
+TEST_F(BinaryViewFormatPluginTest, HandlesFieldIdsAndDefaults)
+{
+	GenerateSASTFromSources({
+		{"Evolving.h", R"cpp(
+			#pragma once
+			#include <string>
+			#include "SerializationMacros.h"
+
+			class SERIALIZABLE(BinaryView) Evolving {
+				SERIALIZE_FIELD SERIALIZE_ID(4) SERIALIZE_DEFAULT(7)
+				int added;
+
+				SERIALIZE_FIELD SERIALIZE_ID(1)
+				int original;
+
+				SERIALIZE_FIELD SERIALIZE_ID(2) SERIALIZE_DEFAULT("unnamed")
+				std::string name;
+
+				GENERATED_SERIALIZATION_BODY();
+			};
+		)cpp"}
+		});
+
+	ASSERT_NE(globalSASTMap.find("Evolving"), globalSASTMap.end());
+	const auto& fields = globalSASTMap["Evolving"]->fields;
+	ASSERT_EQ(fields.size(), 3u);
+	EXPECT_EQ(fields[0].fieldId, 4u);
+	EXPECT_EQ(fields[0].defaultValue, "7");
+	EXPECT_EQ(fields[2].defaultValue, "\"unnamed\"");
+
+	BinaryViewFormatPlugin plugin;
+	std::string code = plugin.GenerateCode(globalSASTMap["Evolving"]);
+	EXPECT_NE(code.find("static constexpr uint32_t added_Id = 4;"), std::string::npos);
+	EXPECT_NE(code.find("static constexpr uint32_t IdCount = 5;"), std::string::npos);
+	EXPECT_NE(code.find(": std::type_identity_t<int>{ 7 }; }"), std::string::npos);
+	EXPECT_NE(code.find(": std::string_view(\"unnamed\"); }"), std::string::npos);
+}
+
+TEST_F(BinaryViewFormatPluginTest, BraceInitializesDefaultsOfSeveralArguments)
+{
+	GenerateSASTFromSources({
+		{"Defaults.h", R"cpp(
+			#pragma once
+			#include "SerializationMacros.h"
+
+			struct SERIALIZABLE_POD Point {
+				int x;
+				int y;
+			};
+
+			class SERIALIZABLE(BinaryView) Defaults {
+				SERIALIZE_FIELD SERIALIZE_DEFAULT(1, 2)
+				Point origin;
+
+				SERIALIZE_FIELD SERIALIZE_DEFAULT(3, 4)
+				unsigned int count;
+
+				GENERATED_SERIALIZATION_BODY();
+			};
+		)cpp"}
+		});
+
+	ASSERT_NE(globalSASTMap.find("Defaults"), globalSASTMap.end());
+	BinaryViewFormatPlugin plugin;
+	std::string code = plugin.GenerateCode(globalSASTMap["Defaults"]);
+
+	// A scalar default of several arguments fails to compile as a narrowing list rather than silently becoming the last one
+	EXPECT_NE(code.find(": Point{ 1, 2 }; }"), std::string::npos);
+	EXPECT_NE(code.find(": std::type_identity_t<unsigned int>{ 3, 4 }; }"), std::string::npos);
+	EXPECT_EQ(code.find("static_cast<unsigned int>(3, 4)"), std::string::npos);
+}
+
+TEST_F(BinaryViewFormatPluginTest, RejectsPartialFieldIds)
+{
+	GenerateSASTFromSources({
+		{"Partial.h", R"cpp(
+			#pragma once
+			#include "SerializationMacros.h"
+
+			class SERIALIZABLE(BinaryView) Partial {
+				SERIALIZE_FIELD SERIALIZE_ID(1)
+				int a;
+
+				SERIALIZE_FIELD
+				int b;
+
+				GENERATED_SERIALIZATION_BODY();
+			};
+		)cpp"}
+		});
+
+	ASSERT_NE(globalSASTMap.find("Partial"), globalSASTMap.end());
+	BinaryViewFormatPlugin plugin;
+	EXPECT_THROW(plugin.GenerateCode(globalSASTMap["Partial"]), std::runtime_error);
+}
+
+TEST_F(BinaryViewFormatPluginTest, MembersAfterTheBodyKeepTheirAccess)
+{
+	GenerateSASTFromSources({
+		{"Guarded.h", R"cpp(
+			#pragma once
+			#include "SerializationMacros.h"
+
+			class SERIALIZABLE(BinaryView) Guarded {
+				SERIALIZE_FIELD
+				int value;
+
+				GENERATED_SERIALIZATION_BODY();
+				int secret;
+			};
+		)cpp"}
+		});
+
+	ASSERT_NE(globalSASTMap.find("Guarded"), globalSASTMap.end());
+	BinaryViewFormatPlugin plugin;
+	std::string code = plugin.GenerateCode(globalSASTMap["Guarded"]);
+
+	// Expand the generated body where the macro stands, the member declared after it must still be private
+	std::string guardedCode =
+		"#include <BinaryView.h>\n"
+		"class Guarded\n{\n\tint value;\n\n" + code + "\n\tint secret;\n};\n"
+		"template<typename T> concept HasPublicSecret = requires(const T& object) { object.secret; };\n"
+		"static_assert(!HasPublicSecret<Guarded>, \"A member declared after the generated body became public\");\n";
+
+	std::filesystem::path runtimeDir = std::filesystem::path(__FILE__).parent_path().parent_path().parent_path() / "BinaryViewRuntime";
+	std::vector<std::string> args = {
+		"-std=c++20",
+		"-I" + (runtimeDir / "include").string(),
+		"-I" + (runtimeDir / "inl").string(),
+	};
+	EXPECT_TRUE(runToolOnCodeWithArgs(std::make_unique<clang::SyntaxOnlyAction>(), guardedCode, args, "Guarded.cpp"));
+}
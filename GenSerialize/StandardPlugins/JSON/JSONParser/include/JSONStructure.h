@@ -25,7 +25,7 @@ namespace GenTools::GenSerialize
 	class FORMAT_PLUGIN_ABI JSONStructure
 	{
 	private:
-		std::unordered_map<std::string, std::unique_ptr<JSONValue>> m_members;
+		JSONObject::ObjectType m_members;
 
 	public:
 		JSONStructure() = default;
@@ -39,6 +39,8 @@ namespace GenTools::GenSerialize
 		static JSONStructure Parse(std::istream& stream);
 		static JSONStructure FromFile(std::filesystem::path& path);
 
+		const JSONObject::ObjectType& GetMembers() const noexcept;
+
 		std::unique_ptr<JSONValue>& GetMember(const std::string& key);
 		std::unique_ptr<JSONValue>& operator[](const std::string& key);
 
@@ -3,6 +3,8 @@
 
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <cstdint>
 #include <concepts>
 
 #include <IFormatPlugin.h>
@@ -52,14 +54,62 @@ namespace GenTools::GenSerialize
 		JSONType Type() const noexcept final;
 	};
 
+	template<typename T>
+	concept JSONInteger = std::integral<T> && !std::same_as<T, bool>;
+
+	/// <summary>
+	/// Numeric JSON value. Integers are kept exactly (64 bit signed or unsigned) next to their double approximation, so 64 bit
+	/// ids and counters survive a round trip; value always holds the double for code that only needs an approximation
+	/// </summary>
 	struct FORMAT_PLUGIN_ABI JSONNumber : public JSONValue
 	{
+		enum class Kind : uint8_t
+		{
+			Floating,
+			Signed,
+			Unsigned
+		};
+
 		double value;
 
+		union
+		{
+			int64_t signedValue;
+			uint64_t unsignedValue;
+		};
+
+		Kind kind;
+
 		explicit JSONNumber(double val) noexcept;
 
+		template<JSONInteger T>
+		explicit JSONNumber(T val) noexcept;
+
+		/// <summary>
+		/// Parse a JSON number literal. Literals without a fraction or exponent that fit in 64 bits are kept as exact integers
+		/// </summary>
+		/// <param name="text">The number literal</param>
+		/// <returns>The parsed number</returns>
+		static JSONNumber Parse(std::string_view text);
+
 		double Get() const noexcept;
 
+		/// <summary>
+		/// Get the number converted to an arithmetic type. Integer conversions are exact and throw std::out_of_range when the value
+		/// does not fit the requested type, or std::invalid_argument when the value has a fractional part
+		/// </summary>
+		/// <typeparam name="T">The requested arithmetic type</typeparam>
+		/// <returns>The converted value</returns>
+		template<typename T>
+			requires std::is_arithmetic_v<T> && (!std::same_as<T, bool>)
+		T Get() const;
+
+		/// <summary>
+		/// Format the number as a JSON literal, integers exactly and doubles with the shortest representation that round trips
+		/// </summary>
+		/// <returns>The number literal</returns>
+		std::string ToString() const;
+
 		JSONType Type() const noexcept final;
 	};
 
@@ -46,6 +46,11 @@ namespace GenTools::GenSerialize
             throw std::invalid_argument("Invalid file path provided. " + path.string() + " does not exist");
     }
 
+    FORCE_INLINE const JSONObject::ObjectType& JSONStructure::GetMembers() const noexcept
+    {
+        return m_members;
+    }
+
     FORCE_INLINE std::unique_ptr<JSONValue>& JSONStructure::GetMember(const std::string& key)
     {
         auto it = m_members.find(key);
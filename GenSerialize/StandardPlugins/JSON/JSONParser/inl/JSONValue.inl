@@ -9,6 +9,12 @@
 #define FORCE_INLINE inline
 #endif
 
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <utility>
+
 namespace GenTools::GenSerialize
 {
 	template<typename T>
@@ -56,14 +62,127 @@ namespace GenTools::GenSerialize
 	}
 
 	FORCE_INLINE JSONNumber::JSONNumber(double val) noexcept
-		: value(val)
+		: value(val), unsignedValue(0), kind(Kind::Floating)
 	{}
 
+	template<JSONInteger T>
+	FORCE_INLINE JSONNumber::JSONNumber(T val) noexcept
+		: value(static_cast<double>(val))
+	{
+		if constexpr (std::is_signed_v<T>)
+		{
+			signedValue = static_cast<int64_t>(val);
+			kind = Kind::Signed;
+		}
+		else
+		{
+			unsignedValue = static_cast<uint64_t>(val);
+			kind = Kind::Unsigned;
+		}
+	}
+
+	inline JSONNumber JSONNumber::Parse(std::string_view text)
+	{
+		const char* first = text.data();
+		const char* last = text.data() + text.size();
+
+		if (text.find_first_of(".eE") == std::string_view::npos)
+		{
+			// Integer literal, keep it exact when it fits in 64 bits and fall back to a double otherwise
+			if (text.starts_with('-'))
+			{
+				int64_t integer;
+				auto [ptr, ec] = std::from_chars(first, last, integer);
+				if (ec == std::errc() && ptr == last)
+					return JSONNumber(integer);
+			}
+			else
+			{
+				uint64_t integer;
+				auto [ptr, ec] = std::from_chars(first, last, integer);
+				if (ec == std::errc() && ptr == last)
+					return JSONNumber(integer);
+			}
+		}
+
+		double floating;
+		auto [ptr, ec] = std::from_chars(first, last, floating);
+		if (ec == std::errc::result_out_of_range)
+			throw std::out_of_range("JSON number is out of range: " + std::string(text));
+		if (ec != std::errc() || ptr != last)
+			throw std::invalid_argument("Invalid JSON number: " + std::string(text));
+
+		return JSONNumber(floating);
+	}
+
 	FORCE_INLINE double JSONNumber::Get() const noexcept
 	{
 		return value;
 	}
 
+	template<typename T>
+		requires std::is_arithmetic_v<T> && (!std::same_as<T, bool>)
+	FORCE_INLINE T JSONNumber::Get() const
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			switch (kind)
+			{
+			case Kind::Signed:
+				return static_cast<T>(signedValue);
+			case Kind::Unsigned:
+				return static_cast<T>(unsignedValue);
+			default:
+				return static_cast<T>(value);
+			}
+		}
+		else
+		{
+			switch (kind)
+			{
+			case Kind::Signed:
+				if (!std::in_range<T>(signedValue))
+					throw std::out_of_range("JSON number " + std::to_string(signedValue) + " does not fit the requested integer type");
+				return static_cast<T>(signedValue);
+
+			case Kind::Unsigned:
+				if (!std::in_range<T>(unsignedValue))
+					throw std::out_of_range("JSON number " + std::to_string(unsignedValue) + " does not fit the requested integer type");
+				return static_cast<T>(unsignedValue);
+
+			default:
+				if (std::trunc(value) != value)
+					throw std::invalid_argument("JSON number " + std::to_string(value) + " is not an integer");
+
+				// Compare against the bounds as doubles, max() + 1 is a power of two and therefore exact
+				if (value < static_cast<double>(std::numeric_limits<T>::min()) ||
+					value >= static_cast<double>(std::numeric_limits<T>::max() / 2 + 1) * 2.0)
+					throw std::out_of_range("JSON number " + std::to_string(value) + " does not fit the requested integer type");
+				return static_cast<T>(value);
+			}
+		}
+	}
+
+	inline std::string JSONNumber::ToString() const
+	{
+		// Large enough for any 64 bit integer and for the shortest round trip representation of a double
+		std::array<char, 32> buffer;
+		std::to_chars_result result;
+		switch (kind)
+		{
+		case Kind::Signed:
+			result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), signedValue);
+			break;
+		case Kind::Unsigned:
+			result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), unsignedValue);
+			break;
+		default:
+			result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+			break;
+		}
+		return std::string(buffer.data(), result.ptr);
+	}
+
 	FORCE_INLINE JSONType JSONNumber::Type() const noexcept
 	{
 		return JSONType::Number;
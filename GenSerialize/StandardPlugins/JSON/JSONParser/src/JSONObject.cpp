@@ -70,10 +70,9 @@ namespace GenTools::GenSerialize
 			{
 				// Numeric value
 				auto numStart = itr;
-				while (itr != end && (std::isdigit(*itr) || *itr == '.' || *itr == '-'))
+				while (itr != end && (std::isdigit(*itr) || *itr == '.' || *itr == '-' || *itr == '+' || *itr == 'e' || *itr == 'E'))
 					++itr;
-				std::string numStr(numStart, itr);
-				arg = std::make_unique<JSONNumber>(std::stod(numStr));
+				arg = std::make_unique<JSONNumber>(JSONNumber::Parse(std::string_view(numStart, itr)));
 			}
 			else if (*itr == 't' || *itr == 'f')
 			{
@@ -1,8 +1,6 @@
 #include <StringifyValue.h>
 
 #include <string_view>
-#include <sstream>
-#include <iomanip>
 
 #include <JSONValue.h>
 
@@ -21,17 +19,8 @@ namespace GenTools::GenSerialize::JSON
         case JSONType::String:
             return "\"" + value->as<JSONString>().value + "\"";
 
-        case JSONType::Number: {
-            double num = value->as<JSONNumber>().value;
-            if (num == static_cast<int64_t>(num)) {
-                return std::to_string(static_cast<int64_t>(num)); // Print as integer if whole
-            }
-            else {
-                std::ostringstream oss;
-                oss << std::setprecision(15) << num; // Avoid unnecessary trailing zeros
-                return oss.str();
-            }
-        }
+        case JSONType::Number:
+            return value->as<JSONNumber>().ToString();
 
         case JSONType::Bool:
             return value->as<JSONBool>().value ? "true" : "false";
@@ -8,8 +8,8 @@ TEST(JSONStructureTests, ParseSimpleObject)
 	std::stringstream jsonStream(R"({"name": "Test", "age": 30})");
 	JSONStructure json = JSONStructure::Parse(jsonStream);
 
-	ASSERT_EQ(json["name"]->as<JSONString>()->value, "Test");
-	ASSERT_EQ(json["age"]->as<JSONNumber>()->value, 30);
+	ASSERT_EQ(json["name"]->as<JSONString>().value, "Test");
+	ASSERT_EQ(json["age"]->as<JSONNumber>().value, 30);
 }
 
 TEST(JSONStructureTests, ParseNestedObject)
@@ -17,9 +17,9 @@ TEST(JSONStructureTests, ParseNestedObject)
 	std::stringstream jsonStream(R"({"person": {"name": "Alice", "age": 25}})");
 	JSONStructure json = JSONStructure::Parse(jsonStream);
 
-	auto& person = *json["person"]->as<JSONObject>();
-	ASSERT_EQ(person["name"]->as<JSONString>()->value, "Alice");
-	ASSERT_EQ(person["age"]->as<JSONNumber>()->value, 25.0);
+	auto& person = json["person"]->as<JSONObject>();
+	ASSERT_EQ(person["name"]->as<JSONString>().value, "Alice");
+	ASSERT_EQ(person["age"]->as<JSONNumber>().value, 25.0);
 }
 
 TEST(JSONStructureTests, ParseArray)
@@ -27,14 +27,50 @@ TEST(JSONStructureTests, ParseArray)
 	std::stringstream jsonStream(R"({"numbers": [1, 2, 3, 4]})");
 	JSONStructure json = JSONStructure::Parse(jsonStream);
 
-	auto& numbers = json["numbers"]->as<JSONArray>()->GetItems();
+	auto& numbers = json["numbers"]->as<JSONArray>().GetItems();
 	std::vector<double> expected = { 1, 2, 3, 4 };
 	for (size_t i = 0; i < expected.size(); i++)
 	{
-		EXPECT_EQ(numbers[i]->as<JSONNumber>()->value, expected[i]);
+		EXPECT_EQ(numbers[i]->as<JSONNumber>().value, expected[i]);
 	}
 }
 
+TEST(JSONStructureTests, ParseIntegersExactly)
+{
+	std::stringstream jsonStream(R"({"id": 18446744073709551615, "min": -9223372036854775808, "scaled": 1.5e3})");
+	JSONStructure json = JSONStructure::Parse(jsonStream);
+
+	const auto& id = json["id"]->as<JSONNumber>();
+	ASSERT_EQ(id.kind, JSONNumber::Kind::Unsigned);
+	EXPECT_EQ(id.Get<uint64_t>(), 18446744073709551615ull);
+
+	const auto& min = json["min"]->as<JSONNumber>();
+	ASSERT_EQ(min.kind, JSONNumber::Kind::Signed);
+	EXPECT_EQ(min.Get<int64_t>(), std::numeric_limits<int64_t>::min());
+
+	const auto& scaled = json["scaled"]->as<JSONNumber>();
+	ASSERT_EQ(scaled.kind, JSONNumber::Kind::Floating);
+	EXPECT_EQ(scaled.Get<int32_t>(), 1500);
+
+	EXPECT_EQ(id.ToString(), "18446744073709551615");
+	EXPECT_EQ(min.ToString(), "-9223372036854775808");
+	EXPECT_EQ(scaled.ToString(), "1500");
+	EXPECT_EQ(JSONNumber(0.1).ToString(), "0.1");
+}
+
+TEST(JSONStructureTests, NumberConversionsAreRangeChecked)
+{
+	EXPECT_EQ(JSONNumber(int64_t(-5)).Get<int8_t>(), -5);
+	EXPECT_EQ(JSONNumber(2.0).Get<uint16_t>(), 2);
+	EXPECT_FLOAT_EQ(JSONNumber(uint64_t(7)).Get<float>(), 7.0f);
+
+	EXPECT_THROW(JSONNumber(300).Get<uint8_t>(), std::out_of_range);
+	EXPECT_THROW(JSONNumber(-1).Get<uint32_t>(), std::out_of_range);
+	EXPECT_THROW(JSONNumber(uint64_t(1) << 63).Get<int64_t>(), std::out_of_range);
+	EXPECT_THROW(JSONNumber(1e300).Get<int64_t>(), std::out_of_range);
+	EXPECT_THROW(JSONNumber(1.5).Get<int32_t>(), std::invalid_argument);
+}
+
 TEST(JSONStructureTests, ParseInvalidJSON)
 {
 	std::stringstream jsonStream(R"({"name": "Test", "age": )"); // Invalid JSON
@@ -47,11 +83,15 @@ TEST(JSONStructureTests, StringifyTest)
 	std::stringstream jsonStream(R"({"name": "John", "age": 40})");
 	JSONStructure json = JSONStructure::Parse(jsonStream);
 
+	// Members are kept in an unordered map, either order is valid
 	std::string jsonString = json.Stringify();
-	ASSERT_EQ(jsonString, R"({
+	EXPECT_TRUE(jsonString == R"({
     "name": "John",
     "age": 40
-})"); // Expected format with indentation
+})" || jsonString == R"({
+    "age": 40,
+    "name": "John"
+})") << jsonString; // Expected format with indentation
 }
 
 TEST(JSONStructureTests, WriteToFileTest)
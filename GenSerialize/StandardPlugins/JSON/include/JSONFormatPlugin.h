@@ -1,52 +1,68 @@
 #ifndef GENTOOLS_GENSERIALIZE_JSON_FORMAT_PLUGIN_H
 #define GENTOOLS_GENSERIALIZE_JSON_FORMAT_PLUGIN_H
 
-#include <IFormatPlugin.h>
+#include <IStreamingFormatPlugin.h>
 #include <FileFormatRegistry.h>
 
 #include <string>
+#include <vector>
 
 namespace GenTools::GenSerialize
 {
-	class FORMAT_PLUGIN_ABI JSONFormatPlugin : public IFormatPlugin
+	class FORMAT_PLUGIN_ABI JSONFormatPlugin : public IStreamingFormatPlugin
 	{
 	protected:
 		// Extention points for polymorphic behavior
 		virtual std::string GenerateArrayAllocationCode(const SASTField& field, const std::string& arrayName, const std::string& jsonArrayName);
 		virtual std::string GenerateNewContainerElementCode(const SASTField& field, const std::string& containerName, const std::string& newElementReferenceName, const std::string& key = "");
+		virtual std::string GenerateContainerReserveCode(const SASTField& field, const std::string& containerName, const std::string& countExpr);
+		virtual std::string GenerateContainerInsertCode(const SASTField& field, const std::string& containerName, const std::string& valueExpr, const std::string& key = "");
 		virtual std::string GenerateMemoryCleanupCode(const std::string& pointerName);
 
 		/// <summary>
 		/// Helper for generating the serialization code for a given field
 		/// </summary>
+		/// <param name="sink">Receives the serialization logic for the field entered</param>
 		/// <param name="field">The field in the source object to generate serialization logic for</param>
 		/// <param name="jsonReceiver">The literal text to access the json object to serialize the field into</param>
 		/// <param name="objSource">The literal text to access the field in the source object</param>
 		/// <param name="depth">Indicates the level of recursion for this call to this function</param>
 		/// <param name="receiverIsJsonObj">Indicates if the jsonReceiver is a JSON object, if false, it is a JSON array</param>
 		/// <param name="generateInsertion">Indicates that this call to the funciton should generate json object insertion code, or stop after generating field logic</param>
-		/// <returns>The serialization logic for the field entered</returns>
-		virtual std::string GenerateFieldSerializeCode(const SASTField& field, const std::string& jsonReceiver, const std::string& objSource, size_t depth = 1, bool receiverIsJsonObj = true, bool generateInsertion = true);
+		virtual void EmitFieldSerializeCode(CodeSink& sink, const SASTField& field, const std::string& jsonReceiver, const std::string& objSource, size_t depth = 1, bool receiverIsJsonObj = true, bool generateInsertion = true);
 
 		/// <summary>
 		/// Helper for generating the deserialization code for a given field
 		/// </summary>
+		/// <param name="sink">Receives the deserialization logic for the field entered</param>
 		/// <param name="field">The field in the source object to generate serialization logic for</param>
 		/// <param name="objReceiver">The literal text to access the field in the object to be deserialized into</param>
 		/// <param name="jsonSource">The literal text to access the json object which is the source for the deserialization</param>
 		/// <param name="depth">Indicates the level of recursion for this call of this function</param>
 		/// <param name="sourceIsJsonObj">Indicates if the jsonSource is a JSON object, if false, it is a JSON array</param>
 		/// <param name="treatKeyAsString">Indicates if the key used to retrieve an element from a JSON object is treated as a string literal (true), or a string reference (false)</param>
-		/// <returns>The deserialization logic for the field entered</returns>
-		virtual std::string GenerateFieldDeserializeCode(const SASTField& field, const std::string& objReceiver, const std::string& jsonSource, size_t depth = 1, bool sourceIsJsonObj = true, bool treatKeyAsString = true);
+		virtual void EmitFieldDeserializeCode(CodeSink& sink, const SASTField& field, const std::string& objReceiver, const std::string& jsonSource, size_t depth = 1, bool sourceIsJsonObj = true, bool treatKeyAsString = true);
+
+		/// <summary>
+		/// Helper for generating a single pass over the members of a JSON object, dispatching each key to its field's deserialization logic.
+		/// Keys are matched through a switch on their length then first character, unknown keys are skipped, and fields not found are
+		/// set to their default value or reported as missing once the pass is complete
+		/// </summary>
+		/// <param name="sink">Receives the deserialization logic for the fields entered</param>
+		/// <param name="fields">The fields of the object to be deserialized into</param>
+		/// <param name="objReceiver">The literal text to access the object to be deserialized into</param>
+		/// <param name="jsonMembers">The literal text to access the members of the json object which is the source for the deserialization</param>
+		/// <param name="typeName">The name of the type deserialized into, used when reporting missing keys</param>
+		/// <param name="depth">Indicates the level of recursion for this call of this function</param>
+		virtual void EmitMemberDispatchCode(CodeSink& sink, const std::vector<const SASTField*>& fields, const std::string& objReceiver, const std::string& jsonMembers, const std::string& typeName, size_t depth = 1);
 
 	public:
 		/// <summary>
-		/// Generate serialization code for the given SAST node
+		/// Write serialization code for the given SAST node
 		/// </summary>
 		/// <param name="sastNode">The SAST node to generate code for</param>
-		/// <returns>The generated code</returns>
-		std::string FORMAT_PLUGIN_CALL GenerateCode(const std::shared_ptr<SASTNode> sastNode) override;
+		/// <param name="sink">Receives the generated code</param>
+		void FORMAT_PLUGIN_CALL EmitCode(const std::shared_ptr<SASTNode>& sastNode, CodeSink& sink) override;
 
 		/// <summary>
 		/// Get the name of the format (for instance JSON)
@@ -6,25 +6,109 @@
 #include <stdexcept>
 #include <memory>
 #include <vector>
+#include <map>
 
 #include <JSONStructure.h>
 
 namespace GenTools::GenSerialize
 {
 	DECLARE_FORMAT_PLUGIN(JSONFormatPlugin)
+	DECLARE_FORMAT_PLUGIN_MANIFEST(0, PLUGIN_CAPABILITY_THREAD_SAFE | PLUGIN_CAPABILITY_STREAMING, "JSON")
 	REGISTER_STATIC_PLUGIN(JSONFormatPlugin, 0);
 
 	namespace
 	{
+		std::string ToStringLiteral(const std::string& str)
+		{
+			std::string literal = "\"";
+			for (char c : str)
+			{
+				if (c == '"' || c == '\\')
+					literal += '\\';
+				literal += c;
+			}
+			return literal + "\"";
+		}
+
+		std::string ToCharLiteral(char c)
+		{
+			if (c == '\'' || c == '\\')
+				return std::string("'\\") + c + "'";
+			return std::string("'") + c + "'";
+		}
+
+		std::string ToMaskLiteral(uint64_t mask)
+		{
+			std::ostringstream oss;
+			oss << "0x" << std::hex << mask << "ull";
+			return oss.str();
+		}
+
+		std::string GetArithmeticTypeName(const SASTField& field)
+		{
+			// Without width information from the parser fall back to the declared type
+			if (field.arithmeticBits == 0)
+				return field.originalTypeName;
+
+			if (field.type == SASTType::Float)
+			{
+				switch (field.arithmeticBits)
+				{
+				case 32:
+					return "float";
+				case 64:
+					return "double";
+				default:
+					return "long double";
+				}
+			}
+
+			switch (field.arithmeticBits)
+			{
+			case 8:
+			case 16:
+			case 32:
+			case 64:
+				return (field.arithmeticSigned ? "int" : "uint") + std::to_string(field.arithmeticBits) + "_t";
+			default:
+				throw std::runtime_error("Unsupported integer width for JSON serialization: " + field.originalTypeName);
+			}
+		}
+
+		std::string GenerateNumberConstruction(const SASTField& field, const std::string& valueExpr)
+		{
+			// Integers keep their exact value, floating point values are stored as double
+			if (field.type == SASTType::Int)
+				return "JSONNumber(static_cast<" + GetArithmeticTypeName(field) + ">(" + valueExpr + "))";
+			return "JSONNumber(static_cast<double>(" + valueExpr + "))";
+		}
+
+		std::string GenerateScalarValueExpression(const SASTField& field, const std::string& jsonAccessor)
+		{
+			switch (field.type)
+			{
+			case SASTType::Int:
+			case SASTType::Float:
+				return jsonAccessor + ".as<JSONNumber>().Get<" + GetArithmeticTypeName(field) + ">()";
+
+			case SASTType::Bool:
+				return jsonAccessor + ".as<JSONBool>().value";
+
+			case SASTType::String:
+				return jsonAccessor + ".as<JSONString>().value";
+
+			default:
+				return "";
+			}
+		}
+
 		std::string GenerateKeyConversionFromString(const SASTField& keyField, const std::string& strExpr)
 		{
 			switch (keyField.type)
 			{
 			case SASTType::Int:
-				return "std::stoi(" + strExpr + ")";
-
 			case SASTType::Float:
-				return "std::stof(" + strExpr + ")";
+				return "JSONNumber::Parse(" + strExpr + ").Get<" + GetArithmeticTypeName(keyField) + ">()";
 
 			case SASTType::Bool:
 				return "(" + strExpr + " == \"true\")";
@@ -43,6 +127,8 @@ namespace GenTools::GenSerialize
 			{
 			case SASTType::Int:
 			case SASTType::Float:
+				return GenerateNumberConstruction(keyField, keyExpr) + ".ToString()";
+
 			case SASTType::Bool:
 				return "std::to_string(" + keyExpr + ")";
 
@@ -62,7 +148,7 @@ namespace GenTools::GenSerialize
 			{
 			case SASTType::Int:
 			case SASTType::Float:
-				return indent + jsonReceiver + ".AddMember(\"" + field.formattedName + "\", JSONNumber(static_cast<double>(" + fieldAccessor + ")));\n";
+				return indent + jsonReceiver + ".AddMember(\"" + field.formattedName + "\", " + GenerateNumberConstruction(field, fieldAccessor) + ");\n";
 
 			case SASTType::Bool:
 				return indent + jsonReceiver + ".AddMember(\"" + field.formattedName + "\", JSONBool(" + fieldAccessor + "));\n";
@@ -117,7 +203,7 @@ namespace GenTools::GenSerialize
 			{
 			case SASTType::Int:
 			case SASTType::Float:
-				return indent + jsonReceiver + ".AddMember(JSONNumber(static_cast<double>(" + fieldAccessor + ")));\n";
+				return indent + jsonReceiver + ".AddMember(" + GenerateNumberConstruction(field, fieldAccessor) + ");\n";
 
 			case SASTType::Bool:
 				return indent + jsonReceiver + ".AddMember(JSONBool(" + fieldAccessor + "));\n";
@@ -179,13 +265,61 @@ namespace GenTools::GenSerialize
 
 		case SASTType::Set:
 		case SASTType::Unordered_Set:
-			return "auto& " + newElementReferenceName + " = " + containerName + ".emplace();\n";
+			// Set elements are immutable, the element is built in a temporary and moved in by GenerateContainerInsertCode
+			return field.elementType->originalTypeName + " " + newElementReferenceName + "{};\n";
 
 		case SASTType::Map:
+			if (key.empty())
+				throw std::runtime_error("Key is required for Map or Unordered_Map element creation");
+			return "auto& " + newElementReferenceName + " = " + containerName + ".try_emplace(" + containerName + ".end(), " + GenerateKeyConversionFromString(*field.keyType, key) + ")->second;\n";
+
 		case SASTType::Unordered_Map:
 			if (key.empty())
 				throw std::runtime_error("Key is required for Map or Unordered_Map element creation");
-			return "auto& " + newElementReferenceName + " = " + containerName + "[" + GenerateKeyConversionFromString(*field.keyType, key) + "];\n";
+			return "auto& " + newElementReferenceName + " = " + containerName + ".try_emplace(" + GenerateKeyConversionFromString(*field.keyType, key) + ").first->second;\n";
+
+		default:
+			throw std::runtime_error("Unsupported container type for insertion");
+		}
+	}
+
+	std::string JSONFormatPlugin::GenerateContainerReserveCode(const SASTField& field, const std::string& containerName, const std::string& countExpr)
+	{
+		switch (field.type)
+		{
+		case SASTType::Vector:
+		case SASTType::Unordered_Set:
+		case SASTType::Unordered_Map:
+			return containerName + ".reserve(" + containerName + ".size() + " + countExpr + ");\n";
+
+		default:
+			// Ordered containers have no capacity, their insertions are hinted instead
+			return "";
+		}
+	}
+
+	std::string JSONFormatPlugin::GenerateContainerInsertCode(const SASTField& field, const std::string& containerName, const std::string& valueExpr, const std::string& key)
+	{
+		switch (field.type)
+		{
+		case SASTType::Vector:
+			return containerName + ".emplace_back(" + valueExpr + ");\n";
+
+		case SASTType::Set:
+			return containerName + ".emplace_hint(" + containerName + ".end(), " + valueExpr + ");\n";
+
+		case SASTType::Unordered_Set:
+			return containerName + ".emplace(" + valueExpr + ");\n";
+
+		case SASTType::Map:
+			if (key.empty())
+				throw std::runtime_error("Key is required for Map or Unordered_Map element insertion");
+			return containerName + ".insert_or_assign(" + containerName + ".end(), " + GenerateKeyConversionFromString(*field.keyType, key) + ", " + valueExpr + ");\n";
+
+		case SASTType::Unordered_Map:
+			if (key.empty())
+				throw std::runtime_error("Key is required for Map or Unordered_Map element insertion");
+			return containerName + ".insert_or_assign(" + GenerateKeyConversionFromString(*field.keyType, key) + ", " + valueExpr + ");\n";
 
 		default:
 			throw std::runtime_error("Unsupported container type for insertion");
@@ -197,10 +331,8 @@ namespace GenTools::GenSerialize
 		return "if (" + pointerName + ") delete[] " + pointerName + ";\n";
 	}
 
-	std::string JSONFormatPlugin::GenerateFieldSerializeCode(const SASTField& field, const std::string& jsonReceiver, const std::string& objSource, size_t depth, bool receiverIsJsonObj, bool generateInsertion)
+	void JSONFormatPlugin::EmitFieldSerializeCode(CodeSink& sink, const SASTField& field, const std::string& jsonReceiver, const std::string& objSource, size_t depth, bool receiverIsJsonObj, bool generateInsertion)
 	{
-		std::ostringstream oss;
-
 		std::string indent(depth, '\t');
 
 		std::string fieldAccessor = objSource;
@@ -212,11 +344,11 @@ namespace GenTools::GenSerialize
 		case SASTType::POD:
 		{
 			std::string nestedPOD = (field.name.empty() ? "nested" : field.name) + "_json";
-			oss << indent << "{\n";
-			oss << indent << "\tJSONObject " << nestedPOD << ";\n";
+			sink << indent << "{\n";
+			sink << indent << "\tJSONObject " << nestedPOD << ";\n";
 			for (auto& podField : field.objectNode->fields)
 			{
-				oss << GenerateFieldSerializeCode(podField, nestedPOD, fieldAccessor, depth + 1);
+				EmitFieldSerializeCode(sink, podField, nestedPOD, fieldAccessor, depth + 1);
 			}
 			break;
 		}
@@ -224,33 +356,33 @@ namespace GenTools::GenSerialize
 		{
 			// Call the Serialize to JSONObject function for the contained object (field)
 			std::string nestedObj = (field.name.empty() ? "nested" : field.name) + "_json";
-			oss << indent << "{\n";
-			oss << indent << "\tJSONObject " << nestedObj << ";\n";
-			oss << indent << "\tJSONSerialize(" << nestedObj << ", " << fieldAccessor << ");\n";
+			sink << indent << "{\n";
+			sink << indent << "\tJSONObject " << nestedObj << ";\n";
+			sink << indent << "\tJSONSerialize(" << nestedObj << ", " << fieldAccessor << ");\n";
 			break;
 		}
 		case SASTType::Array:
 		{
 			std::string nestedArray = (field.name.empty() ? "nested" : field.name) + "_json";
 			std::string i = "i_" + std::to_string(depth);
-			oss << indent << "{\n";
-			oss << indent << "\tJSONArray " << nestedArray << ";\n";
-			oss << indent << "\tfor(size_t " << i << " = 0; " << i << " < sizeof(" << fieldAccessor << ") / sizeof(" << fieldAccessor << "[0]); " << i << "++)\n";
-			oss << indent << "\t{\n";
-			oss << GenerateFieldSerializeCode(*field.elementType, nestedArray, fieldAccessor + "[" + i + "]", depth + 2, false);
-			oss << indent << "\t}\n";
+			sink << indent << "{\n";
+			sink << indent << "\tJSONArray " << nestedArray << ";\n";
+			sink << indent << "\tfor(size_t " << i << " = 0; " << i << " < sizeof(" << fieldAccessor << ") / sizeof(" << fieldAccessor << "[0]); " << i << "++)\n";
+			sink << indent << "\t{\n";
+			EmitFieldSerializeCode(sink, *field.elementType, nestedArray, fieldAccessor + "[" + i + "]", depth + 2, false);
+			sink << indent << "\t}\n";
 			break;
 		}
 		case SASTType::Dynamic_Array:
 		{
 			std::string nestedArray = (field.name.empty() ? "nested" : field.name) + "_json";
 			std::string i = "i_" + std::to_string(depth);
-			oss << indent << "{\n";
-			oss << indent << "\tJSONArray " << nestedArray << ";\n";
-			oss << indent << "\tfor(size_t " << i << " = 0; " << i << " < " << field.lengthVar << "; " << i << "++)\n";
-			oss << indent << "\t{\n";
-			oss << GenerateFieldSerializeCode(*field.elementType, nestedArray, fieldAccessor + "[" + i + "]", depth + 2, false);
-			oss << indent << "\t}\n";
+			sink << indent << "{\n";
+			sink << indent << "\tJSONArray " << nestedArray << ";\n";
+			sink << indent << "\tfor(size_t " << i << " = 0; " << i << " < " << field.lengthVar << "; " << i << "++)\n";
+			sink << indent << "\t{\n";
+			EmitFieldSerializeCode(sink, *field.elementType, nestedArray, fieldAccessor + "[" + i + "]", depth + 2, false);
+			sink << indent << "\t}\n";
 			break;
 		}
 		case SASTType::Vector:
@@ -259,12 +391,12 @@ namespace GenTools::GenSerialize
 		{
 			std::string nestedArray = (field.name.empty() ? "nested" : field.name) + "_json";
 			std::string item = "item_" + std::to_string(depth);
-			oss << indent << "{\n";
-			oss << indent << "\tJSONArray " << nestedArray << ";\n";
-			oss << indent << "\tfor(const auto& " << item << " : " << fieldAccessor << ")\n";
-			oss << indent << "\t{\n";
-			oss << GenerateFieldSerializeCode(*field.elementType, nestedArray, item, depth + 2, false);
-			oss << indent << "\t}\n";
+			sink << indent << "{\n";
+			sink << indent << "\tJSONArray " << nestedArray << ";\n";
+			sink << indent << "\tfor(const auto& " << item << " : " << fieldAccessor << ")\n";
+			sink << indent << "\t{\n";
+			EmitFieldSerializeCode(sink, *field.elementType, nestedArray, item, depth + 2, false);
+			sink << indent << "\t}\n";
 			break;
 		}
 		case SASTType::Map:
@@ -274,16 +406,14 @@ namespace GenTools::GenSerialize
 			std::string valueObj = (field.valueType->name.empty() ? "nested" : field.valueType->name) + "_json";
 			std::string key = "key_" + std::to_string(depth);
 			std::string value = "value_" + std::to_string(depth);
-			field.keyType->formattedName = key;
-			field.valueType->formattedName = value;
-			oss << indent << "{\n";
-			oss << indent << "\tJSONObject " << nestedObj << ";\n";
-			oss << indent << "\tfor(const auto& [" << key << ", " << value << "] : " << fieldAccessor << ")\n";
-			oss << indent << "\t{\n";
-			oss << GenerateFieldSerializeCode(*field.valueType, nestedObj, value, depth + 2, true, false);
-			oss << indent << "\t\t\t" << nestedObj << ".AddMember(" << GenerateKeyConversionToString(*field.keyType, field.keyType->formattedName) << ", std::move(" << valueObj << "));\n";
-			oss << indent << "\t\t}\n";
-			oss << indent << "\t}\n";
+			sink << indent << "{\n";
+			sink << indent << "\tJSONObject " << nestedObj << ";\n";
+			sink << indent << "\tfor(const auto& [" << key << ", " << value << "] : " << fieldAccessor << ")\n";
+			sink << indent << "\t{\n";
+			EmitFieldSerializeCode(sink, *field.valueType, nestedObj, value, depth + 2, true, false);
+			sink << indent << "\t\t\t" << nestedObj << ".AddMember(" << GenerateKeyConversionToString(*field.keyType, key) << ", std::move(" << valueObj << "));\n";
+			sink << indent << "\t\t}\n";
+			sink << indent << "\t}\n";
 			break;
 		}
 		default:
@@ -293,18 +423,15 @@ namespace GenTools::GenSerialize
 		if (generateInsertion)
 		{
 			if (receiverIsJsonObj)
-				oss << GenerateJsonObjInsertCode(field, jsonReceiver, fieldAccessor, depth);
+				sink << GenerateJsonObjInsertCode(field, jsonReceiver, fieldAccessor, depth);
 			else
-				oss << GenerateJsonArrayInsertCode(field, jsonReceiver, fieldAccessor, depth);
+				sink << GenerateJsonArrayInsertCode(field, jsonReceiver, fieldAccessor, depth);
 		}
 
-		return oss.str();
 	}
 
-	std::string JSONFormatPlugin::GenerateFieldDeserializeCode(const SASTField& field, const std::string& objReceiver, const std::string& jsonSource, size_t depth, bool sourceIsJsonObj, bool treatKeyAsString)
+	void JSONFormatPlugin::EmitFieldDeserializeCode(CodeSink& sink, const SASTField& field, const std::string& objReceiver, const std::string& jsonSource, size_t depth, bool sourceIsJsonObj, bool treatKeyAsString)
 	{
-		std::ostringstream oss;
-
 		std::string indent(depth, '\t');
 
 		std::string fieldAccessor = objReceiver;
@@ -316,97 +443,236 @@ namespace GenTools::GenSerialize
 		{
 		case SASTType::Int:
 		case SASTType::Float:
-			oss << indent << fieldAccessor << " = " << jsonAccessor << ".as<JSONNumber>().value;\n";
-			break;
-
 		case SASTType::Bool:
-			oss << indent << fieldAccessor << " = " << jsonAccessor << ".as<JSONBool>().value;\n";
-			break;
-
 		case SASTType::String:
-			oss << indent << fieldAccessor << " = " << jsonAccessor << ".as<JSONString>().value;\n";
+			sink << indent << fieldAccessor << " = " << GenerateScalarValueExpression(field, jsonAccessor) << ";\n";
 			break;
 
 		case SASTType::POD:
 		{
-			for (auto& podField : field.objectNode->fields)
+			std::vector<const SASTField*> podFields;
+			for (const auto& podField : field.objectNode->fields)
 			{
-				oss << GenerateFieldDeserializeCode(podField, fieldAccessor, jsonAccessor + ".as<JSONObject>()", depth);
+				podFields.push_back(&podField);
 			}
+
+			sink << indent << "{\n";
+			EmitMemberDispatchCode(sink, podFields, fieldAccessor, jsonAccessor + ".as<JSONObject>().GetMembers()", field.objectNode->name, depth + 1);
+			sink << indent << "}\n";
 			break;
 		}
 		case SASTType::Object:
-			oss << indent << "JSONDeserialize(" << fieldAccessor << ", " << jsonAccessor << ".as<JSONObject>());\n";
+			sink << indent << "JSONDeserialize(" << fieldAccessor << ", " << jsonAccessor << ".as<JSONObject>());\n";
 			break;
 
 		case SASTType::Array:
 		{
 			std::string nestedArray = (field.name.empty() ? "nested" : field.name) + "_json";
 			std::string i = "i_" + std::to_string(depth);
-			oss << indent << "{\n";
-			oss << indent << "\tJSONArray " << nestedArray << " = " << jsonAccessor << ".as<JSONArray>();\n";
-			oss << indent << "\tfor(size_t " << i << " = 0; " << i << " < sizeof(" << fieldAccessor << ") / sizeof(" << fieldAccessor << "[0]); " << i << "++)\n";
-			oss << indent << "\t{\n";
-			oss << GenerateFieldDeserializeCode(*field.elementType, fieldAccessor + "[" + i + "]", nestedArray + "[" + i + "]", depth + 2, false);
-			oss << indent << "\t}\n";
-			oss << indent << "}\n";
+			sink << indent << "{\n";
+			sink << indent << "\tJSONArray " << nestedArray << " = " << jsonAccessor << ".as<JSONArray>();\n";
+			sink << indent << "\tfor(size_t " << i << " = 0; " << i << " < sizeof(" << fieldAccessor << ") / sizeof(" << fieldAccessor << "[0]); " << i << "++)\n";
+			sink << indent << "\t{\n";
+			EmitFieldDeserializeCode(sink, *field.elementType, fieldAccessor + "[" + i + "]", nestedArray + "[" + i + "]", depth + 2, false);
+			sink << indent << "\t}\n";
+			sink << indent << "}\n";
 			break;
 		}
 		case SASTType::Dynamic_Array:
 		{
 			std::string nestedArray = (field.name.empty() ? "nested" : field.name) + "_json";
 			std::string i = "i_" + std::to_string(depth);
-			oss << indent << "{\n";
-			oss << indent << "\tJSONArray " << nestedArray << " = " << jsonAccessor << ".as<JSONArray>();\n";
-			oss << indent << "\t" << GenerateMemoryCleanupCode(fieldAccessor);
-			oss << indent << "\t" << GenerateArrayAllocationCode(field, fieldAccessor, nestedArray);
-			oss << indent << "\t" << field.lengthVar << " = " << nestedArray << ".GetItems().size();\n";
-			oss << indent << "\tfor(size_t " << i << " = 0; " << i << " < " << field.lengthVar << "; " << i << "++)\n";
-			oss << indent << "\t{\n";
-			oss << GenerateFieldDeserializeCode(*field.elementType, fieldAccessor + "[" + i + "]", nestedArray + "[" + i + "]", depth + 2, false);
-			oss << indent << "\t}\n";
-			oss << indent << "}\n";
+			sink << indent << "{\n";
+			sink << indent << "\tJSONArray " << nestedArray << " = " << jsonAccessor << ".as<JSONArray>();\n";
+			sink << indent << "\t" << GenerateMemoryCleanupCode(fieldAccessor);
+			sink << indent << "\t" << GenerateArrayAllocationCode(field, fieldAccessor, nestedArray);
+			sink << indent << "\t" << field.lengthVar << " = " << nestedArray << ".GetItems().size();\n";
+			sink << indent << "\tfor(size_t " << i << " = 0; " << i << " < " << field.lengthVar << "; " << i << "++)\n";
+			sink << indent << "\t{\n";
+			EmitFieldDeserializeCode(sink, *field.elementType, fieldAccessor + "[" + i + "]", nestedArray + "[" + i + "]", depth + 2, false);
+			sink << indent << "\t}\n";
+			sink << indent << "}\n";
 			break;
 		}
 		case SASTType::Vector:
 		case SASTType::Set:
 		case SASTType::Unordered_Set:
 		{
+			std::string items = "items_" + std::to_string(depth);
 			std::string item = "item_" + std::to_string(depth);
 			std::string temp = "elem_" + std::to_string(depth);
-			oss << indent << "{\n";
-			oss << indent << "\tfor(const auto& " << item << " : " << jsonAccessor << ".as<JSONArray>().GetItems())\n";
-			oss << indent << "\t{\n";
-			oss << indent << "\t\t" << GenerateNewContainerElementCode(field, fieldAccessor, temp);
-			oss << GenerateFieldDeserializeCode(*field.elementType, temp, item, depth + 2, false);
-			oss << indent << "\t}\n";
-			oss << indent << "}\n";
+			std::string scalarValue = GenerateScalarValueExpression(*field.elementType, item);
+			std::string reserve = GenerateContainerReserveCode(field, fieldAccessor, items + ".size()");
+			sink << indent << "{\n";
+			sink << indent << "\tconst auto& " << items << " = " << jsonAccessor << ".as<JSONArray>().GetItems();\n";
+			if (!reserve.empty())
+				sink << indent << "\t" << reserve;
+			sink << indent << "\tfor(const auto& " << item << " : " << items << ")\n";
+			sink << indent << "\t{\n";
+			if (!scalarValue.empty())
+			{
+				// Scalars are constructed directly in the container from the parsed value
+				sink << indent << "\t\t" << GenerateContainerInsertCode(field, fieldAccessor, scalarValue);
+			}
+			else
+			{
+				sink << indent << "\t\t" << GenerateNewContainerElementCode(field, fieldAccessor, temp);
+				EmitFieldDeserializeCode(sink, *field.elementType, temp, item, depth + 2, false);
+				if (field.type != SASTType::Vector)
+					sink << indent << "\t\t" << GenerateContainerInsertCode(field, fieldAccessor, "std::move(" + temp + ")");
+			}
+			sink << indent << "\t}\n";
+			sink << indent << "}\n";
 			break;
 		}
 		case SASTType::Map:
 		case SASTType::Unordered_Map:
 		{
+			std::string members = "members_" + std::to_string(depth);
 			std::string key = "key_" + std::to_string(depth);
 			std::string value = "value_" + std::to_string(depth);
 			std::string temp = "elem_" + std::to_string(depth);
-			field.valueType->formattedName = key;
-			oss << indent << "{\n";
-			oss << indent << "\tfor(const auto& [" << key << ", " << value << "] : " << jsonAccessor << ".as<JSONObject>().GetMembers())\n";
-			oss << indent << "\t{\n";
-			oss << indent << "\t\t" << GenerateNewContainerElementCode(field, fieldAccessor, temp, key);
-			oss << GenerateFieldDeserializeCode(*field.valueType, temp, value, depth + 2, false, false);
-			oss << indent << "\t}\n";
-			oss << indent << "}\n";
+			std::string scalarValue = GenerateScalarValueExpression(*field.valueType, value);
+			std::string reserve = GenerateContainerReserveCode(field, fieldAccessor, members + ".size()");
+			sink << indent << "{\n";
+			sink << indent << "\tconst auto& " << members << " = " << jsonAccessor << ".as<JSONObject>().GetMembers();\n";
+			if (!reserve.empty())
+				sink << indent << "\t" << reserve;
+			sink << indent << "\tfor(const auto& [" << key << ", " << value << "] : " << members << ")\n";
+			sink << indent << "\t{\n";
+			if (!scalarValue.empty())
+			{
+				sink << indent << "\t\t" << GenerateContainerInsertCode(field, fieldAccessor, scalarValue, key);
+			}
+			else
+			{
+				// The element is created in place with its converted key, then deserialized into
+				sink << indent << "\t\t" << GenerateNewContainerElementCode(field, fieldAccessor, temp, key);
+				EmitFieldDeserializeCode(sink, *field.valueType, temp, value, depth + 2, false, false);
+			}
+			sink << indent << "\t}\n";
+			sink << indent << "}\n";
 			break;
 		}
 		default:
 			throw std::runtime_error("Unsupported field type");
 		}
 
-		return oss.str();
 	}
 
-	std::string JSONFormatPlugin::GenerateCode(const std::shared_ptr<SASTNode> sastNode)
+	void JSONFormatPlugin::EmitMemberDispatchCode(CodeSink& sink, const std::vector<const SASTField*>& fields, const std::string& objReceiver, const std::string& jsonMembers, const std::string& typeName, size_t depth)
+	{
+		std::string indent(depth, '\t');
+		std::string key = "key_" + std::to_string(depth);
+		std::string value = "value_" + std::to_string(depth);
+		std::string found = "found_" + std::to_string(depth);
+
+		size_t maskWords = (fields.size() + 63) / 64;
+		auto maskWord = [&](size_t index) { return found + "[" + std::to_string(index / 64) + "]"; };
+		auto maskBit = [](size_t index) { return ToMaskLiteral(uint64_t(1) << (index % 64)); };
+
+		// Group the keys by length, then by first character, so a key is compared in full against at most a handful of candidates
+		std::map<size_t, std::map<char, std::vector<size_t>>> keyGroups;
+		for (size_t i = 0; i < fields.size(); ++i)
+		{
+			const std::string& name = fields[i]->formattedName;
+			if (name.empty())
+				throw std::runtime_error("Field '" + fields[i]->name + "' of " + typeName + " has an empty serialized name");
+
+			keyGroups[name.size()][name.front()].push_back(i);
+		}
+
+		auto generateMatches = [&](const std::vector<size_t>& candidates, const std::string& caseIndent)
+		{
+			for (size_t c = 0; c < candidates.size(); ++c)
+			{
+				size_t i = candidates[c];
+				sink << caseIndent << (c == 0 ? "if(" : "else if(") << key << " == " << ToStringLiteral(fields[i]->formattedName) << ")\n";
+				sink << caseIndent << "{\n";
+				EmitFieldDeserializeCode(sink, *fields[i], objReceiver, value, caseIndent.size() + 1, false);
+				sink << caseIndent << "\t" << maskWord(i) << " |= " << maskBit(i) << ";\n";
+				sink << caseIndent << "}\n";
+			}
+			sink << caseIndent << "break;\n";
+		};
+
+		if (maskWords != 0)
+			sink << indent << "uint64_t " << found << "[" << maskWords << "] = {};\n";
+		sink << indent << "for(const auto& [" << key << ", " << value << "] : " << jsonMembers << ")\n";
+		sink << indent << "{\n";
+		sink << indent << "\tswitch(" << key << ".size())\n";
+		sink << indent << "\t{\n";
+		for (const auto& [length, byFirstChar] : keyGroups)
+		{
+			sink << indent << "\tcase " << length << ":\n";
+			if (byFirstChar.size() == 1)
+			{
+				generateMatches(byFirstChar.begin()->second, indent + "\t\t");
+				continue;
+			}
+
+			sink << indent << "\t\tswitch(" << key << "[0])\n";
+			sink << indent << "\t\t{\n";
+			for (const auto& [firstChar, candidates] : byFirstChar)
+			{
+				sink << indent << "\t\tcase " << ToCharLiteral(firstChar) << ":\n";
+				generateMatches(candidates, indent + "\t\t\t");
+			}
+			sink << indent << "\t\tdefault:\n";
+			sink << indent << "\t\t\tbreak;\n";
+			sink << indent << "\t\t}\n";
+			sink << indent << "\t\tbreak;\n";
+		}
+		sink << indent << "\tdefault:\n";
+		sink << indent << "\t\tbreak;\n";
+		sink << indent << "\t}\n";
+		sink << indent << "}\n";
+
+		// Fields with a default value are optional, every other field must have been found
+		std::vector<uint64_t> requiredMask(maskWords, 0);
+		for (size_t i = 0; i < fields.size(); ++i)
+		{
+			if (!fields[i]->defaultValue.empty())
+			{
+				// Brace initialized, so a default of several arguments constructs the value instead of being a comma expression
+				std::string member = objReceiver + "." + fields[i]->name;
+				const std::string& defaultValue = fields[i]->defaultValue;
+				std::string initializer = defaultValue.front() == '{' ? defaultValue : "{ " + defaultValue + " }";
+				sink << indent << "if((" << maskWord(i) << " & " << maskBit(i) << ") == 0)\n";
+				sink << indent << "\t" << member << " = decltype(" << member << ")" << initializer << ";\n";
+			}
+			else
+				requiredMask[i / 64] |= uint64_t(1) << (i % 64);
+		}
+
+		std::string requiredCheck;
+		for (size_t w = 0; w < maskWords; ++w)
+		{
+			if (requiredMask[w] == 0)
+				continue;
+
+			std::string word = found + "[" + std::to_string(w) + "]";
+			requiredCheck += (requiredCheck.empty() ? "" : " || ") + std::string("(") + word + " & " + ToMaskLiteral(requiredMask[w]) + ") != " + ToMaskLiteral(requiredMask[w]);
+		}
+
+		if (!requiredCheck.empty())
+		{
+			std::string missing = "missing_" + std::to_string(depth);
+			sink << indent << "if(" << requiredCheck << ")\n";
+			sink << indent << "{\n";
+			sink << indent << "\tstd::string " << missing << ";\n";
+			for (size_t i = 0; i < fields.size(); ++i)
+			{
+				if (fields[i]->defaultValue.empty())
+					sink << indent << "\tif((" << maskWord(i) << " & " << maskBit(i) << ") == 0) " << missing << " += " << ToStringLiteral(" " + fields[i]->formattedName) << ";\n";
+			}
+			sink << indent << "\tthrow std::runtime_error(" << ToStringLiteral("Missing required key(s) in JSON object for " + typeName + ":") << " + " << missing << ");\n";
+			sink << indent << "}\n";
+		}
+
+	}
+
+	void JSONFormatPlugin::EmitCode(const std::shared_ptr<SASTNode>& sastNode, CodeSink& sink)
 	{
 		// Build a flattened list of fields: for POD types use only the node's fields,
 		// otherwise add base class fields (only if accessible) then own fields
@@ -424,65 +690,57 @@ namespace GenTools::GenSerialize
 			flattenedFields.push_back(&field);
 		}
 
-		std::ostringstream oss;
-
 		// Function signature for the serialization function
-		oss << "#include <fstream>\n\n";
+		sink << "#include <fstream>\n\n";
 
 
-		oss << "#include <JSONStructure.h>\n\n";
+		sink << "#include <JSONStructure.h>\n\n";
 
 		// Generate the Serialize to JSONObject function
-		oss << "static void JSONSerialize(JSONObject& jsonReceiver, const " << sastNode->name << "& objSource)\n";
-		oss << "{\n";
+		sink << "static void JSONSerialize(JSONObject& jsonReceiver, const " << sastNode->name << "& objSource)\n";
+		sink << "{\n";
 
 		// Generate code for each flattened field
 		for (const auto& field : flattenedFields)
 		{
-			oss << GenerateFieldSerializeCode(*field, "jsonReceiver", "objSource") << "\n";
+			EmitFieldSerializeCode(sink, *field, "jsonReceiver", "objSource");
+			sink << "\n";
 		}
 
-		oss << "}\n\n";
+		sink << "}\n\n";
 
 		// Generate the Deserialize to JSONObject function
-		oss << "static void JSONDeserialize(" << sastNode->name << "& objReceiver, const JSONObject& jsonSource)\n";
-		oss << "{\n";
+		sink << "static void JSONDeserialize(" << sastNode->name << "& objReceiver, const JSONObject& jsonSource)\n";
+		sink << "{\n";
 
-		for (const auto& field : flattenedFields)
-		{
-			oss << GenerateFieldDeserializeCode(*field, "objReceiver", "jsonSource") << "\n";
-		}
+		EmitMemberDispatchCode(sink, flattenedFields, "objReceiver", "jsonSource.GetMembers()", sastNode->name);
 
-		oss << "}\n\n";
+		sink << "}\n\n";
 
 		// Generate the Serialize to stream function
-		oss << "static void JSONSerialize(std::ostream& osReceiver, const " << sastNode->name << "& objSource)\n";
-		oss << "{\n";
-		oss << "\tJSONStructure jsonRep;\n";
+		sink << "static void JSONSerialize(std::ostream& osReceiver, const " << sastNode->name << "& objSource)\n";
+		sink << "{\n";
+		sink << "\tJSONStructure jsonRep;\n";
 
 		// Generate code for each flattened field
 		for (const auto& field : flattenedFields)
 		{
-			oss << GenerateFieldSerializeCode(*field, "jsonRep", "objSource") << "\n";
+			EmitFieldSerializeCode(sink, *field, "jsonRep", "objSource");
+			sink << "\n";
 		}
 
-		oss << "\tosReceiver << jsonRep.Stringify();\n";
-		oss << "}\n\n";
+		sink << "\tosReceiver << jsonRep.Stringify();\n";
+		sink << "}\n\n";
 
 		// Generate the Deserialize from stream function
-		oss << "static void JSONDeserialize(" << sastNode->name << "& objReceiver, const std::istream& isSource)\n";
-		oss << "{\n";
-		oss << "\tJSONStructure jsonRep = JSONStructure::Parse(isSource);\n";
+		sink << "static void JSONDeserialize(" << sastNode->name << "& objReceiver, const std::istream& isSource)\n";
+		sink << "{\n";
+		sink << "\tJSONStructure jsonRep = JSONStructure::Parse(isSource);\n";
 
-		// Generate code for each flattened field
-		for (const auto& field : flattenedFields)
-		{
-			oss << GenerateFieldDeserializeCode(*field, "objReceiver", "jsonRep") << "\n";
-		}
+		EmitMemberDispatchCode(sink, flattenedFields, "objReceiver", "jsonRep.GetMembers()", sastNode->name);
 
-		oss << "}\n";
+		sink << "}\n";
 
-		return oss.str();
 	}
 
 	std::string JSONFormatPlugin::GetFormatName() const noexcept
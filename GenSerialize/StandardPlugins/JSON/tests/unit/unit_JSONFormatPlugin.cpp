@@ -168,7 +168,7 @@ static void JSONSerialize(JSONObject& jsonReceiver, const VectorType& objSource)
 		JSONArray intVec_json;
 		for(const auto& item_1 : objSource.intVec)
 		{
-			intVec_json.AddMember(JSONNumber(static_cast<double>(item_1)));
+			intVec_json.AddMember(JSONNumber(static_cast<int32_t>(item_1)));
 		}
 		jsonReceiver.AddMember("intVec", std::move(intVec_json));
 	}
@@ -177,14 +177,35 @@ static void JSONSerialize(JSONObject& jsonReceiver, const VectorType& objSource)
 
 static void JSONDeserialize(VectorType& objReceiver, const JSONObject& jsonSource)
 {
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonSource.GetMembers())
 	{
-		for(const auto& item_1 : jsonSource.GetMember("intVec").as<JSONArray>().GetItems())
+		switch(key_1.size())
 		{
-			auto& elem_1 = objReceiver.intVec.emplace_back();
-			elem_1 = item_1.as<JSONNumber>().value;
+		case 6:
+			if(key_1 == "intVec")
+			{
+				{
+					const auto& items_4 = value_1.as<JSONArray>().GetItems();
+					objReceiver.intVec.reserve(objReceiver.intVec.size() + items_4.size());
+					for(const auto& item_4 : items_4)
+					{
+						objReceiver.intVec.emplace_back(item_4.as<JSONNumber>().Get<int32_t>());
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " intVec";
+		throw std::runtime_error("Missing required key(s) in JSON object for VectorType:" + missing_1);
+	}
 }
 
 static void JSONSerialize(std::ostream& osReceiver, const VectorType& objSource)
@@ -194,7 +215,7 @@ static void JSONSerialize(std::ostream& osReceiver, const VectorType& objSource)
 		JSONArray intVec_json;
 		for(const auto& item_1 : objSource.intVec)
 		{
-			intVec_json.AddMember(JSONNumber(static_cast<double>(item_1)));
+			intVec_json.AddMember(JSONNumber(static_cast<int32_t>(item_1)));
 		}
 		jsonRep.AddMember("intVec", std::move(intVec_json));
 	}
@@ -205,14 +226,35 @@ static void JSONSerialize(std::ostream& osReceiver, const VectorType& objSource)
 static void JSONDeserialize(VectorType& objReceiver, const std::istream& isSource)
 {
 	JSONStructure jsonRep = JSONStructure::Parse(isSource);
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonRep.GetMembers())
 	{
-		for(const auto& item_1 : jsonRep.GetMember("intVec").as<JSONArray>().GetItems())
+		switch(key_1.size())
 		{
-			auto& elem_1 = objReceiver.intVec.emplace_back();
-			elem_1 = item_1.as<JSONNumber>().value;
+		case 6:
+			if(key_1 == "intVec")
+			{
+				{
+					const auto& items_4 = value_1.as<JSONArray>().GetItems();
+					objReceiver.intVec.reserve(objReceiver.intVec.size() + items_4.size());
+					for(const auto& item_4 : items_4)
+					{
+						objReceiver.intVec.emplace_back(item_4.as<JSONNumber>().Get<int32_t>());
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " intVec";
+		throw std::runtime_error("Missing required key(s) in JSON object for VectorType:" + missing_1);
+	}
 }
 )cpp";
 
@@ -261,9 +303,9 @@ static void JSONSerialize(JSONObject& jsonReceiver, const MyType& objSource)
 		{
 			{
 				JSONObject nested_json;
-				nested_json.AddMember("a", JSONNumber(static_cast<double>(value_1.a)));
+				nested_json.AddMember("a", JSONNumber(static_cast<int32_t>(value_1.a)));
 				nested_json.AddMember("b", JSONString(value_1.b));
-				podMap_json.AddMember(std::to_string(key_1), std::move(nested_json));
+				podMap_json.AddMember(JSONNumber(static_cast<int32_t>(key_1)).ToString(), std::move(nested_json));
 			}
 		}
 		jsonReceiver.AddMember("podMap", std::move(podMap_json));
@@ -273,15 +315,74 @@ static void JSONSerialize(JSONObject& jsonReceiver, const MyType& objSource)
 
 static void JSONDeserialize(MyType& objReceiver, const JSONObject& jsonSource)
 {
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonSource.GetMembers())
 	{
-		for(const auto& [key_1, value_1] : jsonSource.GetMember("podMap").as<JSONObject>().GetMembers())
+		switch(key_1.size())
 		{
-			auto& elem_1 = objReceiver.podMap[std::stoi(key_1)];
-			elem_1.a = value_1.as<JSONObject>().GetMember("a").as<JSONNumber>().value;
-			elem_1.b = value_1.as<JSONObject>().GetMember("b").as<JSONString>().value;
+		case 6:
+			if(key_1 == "podMap")
+			{
+				{
+					const auto& members_4 = value_1.as<JSONObject>().GetMembers();
+					objReceiver.podMap.reserve(objReceiver.podMap.size() + members_4.size());
+					for(const auto& [key_4, value_4] : members_4)
+					{
+						auto& elem_4 = objReceiver.podMap.try_emplace(JSONNumber::Parse(key_4).Get<int32_t>()).first->second;
+						{
+							uint64_t found_7[1] = {};
+							for(const auto& [key_7, value_7] : value_4.as<JSONObject>().GetMembers())
+							{
+								switch(key_7.size())
+								{
+								case 1:
+									switch(key_7[0])
+									{
+									case 'a':
+										if(key_7 == "a")
+										{
+											elem_4.a = value_7.as<JSONNumber>().Get<int32_t>();
+											found_7[0] |= 0x1ull;
+										}
+										break;
+									case 'b':
+										if(key_7 == "b")
+										{
+											elem_4.b = value_7.as<JSONString>().value;
+											found_7[0] |= 0x2ull;
+										}
+										break;
+									default:
+										break;
+									}
+									break;
+								default:
+									break;
+								}
+							}
+							if((found_7[0] & 0x3ull) != 0x3ull)
+							{
+								std::string missing_7;
+								if((found_7[0] & 0x1ull) == 0) missing_7 += " a";
+								if((found_7[0] & 0x2ull) == 0) missing_7 += " b";
+								throw std::runtime_error("Missing required key(s) in JSON object for POD:" + missing_7);
+							}
+						}
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " podMap";
+		throw std::runtime_error("Missing required key(s) in JSON object for MyType:" + missing_1);
+	}
 }
 
 static void JSONSerialize(std::ostream& osReceiver, const MyType& objSource)
@@ -293,9 +394,9 @@ static void JSONSerialize(std::ostream& osReceiver, const MyType& objSource)
 		{
 			{
 				JSONObject nested_json;
-				nested_json.AddMember("a", JSONNumber(static_cast<double>(value_1.a)));
+				nested_json.AddMember("a", JSONNumber(static_cast<int32_t>(value_1.a)));
 				nested_json.AddMember("b", JSONString(value_1.b));
-				podMap_json.AddMember(std::to_string(key_1), std::move(nested_json));
+				podMap_json.AddMember(JSONNumber(static_cast<int32_t>(key_1)).ToString(), std::move(nested_json));
 			}
 		}
 		jsonRep.AddMember("podMap", std::move(podMap_json));
@@ -307,15 +408,74 @@ static void JSONSerialize(std::ostream& osReceiver, const MyType& objSource)
 static void JSONDeserialize(MyType& objReceiver, const std::istream& isSource)
 {
 	JSONStructure jsonRep = JSONStructure::Parse(isSource);
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonRep.GetMembers())
 	{
-		for(const auto& [key_1, value_1] : jsonRep.GetMember("podMap").as<JSONObject>().GetMembers())
+		switch(key_1.size())
 		{
-			auto& elem_1 = objReceiver.podMap[std::stoi(key_1)];
-			elem_1.a = value_1.as<JSONObject>().GetMember("a").as<JSONNumber>().value;
-			elem_1.b = value_1.as<JSONObject>().GetMember("b").as<JSONString>().value;
+		case 6:
+			if(key_1 == "podMap")
+			{
+				{
+					const auto& members_4 = value_1.as<JSONObject>().GetMembers();
+					objReceiver.podMap.reserve(objReceiver.podMap.size() + members_4.size());
+					for(const auto& [key_4, value_4] : members_4)
+					{
+						auto& elem_4 = objReceiver.podMap.try_emplace(JSONNumber::Parse(key_4).Get<int32_t>()).first->second;
+						{
+							uint64_t found_7[1] = {};
+							for(const auto& [key_7, value_7] : value_4.as<JSONObject>().GetMembers())
+							{
+								switch(key_7.size())
+								{
+								case 1:
+									switch(key_7[0])
+									{
+									case 'a':
+										if(key_7 == "a")
+										{
+											elem_4.a = value_7.as<JSONNumber>().Get<int32_t>();
+											found_7[0] |= 0x1ull;
+										}
+										break;
+									case 'b':
+										if(key_7 == "b")
+										{
+											elem_4.b = value_7.as<JSONString>().value;
+											found_7[0] |= 0x2ull;
+										}
+										break;
+									default:
+										break;
+									}
+									break;
+								default:
+									break;
+								}
+							}
+							if((found_7[0] & 0x3ull) != 0x3ull)
+							{
+								std::string missing_7;
+								if((found_7[0] & 0x1ull) == 0) missing_7 += " a";
+								if((found_7[0] & 0x2ull) == 0) missing_7 += " b";
+								throw std::runtime_error("Missing required key(s) in JSON object for POD:" + missing_7);
+							}
+						}
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " podMap";
+		throw std::runtime_error("Missing required key(s) in JSON object for MyType:" + missing_1);
+	}
 }
 )cpp";
 
@@ -373,8 +533,28 @@ static void JSONSerialize(JSONObject& jsonReceiver, const OuterObject& objSource
 
 static void JSONDeserialize(OuterObject& objReceiver, const JSONObject& jsonSource)
 {
-	JSONDeserialize(objReceiver.obj, jsonSource.GetMember("obj").as<JSONObject>());
-
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonSource.GetMembers())
+	{
+		switch(key_1.size())
+		{
+		case 3:
+			if(key_1 == "obj")
+			{
+				JSONDeserialize(objReceiver.obj, value_1.as<JSONObject>());
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " obj";
+		throw std::runtime_error("Missing required key(s) in JSON object for OuterObject:" + missing_1);
+	}
 }
 
 static void JSONSerialize(std::ostream& osReceiver, const OuterObject& objSource)
@@ -392,8 +572,28 @@ static void JSONSerialize(std::ostream& osReceiver, const OuterObject& objSource
 static void JSONDeserialize(OuterObject& objReceiver, const std::istream& isSource)
 {
 	JSONStructure jsonRep = JSONStructure::Parse(isSource);
-	JSONDeserialize(objReceiver.obj, jsonRep.GetMember("obj").as<JSONObject>());
-
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonRep.GetMembers())
+	{
+		switch(key_1.size())
+		{
+		case 3:
+			if(key_1 == "obj")
+			{
+				JSONDeserialize(objReceiver.obj, value_1.as<JSONObject>());
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " obj";
+		throw std::runtime_error("Missing required key(s) in JSON object for OuterObject:" + missing_1);
+	}
 }
 )cpp";
 
@@ -441,7 +641,7 @@ static void JSONSerialize(JSONObject& jsonReceiver, const StaticArrayType& objSo
 		JSONArray fixedArray_json;
 		for(size_t i_1 = 0; i_1 < sizeof(objSource.fixedArray) / sizeof(objSource.fixedArray[0]); i_1++)
 		{
-			fixedArray_json.AddMember(JSONNumber(static_cast<double>(objSource.fixedArray[i_1])));
+			fixedArray_json.AddMember(JSONNumber(static_cast<int32_t>(objSource.fixedArray[i_1])));
 		}
 		jsonReceiver.AddMember("fixedArray", std::move(fixedArray_json));
 	}
@@ -450,14 +650,34 @@ static void JSONSerialize(JSONObject& jsonReceiver, const StaticArrayType& objSo
 
 static void JSONDeserialize(StaticArrayType& objReceiver, const JSONObject& jsonSource)
 {
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonSource.GetMembers())
 	{
-		JSONArray fixedArray_json = jsonSource.GetMember("fixedArray").as<JSONArray>();
-		for(size_t i_1 = 0; i_1 < sizeof(objReceiver.fixedArray) / sizeof(objReceiver.fixedArray[0]); i_1++)
+		switch(key_1.size())
 		{
-			objReceiver.fixedArray[i_1] = fixedArray_json[i_1].as<JSONNumber>().value;
+		case 10:
+			if(key_1 == "fixedArray")
+			{
+				{
+					JSONArray fixedArray_json = value_1.as<JSONArray>();
+					for(size_t i_4 = 0; i_4 < sizeof(objReceiver.fixedArray) / sizeof(objReceiver.fixedArray[0]); i_4++)
+					{
+						objReceiver.fixedArray[i_4] = fixedArray_json[i_4].as<JSONNumber>().Get<int32_t>();
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " fixedArray";
+		throw std::runtime_error("Missing required key(s) in JSON object for StaticArrayType:" + missing_1);
+	}
 }
 
 static void JSONSerialize(std::ostream& osReceiver, const StaticArrayType& objSource)
@@ -467,7 +687,7 @@ static void JSONSerialize(std::ostream& osReceiver, const StaticArrayType& objSo
 		JSONArray fixedArray_json;
 		for(size_t i_1 = 0; i_1 < sizeof(objSource.fixedArray) / sizeof(objSource.fixedArray[0]); i_1++)
 		{
-			fixedArray_json.AddMember(JSONNumber(static_cast<double>(objSource.fixedArray[i_1])));
+			fixedArray_json.AddMember(JSONNumber(static_cast<int32_t>(objSource.fixedArray[i_1])));
 		}
 		jsonRep.AddMember("fixedArray", std::move(fixedArray_json));
 	}
@@ -478,14 +698,34 @@ static void JSONSerialize(std::ostream& osReceiver, const StaticArrayType& objSo
 static void JSONDeserialize(StaticArrayType& objReceiver, const std::istream& isSource)
 {
 	JSONStructure jsonRep = JSONStructure::Parse(isSource);
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonRep.GetMembers())
 	{
-		JSONArray fixedArray_json = jsonRep.GetMember("fixedArray").as<JSONArray>();
-		for(size_t i_1 = 0; i_1 < sizeof(objReceiver.fixedArray) / sizeof(objReceiver.fixedArray[0]); i_1++)
+		switch(key_1.size())
 		{
-			objReceiver.fixedArray[i_1] = fixedArray_json[i_1].as<JSONNumber>().value;
+		case 10:
+			if(key_1 == "fixedArray")
+			{
+				{
+					JSONArray fixedArray_json = value_1.as<JSONArray>();
+					for(size_t i_4 = 0; i_4 < sizeof(objReceiver.fixedArray) / sizeof(objReceiver.fixedArray[0]); i_4++)
+					{
+						objReceiver.fixedArray[i_4] = fixedArray_json[i_4].as<JSONNumber>().Get<int32_t>();
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " fixedArray";
+		throw std::runtime_error("Missing required key(s) in JSON object for StaticArrayType:" + missing_1);
+	}
 }
 )cpp";
 
@@ -535,7 +775,7 @@ static void JSONSerialize(JSONObject& jsonReceiver, const DynamicArrayType& objS
 		JSONArray dynamicArray_json;
 		for(size_t i_1 = 0; i_1 < arraySize; i_1++)
 		{
-			dynamicArray_json.AddMember(JSONNumber(static_cast<double>(objSource.dynamicArray[i_1])));
+			dynamicArray_json.AddMember(JSONNumber(static_cast<int32_t>(objSource.dynamicArray[i_1])));
 		}
 		jsonReceiver.AddMember("dynamicArray", std::move(dynamicArray_json));
 	}
@@ -544,17 +784,37 @@ static void JSONSerialize(JSONObject& jsonReceiver, const DynamicArrayType& objS
 
 static void JSONDeserialize(DynamicArrayType& objReceiver, const JSONObject& jsonSource)
 {
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonSource.GetMembers())
 	{
-		JSONArray dynamicArray_json = jsonSource.GetMember("dynamicArray").as<JSONArray>();
-		if (objReceiver.dynamicArray) delete[] objReceiver.dynamicArray;
-		objReceiver.dynamicArray = new int[dynamicArray_json.GetItems().size()];
-		arraySize = dynamicArray_json.GetItems().size();
-		for(size_t i_1 = 0; i_1 < arraySize; i_1++)
+		switch(key_1.size())
 		{
-			objReceiver.dynamicArray[i_1] = dynamicArray_json[i_1].as<JSONNumber>().value;
+		case 12:
+			if(key_1 == "dynamicArray")
+			{
+				{
+					JSONArray dynamicArray_json = value_1.as<JSONArray>();
+					if (objReceiver.dynamicArray) delete[] objReceiver.dynamicArray;
+					objReceiver.dynamicArray = new int[dynamicArray_json.GetItems().size()];
+					arraySize = dynamicArray_json.GetItems().size();
+					for(size_t i_4 = 0; i_4 < arraySize; i_4++)
+					{
+						objReceiver.dynamicArray[i_4] = dynamicArray_json[i_4].as<JSONNumber>().Get<int32_t>();
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " dynamicArray";
+		throw std::runtime_error("Missing required key(s) in JSON object for DynamicArrayType:" + missing_1);
+	}
 }
 
 static void JSONSerialize(std::ostream& osReceiver, const DynamicArrayType& objSource)
@@ -564,7 +824,7 @@ static void JSONSerialize(std::ostream& osReceiver, const DynamicArrayType& objS
 		JSONArray dynamicArray_json;
 		for(size_t i_1 = 0; i_1 < arraySize; i_1++)
 		{
-			dynamicArray_json.AddMember(JSONNumber(static_cast<double>(objSource.dynamicArray[i_1])));
+			dynamicArray_json.AddMember(JSONNumber(static_cast<int32_t>(objSource.dynamicArray[i_1])));
 		}
 		jsonRep.AddMember("dynamicArray", std::move(dynamicArray_json));
 	}
@@ -575,17 +835,37 @@ static void JSONSerialize(std::ostream& osReceiver, const DynamicArrayType& objS
 static void JSONDeserialize(DynamicArrayType& objReceiver, const std::istream& isSource)
 {
 	JSONStructure jsonRep = JSONStructure::Parse(isSource);
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonRep.GetMembers())
 	{
-		JSONArray dynamicArray_json = jsonRep.GetMember("dynamicArray").as<JSONArray>();
-		if (objReceiver.dynamicArray) delete[] objReceiver.dynamicArray;
-		objReceiver.dynamicArray = new int[dynamicArray_json.GetItems().size()];
-		arraySize = dynamicArray_json.GetItems().size();
-		for(size_t i_1 = 0; i_1 < arraySize; i_1++)
+		switch(key_1.size())
 		{
-			objReceiver.dynamicArray[i_1] = dynamicArray_json[i_1].as<JSONNumber>().value;
+		case 12:
+			if(key_1 == "dynamicArray")
+			{
+				{
+					JSONArray dynamicArray_json = value_1.as<JSONArray>();
+					if (objReceiver.dynamicArray) delete[] objReceiver.dynamicArray;
+					objReceiver.dynamicArray = new int[dynamicArray_json.GetItems().size()];
+					arraySize = dynamicArray_json.GetItems().size();
+					for(size_t i_4 = 0; i_4 < arraySize; i_4++)
+					{
+						objReceiver.dynamicArray[i_4] = dynamicArray_json[i_4].as<JSONNumber>().Get<int32_t>();
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " dynamicArray";
+		throw std::runtime_error("Missing required key(s) in JSON object for DynamicArrayType:" + missing_1);
+	}
 }
 )cpp";
 
@@ -638,7 +918,7 @@ static void JSONSerialize(JSONObject& jsonReceiver, const MultiArrayType& objSou
 				JSONArray nested_json;
 				for(size_t i_3 = 0; i_3 < sizeof(objSource.grid[i_1]) / sizeof(objSource.grid[i_1][0]); i_3++)
 				{
-					nested_json.AddMember(JSONNumber(static_cast<double>(objSource.grid[i_1][i_3])));
+					nested_json.AddMember(JSONNumber(static_cast<int32_t>(objSource.grid[i_1][i_3])));
 				}
 				grid_json.AddMember(std::move(nested_json));
 			}
@@ -650,20 +930,40 @@ static void JSONSerialize(JSONObject& jsonReceiver, const MultiArrayType& objSou
 
 static void JSONDeserialize(MultiArrayType& objReceiver, const JSONObject& jsonSource)
 {
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonSource.GetMembers())
 	{
-		JSONArray grid_json = jsonSource.GetMember("grid").as<JSONArray>();
-		for(size_t i_1 = 0; i_1 < sizeof(objReceiver.grid) / sizeof(objReceiver.grid[0]); i_1++)
+		switch(key_1.size())
 		{
+		case 4:
+			if(key_1 == "grid")
 			{
-				JSONArray nested_json = grid_json[i_1].as<JSONArray>();
-				for(size_t i_3 = 0; i_3 < sizeof(objReceiver.grid[i_1]) / sizeof(objReceiver.grid[i_1][0]); i_3++)
 				{
-					objReceiver.grid[i_1][i_3] = nested_json[i_3].as<JSONNumber>().value;
+					JSONArray grid_json = value_1.as<JSONArray>();
+					for(size_t i_4 = 0; i_4 < sizeof(objReceiver.grid) / sizeof(objReceiver.grid[0]); i_4++)
+					{
+						{
+							JSONArray nested_json = grid_json[i_4].as<JSONArray>();
+							for(size_t i_6 = 0; i_6 < sizeof(objReceiver.grid[i_4]) / sizeof(objReceiver.grid[i_4][0]); i_6++)
+							{
+								objReceiver.grid[i_4][i_6] = nested_json[i_6].as<JSONNumber>().Get<int32_t>();
+							}
+						}
+					}
 				}
+				found_1[0] |= 0x1ull;
 			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " grid";
+		throw std::runtime_error("Missing required key(s) in JSON object for MultiArrayType:" + missing_1);
+	}
 }
 
 static void JSONSerialize(std::ostream& osReceiver, const MultiArrayType& objSource)
@@ -677,7 +977,7 @@ static void JSONSerialize(std::ostream& osReceiver, const MultiArrayType& objSou
 				JSONArray nested_json;
 				for(size_t i_3 = 0; i_3 < sizeof(objSource.grid[i_1]) / sizeof(objSource.grid[i_1][0]); i_3++)
 				{
-					nested_json.AddMember(JSONNumber(static_cast<double>(objSource.grid[i_1][i_3])));
+					nested_json.AddMember(JSONNumber(static_cast<int32_t>(objSource.grid[i_1][i_3])));
 				}
 				grid_json.AddMember(std::move(nested_json));
 			}
@@ -691,20 +991,40 @@ static void JSONSerialize(std::ostream& osReceiver, const MultiArrayType& objSou
 static void JSONDeserialize(MultiArrayType& objReceiver, const std::istream& isSource)
 {
 	JSONStructure jsonRep = JSONStructure::Parse(isSource);
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonRep.GetMembers())
 	{
-		JSONArray grid_json = jsonRep.GetMember("grid").as<JSONArray>();
-		for(size_t i_1 = 0; i_1 < sizeof(objReceiver.grid) / sizeof(objReceiver.grid[0]); i_1++)
+		switch(key_1.size())
 		{
+		case 4:
+			if(key_1 == "grid")
 			{
-				JSONArray nested_json = grid_json[i_1].as<JSONArray>();
-				for(size_t i_3 = 0; i_3 < sizeof(objReceiver.grid[i_1]) / sizeof(objReceiver.grid[i_1][0]); i_3++)
 				{
-					objReceiver.grid[i_1][i_3] = nested_json[i_3].as<JSONNumber>().value;
+					JSONArray grid_json = value_1.as<JSONArray>();
+					for(size_t i_4 = 0; i_4 < sizeof(objReceiver.grid) / sizeof(objReceiver.grid[0]); i_4++)
+					{
+						{
+							JSONArray nested_json = grid_json[i_4].as<JSONArray>();
+							for(size_t i_6 = 0; i_6 < sizeof(objReceiver.grid[i_4]) / sizeof(objReceiver.grid[i_4][0]); i_6++)
+							{
+								objReceiver.grid[i_4][i_6] = nested_json[i_6].as<JSONNumber>().Get<int32_t>();
+							}
+						}
+					}
 				}
+				found_1[0] |= 0x1ull;
 			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " grid";
+		throw std::runtime_error("Missing required key(s) in JSON object for MultiArrayType:" + missing_1);
+	}
 }
 )cpp";
 
@@ -757,7 +1077,7 @@ static void JSONSerialize(JSONObject& jsonReceiver, const Wrapper& objSource)
 			JSONArray arr_json;
 			for(size_t i_2 = 0; i_2 < sizeof(objSource.pod.arr) / sizeof(objSource.pod.arr[0]); i_2++)
 			{
-				arr_json.AddMember(JSONNumber(static_cast<double>(objSource.pod.arr[i_2])));
+				arr_json.AddMember(JSONNumber(static_cast<int32_t>(objSource.pod.arr[i_2])));
 			}
 			pod_json.AddMember("arr", std::move(arr_json));
 		}
@@ -768,14 +1088,57 @@ static void JSONSerialize(JSONObject& jsonReceiver, const Wrapper& objSource)
 
 static void JSONDeserialize(Wrapper& objReceiver, const JSONObject& jsonSource)
 {
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonSource.GetMembers())
 	{
-		JSONArray arr_json = jsonSource.GetMember("pod").as<JSONObject>().GetMember("arr").as<JSONArray>();
-		for(size_t i_1 = 0; i_1 < sizeof(objReceiver.pod.arr) / sizeof(objReceiver.pod.arr[0]); i_1++)
+		switch(key_1.size())
 		{
-			objReceiver.pod.arr[i_1] = arr_json[i_1].as<JSONNumber>().value;
+		case 3:
+			if(key_1 == "pod")
+			{
+				{
+					uint64_t found_5[1] = {};
+					for(const auto& [key_5, value_5] : value_1.as<JSONObject>().GetMembers())
+					{
+						switch(key_5.size())
+						{
+						case 3:
+							if(key_5 == "arr")
+							{
+								{
+									JSONArray arr_json = value_5.as<JSONArray>();
+									for(size_t i_8 = 0; i_8 < sizeof(objReceiver.pod.arr) / sizeof(objReceiver.pod.arr[0]); i_8++)
+									{
+										objReceiver.pod.arr[i_8] = arr_json[i_8].as<JSONNumber>().Get<int32_t>();
+									}
+								}
+								found_5[0] |= 0x1ull;
+							}
+							break;
+						default:
+							break;
+						}
+					}
+					if((found_5[0] & 0x1ull) != 0x1ull)
+					{
+						std::string missing_5;
+						if((found_5[0] & 0x1ull) == 0) missing_5 += " arr";
+						throw std::runtime_error("Missing required key(s) in JSON object for PodArray:" + missing_5);
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " pod";
+		throw std::runtime_error("Missing required key(s) in JSON object for Wrapper:" + missing_1);
+	}
 }
 
 static void JSONSerialize(std::ostream& osReceiver, const Wrapper& objSource)
@@ -787,7 +1150,7 @@ static void JSONSerialize(std::ostream& osReceiver, const Wrapper& objSource)
 			JSONArray arr_json;
 			for(size_t i_2 = 0; i_2 < sizeof(objSource.pod.arr) / sizeof(objSource.pod.arr[0]); i_2++)
 			{
-				arr_json.AddMember(JSONNumber(static_cast<double>(objSource.pod.arr[i_2])));
+				arr_json.AddMember(JSONNumber(static_cast<int32_t>(objSource.pod.arr[i_2])));
 			}
 			pod_json.AddMember("arr", std::move(arr_json));
 		}
@@ -800,14 +1163,57 @@ static void JSONSerialize(std::ostream& osReceiver, const Wrapper& objSource)
 static void JSONDeserialize(Wrapper& objReceiver, const std::istream& isSource)
 {
 	JSONStructure jsonRep = JSONStructure::Parse(isSource);
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonRep.GetMembers())
 	{
-		JSONArray arr_json = jsonRep.GetMember("pod").as<JSONObject>().GetMember("arr").as<JSONArray>();
-		for(size_t i_1 = 0; i_1 < sizeof(objReceiver.pod.arr) / sizeof(objReceiver.pod.arr[0]); i_1++)
+		switch(key_1.size())
 		{
-			objReceiver.pod.arr[i_1] = arr_json[i_1].as<JSONNumber>().value;
+		case 3:
+			if(key_1 == "pod")
+			{
+				{
+					uint64_t found_5[1] = {};
+					for(const auto& [key_5, value_5] : value_1.as<JSONObject>().GetMembers())
+					{
+						switch(key_5.size())
+						{
+						case 3:
+							if(key_5 == "arr")
+							{
+								{
+									JSONArray arr_json = value_5.as<JSONArray>();
+									for(size_t i_8 = 0; i_8 < sizeof(objReceiver.pod.arr) / sizeof(objReceiver.pod.arr[0]); i_8++)
+									{
+										objReceiver.pod.arr[i_8] = arr_json[i_8].as<JSONNumber>().Get<int32_t>();
+									}
+								}
+								found_5[0] |= 0x1ull;
+							}
+							break;
+						default:
+							break;
+						}
+					}
+					if((found_5[0] & 0x1ull) != 0x1ull)
+					{
+						std::string missing_5;
+						if((found_5[0] & 0x1ull) == 0) missing_5 += " arr";
+						throw std::runtime_error("Missing required key(s) in JSON object for PodArray:" + missing_5);
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " pod";
+		throw std::runtime_error("Missing required key(s) in JSON object for Wrapper:" + missing_1);
+	}
 }
 )cpp";
 
@@ -871,14 +1277,58 @@ static void JSONSerialize(JSONObject& jsonReceiver, const Wrapper& objSource)
 
 static void JSONDeserialize(Wrapper& objReceiver, const JSONObject& jsonSource)
 {
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonSource.GetMembers())
 	{
-		for(const auto& item_1 : jsonSource.GetMember("pod").as<JSONObject>().GetMember("values").as<JSONArray>().GetItems())
+		switch(key_1.size())
 		{
-			auto& elem_1 = objReceiver.pod.values.emplace_back();
-			elem_1 = item_1.as<JSONNumber>().value;
+		case 3:
+			if(key_1 == "pod")
+			{
+				{
+					uint64_t found_5[1] = {};
+					for(const auto& [key_5, value_5] : value_1.as<JSONObject>().GetMembers())
+					{
+						switch(key_5.size())
+						{
+						case 6:
+							if(key_5 == "values")
+							{
+								{
+									const auto& items_8 = value_5.as<JSONArray>().GetItems();
+									objReceiver.pod.values.reserve(objReceiver.pod.values.size() + items_8.size());
+									for(const auto& item_8 : items_8)
+									{
+										objReceiver.pod.values.emplace_back(item_8.as<JSONNumber>().Get<float>());
+									}
+								}
+								found_5[0] |= 0x1ull;
+							}
+							break;
+						default:
+							break;
+						}
+					}
+					if((found_5[0] & 0x1ull) != 0x1ull)
+					{
+						std::string missing_5;
+						if((found_5[0] & 0x1ull) == 0) missing_5 += " values";
+						throw std::runtime_error("Missing required key(s) in JSON object for PodVec:" + missing_5);
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " pod";
+		throw std::runtime_error("Missing required key(s) in JSON object for Wrapper:" + missing_1);
+	}
 }
 
 static void JSONSerialize(std::ostream& osReceiver, const Wrapper& objSource)
@@ -903,16 +1353,186 @@ static void JSONSerialize(std::ostream& osReceiver, const Wrapper& objSource)
 static void JSONDeserialize(Wrapper& objReceiver, const std::istream& isSource)
 {
 	JSONStructure jsonRep = JSONStructure::Parse(isSource);
+	uint64_t found_1[1] = {};
+	for(const auto& [key_1, value_1] : jsonRep.GetMembers())
 	{
-		for(const auto& item_1 : jsonRep.GetMember("pod").as<JSONObject>().GetMember("values").as<JSONArray>().GetItems())
+		switch(key_1.size())
 		{
-			auto& elem_1 = objReceiver.pod.values.emplace_back();
-			elem_1 = item_1.as<JSONNumber>().value;
+		case 3:
+			if(key_1 == "pod")
+			{
+				{
+					uint64_t found_5[1] = {};
+					for(const auto& [key_5, value_5] : value_1.as<JSONObject>().GetMembers())
+					{
+						switch(key_5.size())
+						{
+						case 6:
+							if(key_5 == "values")
+							{
+								{
+									const auto& items_8 = value_5.as<JSONArray>().GetItems();
+									objReceiver.pod.values.reserve(objReceiver.pod.values.size() + items_8.size());
+									for(const auto& item_8 : items_8)
+									{
+										objReceiver.pod.values.emplace_back(item_8.as<JSONNumber>().Get<float>());
+									}
+								}
+								found_5[0] |= 0x1ull;
+							}
+							break;
+						default:
+							break;
+						}
+					}
+					if((found_5[0] & 0x1ull) != 0x1ull)
+					{
+						std::string missing_5;
+						if((found_5[0] & 0x1ull) == 0) missing_5 += " values";
+						throw std::runtime_error("Missing required key(s) in JSON object for PodVec:" + missing_5);
+					}
+				}
+				found_1[0] |= 0x1ull;
+			}
+			break;
+		default:
+			break;
 		}
 	}
-
+	if((found_1[0] & 0x1ull) != 0x1ull)
+	{
+		std::string missing_1;
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " pod";
+		throw std::runtime_error("Missing required key(s) in JSON object for Wrapper:" + missing_1);
+	}
 }
 )cpp";
 
 	AssertCodeEqual(code, expected);
-}
\ No newline at end of file
+}
+
+TEST_F(JSONFormatPluginTest, DispatchesKeysByLengthAndFirstCharacter)
+{
+	GenerateSASTFromSources({
+		{"Dispatch.h", R"cpp(
+			#pragma once
+			#include <string>
+			#include "SerializationMacros.h"
+
+			class SERIALIZABLE(JSON) Dispatch {
+				SERIALIZE_FIELD
+				int alpha;
+
+				SERIALIZE_FIELD
+				int bravo;
+
+				SERIALIZE_FIELD
+				int about;
+
+				SERIALIZE_FIELD SERIALIZE_DEFAULT("none")
+				std::string label;
+
+				GENERATED_SERIALIZATION_BODY();
+			};
+		)cpp"}
+		});
+
+	ASSERT_NE(globalSASTMap.find("Dispatch"), globalSASTMap.end());
+	JSONFormatPlugin plugin;
+	std::string code = plugin.GenerateCode(globalSASTMap["Dispatch"]);
+
+	// alpha, bravo, about and label share a length, so they are split on their first character
+	EXPECT_NE(code.find("\t\tcase 5:\n\t\t\tswitch(key_1[0])\n"), std::string::npos);
+	EXPECT_NE(code.find("\t\t\tcase 'a':\n\t\t\t\tif(key_1 == \"alpha\")\n"), std::string::npos);
+	EXPECT_NE(code.find("\t\t\t\telse if(key_1 == \"about\")\n"), std::string::npos);
+
+	// label has a default so it is optional, the other keys are required
+	EXPECT_NE(code.find("\tif((found_1[0] & 0x8ull) == 0)\n\t\tobjReceiver.label = decltype(objReceiver.label){ \"none\" };\n"), std::string::npos);
+	EXPECT_NE(code.find("\tif((found_1[0] & 0x7ull) != 0x7ull)\n"), std::string::npos);
+	EXPECT_EQ(code.find("GetMember("), std::string::npos);
+}
+
+TEST_F(JSONFormatPluginTest, ReservesAndHintsContainerInsertion)
+{
+	GenerateSASTFromSources({
+		{"Containers.h", R"cpp(
+			#pragma once
+			#include <set>
+			#include <map>
+			#include <unordered_set>
+			#include <string>
+			#include "SerializationMacros.h"
+
+			class SERIALIZABLE(JSON) Inner {
+				SERIALIZE_FIELD
+				int v;
+
+				GENERATED_SERIALIZATION_BODY();
+			};
+
+			class SERIALIZABLE(JSON) Containers {
+				SERIALIZE_FIELD
+				std::set<std::string> names;
+
+				SERIALIZE_FIELD
+				std::map<std::string, int> counts;
+
+				SERIALIZE_FIELD
+				std::unordered_set<long long> ids;
+
+				SERIALIZE_FIELD
+				std::map<int, Inner> objects;
+
+				GENERATED_SERIALIZATION_BODY();
+			};
+		)cpp"}
+		});
+
+	ASSERT_NE(globalSASTMap.find("Containers"), globalSASTMap.end());
+	JSONFormatPlugin plugin;
+	std::string code = plugin.GenerateCode(globalSASTMap["Containers"]);
+
+	// Unordered containers reserve for the parsed element count, scalars are constructed in place
+	EXPECT_NE(code.find("objReceiver.ids.reserve(objReceiver.ids.size() + items_4.size());"), std::string::npos);
+	EXPECT_NE(code.find("objReceiver.ids.emplace(item_4.as<JSONNumber>().Get<int64_t>());"), std::string::npos);
+
+	// Ordered containers insert with a hint instead
+	EXPECT_EQ(code.find("objReceiver.names.reserve("), std::string::npos);
+	EXPECT_NE(code.find("objReceiver.names.emplace_hint(objReceiver.names.end(), item_4.as<JSONString>().value);"), std::string::npos);
+	EXPECT_NE(code.find("objReceiver.counts.insert_or_assign(objReceiver.counts.end(), key_4, value_4.as<JSONNumber>().Get<int32_t>());"), std::string::npos);
+	EXPECT_NE(code.find("auto& elem_4 = objReceiver.objects.try_emplace(objReceiver.objects.end(), JSONNumber::Parse(key_4).Get<int32_t>())->second;"), std::string::npos);
+}
+
+TEST_F(JSONFormatPluginTest, BraceInitializesDefaultsOfSeveralArguments)
+{
+	GenerateSASTFromSources({
+		{"Defaults.h", R"cpp(
+			#pragma once
+			#include "SerializationMacros.h"
+
+			struct SERIALIZABLE_POD Point {
+				int x;
+				int y;
+			};
+
+			class SERIALIZABLE(JSON) Defaults {
+				SERIALIZE_FIELD SERIALIZE_DEFAULT(1, 2)
+				Point origin;
+
+				SERIALIZE_FIELD SERIALIZE_DEFAULT(5)
+				int count;
+
+				GENERATED_SERIALIZATION_BODY();
+			};
+		)cpp"}
+		});
+
+	ASSERT_NE(globalSASTMap.find("Defaults"), globalSASTMap.end());
+	JSONFormatPlugin plugin;
+	std::string code = plugin.GenerateCode(globalSASTMap["Defaults"]);
+
+	// "= 1, 2" would assign 2 and drop the 1
+	EXPECT_NE(code.find("objReceiver.origin = decltype(objReceiver.origin){ 1, 2 };\n"), std::string::npos);
+	EXPECT_NE(code.find("objReceiver.count = decltype(objReceiver.count){ 5 };\n"), std::string::npos);
+	EXPECT_EQ(code.find("objReceiver.origin = 1, 2;"), std::string::npos);
+}
@@ -0,0 +1,46 @@
+#ifndef GENTOOLS_GENSERIALIZE_FILE_WORK_LIST_H
+#define GENTOOLS_GENSERIALIZE_FILE_WORK_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Fixed set of files handed out one at a time to any number of worker threads, largest first. Starting on the heaviest files
+	/// keeps one of them from being left for the end of a run while the other workers sit idle
+	/// </summary>
+	class FileWorkList
+	{
+	private:
+		std::vector<std::string> m_files;
+		std::atomic<size_t> m_next{ 0 };
+
+	public:
+		/// <summary>
+		/// Order the files by size, largest first. Files that cannot be stat'ed are ordered last
+		/// </summary>
+		/// <param name="files">Paths of the files to hand out</param>
+		explicit FileWorkList(std::vector<std::string> files);
+
+		FileWorkList(const FileWorkList&) = delete;
+		FileWorkList& operator=(const FileWorkList&) = delete;
+
+		/// <summary>
+		/// Claim the next file. Safe to call from several threads, each file is returned exactly once
+		/// </summary>
+		/// <returns>The file path, or empty once every file has been claimed</returns>
+		std::optional<std::string> Next();
+
+		/// <returns>Number of files in the list</returns>
+		size_t Size() const noexcept;
+
+		/// <returns>The files in the order they are handed out</returns>
+		const std::vector<std::string>& Files() const noexcept;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_FILE_WORK_LIST_H
@@ -0,0 +1,54 @@
+#ifndef GENTOOLS_GENSERIALIZE_WORK_QUEUE_H
+#define GENTOOLS_GENSERIALIZE_WORK_QUEUE_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Blocking multi producer, multi consumer FIFO. Consumers wait for work until the queue is closed and drained, which lets a
+	/// phase start on items as soon as the previous phase produces them
+	/// </summary>
+	/// <typeparam name="T">Type of the work items</typeparam>
+	template<typename T>
+	class WorkQueue
+	{
+	private:
+		std::deque<T> m_items;
+		bool m_closed = false;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_available;
+
+	public:
+		WorkQueue() = default;
+
+		WorkQueue(const WorkQueue&) = delete;
+		WorkQueue& operator=(const WorkQueue&) = delete;
+
+		/// <summary>
+		/// Add an item and wake one waiting consumer. Items pushed after Close are dropped
+		/// </summary>
+		/// <param name="item">The work item</param>
+		/// <returns>False if the queue was already closed</returns>
+		bool Push(T item);
+
+		/// <summary>
+		/// Signal that no more items will be pushed, waking every waiting consumer
+		/// </summary>
+		void Close();
+
+		/// <summary>
+		/// Take the next item, waiting for one to be pushed if the queue is empty
+		/// </summary>
+		/// <returns>The item, or empty once the queue is closed and drained</returns>
+		std::optional<T> Pop();
+	};
+}
+
+#include <WorkQueue.inl>
+
+#endif // !GENTOOLS_GENSERIALIZE_WORK_QUEUE_H
@@ -0,0 +1,49 @@
+#ifndef GENTOOLS_GENSERIALIZE_WORK_QUEUE_INL
+#define GENTOOLS_GENSERIALIZE_WORK_QUEUE_INL
+
+#include <utility>
+
+namespace GenTools::GenSerialize
+{
+	template<typename T>
+	bool WorkQueue<T>::Push(T item)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_closed)
+				return false;
+
+			m_items.push_back(std::move(item));
+		}
+
+		m_available.notify_one();
+		return true;
+	}
+
+	template<typename T>
+	void WorkQueue<T>::Close()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_closed = true;
+		}
+
+		m_available.notify_all();
+	}
+
+	template<typename T>
+	std::optional<T> WorkQueue<T>::Pop()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_available.wait(lock, [this]() { return m_closed || !m_items.empty(); });
+
+		if (m_items.empty())
+			return std::nullopt;
+
+		std::optional<T> item(std::move(m_items.front()));
+		m_items.pop_front();
+		return item;
+	}
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_WORK_QUEUE_INL
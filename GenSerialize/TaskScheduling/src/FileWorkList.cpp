@@ -0,0 +1,51 @@
+#include <FileWorkList.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+namespace GenTools::GenSerialize
+{
+	FileWorkList::FileWorkList(std::vector<std::string> files)
+	{
+		// Stat every file once up front rather than in the comparator
+		std::vector<std::pair<uintmax_t, std::string>> sizedFiles;
+		sizedFiles.reserve(files.size());
+		for (auto& file : files)
+		{
+			std::error_code ec;
+			uintmax_t size = std::filesystem::file_size(file, ec);
+			sizedFiles.emplace_back(ec ? 0 : size, std::move(file));
+		}
+
+		// Stable, so equally sized files keep the order they were given in
+		std::stable_sort(sizedFiles.begin(), sizedFiles.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+		m_files.reserve(sizedFiles.size());
+		for (auto& [size, file] : sizedFiles)
+		{
+			m_files.push_back(std::move(file));
+		}
+	}
+
+	std::optional<std::string> FileWorkList::Next()
+	{
+		size_t index = m_next.fetch_add(1, std::memory_order_relaxed);
+		if (index >= m_files.size())
+			return std::nullopt;
+
+		return m_files[index];
+	}
+
+	size_t FileWorkList::Size() const noexcept
+	{
+		return m_files.size();
+	}
+
+	const std::vector<std::string>& FileWorkList::Files() const noexcept
+	{
+		return m_files;
+	}
+}
@@ -0,0 +1,63 @@
+#ifndef GENTOOLS_GENSERIALIZE_TRACKING_FILE_SYSTEM_H
+#define GENTOOLS_GENSERIALIZE_TRACKING_FILE_SYSTEM_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <llvm/ADT/IntrusiveRefCntPtr.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/Chrono.h>
+#include <llvm/Support/VirtualFileSystem.h>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// File system that records what every path looked like the first time it was queried, whether it existed and its type,
+	/// size and modification time. A file manager built on it caches those answers, including files that were not found, so it
+	/// can only be kept for another parse while IsUnchanged holds
+	/// </summary>
+	class TrackingFileSystem : public llvm::vfs::ProxyFileSystem
+	{
+	private:
+		struct Observation
+		{
+			bool exists = false;
+			llvm::sys::fs::file_type type = llvm::sys::fs::file_type::status_error;
+			uint64_t size = 0;
+			llvm::sys::TimePoint<> modificationTime;
+
+			bool operator==(const Observation&) const = default;
+		};
+
+		llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> m_fileSystem;
+		std::unordered_map<std::string, Observation> m_observations;
+		// Parse threads query the file system concurrently
+		mutable std::mutex m_mutex;
+
+		static Observation Observe(const llvm::ErrorOr<llvm::vfs::Status>& status);
+		void Record(const llvm::Twine& path, const llvm::ErrorOr<llvm::vfs::Status>& status);
+
+	public:
+		explicit TrackingFileSystem(llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fileSystem);
+
+		llvm::ErrorOr<llvm::vfs::Status> status(const llvm::Twine& path) override;
+#if LLVM_VERSION_MAJOR >= 17
+		bool exists(const llvm::Twine& path) override;
+#endif
+		llvm::ErrorOr<std::unique_ptr<llvm::vfs::File>> openFileForRead(const llvm::Twine& path) override;
+		llvm::vfs::directory_iterator dir_begin(const llvm::Twine& directory, std::error_code& errorCode) override;
+
+		/// <summary>
+		/// Query every recorded path again through the underlying file system
+		/// </summary>
+		/// <returns>True if each path still looks the way it was recorded</returns>
+		bool IsUnchanged() const;
+
+		/// <returns>Number of distinct paths recorded</returns>
+		size_t GetObservationCount() const;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_TRACKING_FILE_SYSTEM_H
@@ -0,0 +1,87 @@
+#include <TrackingFileSystem.h>
+
+#include <llvm/ADT/SmallString.h>
+
+namespace GenTools::GenSerialize
+{
+	TrackingFileSystem::TrackingFileSystem(llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fileSystem)
+		: llvm::vfs::ProxyFileSystem(fileSystem), m_fileSystem(std::move(fileSystem))
+	{}
+
+	TrackingFileSystem::Observation TrackingFileSystem::Observe(const llvm::ErrorOr<llvm::vfs::Status>& status)
+	{
+		Observation observation;
+		if (status)
+		{
+			observation.exists = true;
+			observation.type = status->getType();
+			observation.size = status->getSize();
+			observation.modificationTime = status->getLastModificationTime();
+		}
+		return observation;
+	}
+
+	void TrackingFileSystem::Record(const llvm::Twine& path, const llvm::ErrorOr<llvm::vfs::Status>& status)
+	{
+		Observation observation = Observe(status);
+
+		// Relative paths are resolved against the working directory at the time of the query, which may have moved on by the
+		// time the record is checked
+		llvm::SmallString<256> absolutePath;
+		path.toVector(absolutePath);
+		m_fileSystem->makeAbsolute(absolutePath);
+
+		// The first answer is the one cached by the file manager
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_observations.try_emplace(std::string(absolutePath.str()), observation);
+	}
+
+	llvm::ErrorOr<llvm::vfs::Status> TrackingFileSystem::status(const llvm::Twine& path)
+	{
+		auto result = llvm::vfs::ProxyFileSystem::status(path);
+		Record(path, result);
+		return result;
+	}
+
+#if LLVM_VERSION_MAJOR >= 17
+	// The proxy would answer from the underlying file system without recording the path
+	bool TrackingFileSystem::exists(const llvm::Twine& path)
+	{
+		return static_cast<bool>(status(path));
+	}
+#endif
+
+	llvm::ErrorOr<std::unique_ptr<llvm::vfs::File>> TrackingFileSystem::openFileForRead(const llvm::Twine& path)
+	{
+		auto file = llvm::vfs::ProxyFileSystem::openFileForRead(path);
+		if (file)
+			Record(path, (*file)->status());
+		else
+			Record(path, file.getError());
+		return file;
+	}
+
+	llvm::vfs::directory_iterator TrackingFileSystem::dir_begin(const llvm::Twine& directory, std::error_code& errorCode)
+	{
+		// Adding or removing an entry changes the modification time of the directory
+		Record(directory, llvm::vfs::ProxyFileSystem::status(directory));
+		return llvm::vfs::ProxyFileSystem::dir_begin(directory, errorCode);
+	}
+
+	bool TrackingFileSystem::IsUnchanged() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (const auto& [path, observation] : m_observations)
+		{
+			if (Observe(m_fileSystem->status(path)) != observation)
+				return false;
+		}
+		return true;
+	}
+
+	size_t TrackingFileSystem::GetObservationCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_observations.size();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef GENTOOLS_GENSERIALIZE_TYPE_INDEX_H
+#define GENTOOLS_GENSERIALIZE_TYPE_INDEX_H
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SAST.h>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// Persistent map from qualified type name to the SAST node of every serializable type seen by previous runs. Sources that are
+	/// parsed can be linked against types whose files were skipped, instead of re-parsing the whole dependency closure
+	/// </summary>
+	class TypeIndex
+	{
+	private:
+		std::filesystem::path m_indexPath;
+		std::unordered_map<std::string, std::shared_ptr<SASTNode>> m_nodes;
+		bool m_dirty = false;
+
+		// Restore the links between the nodes of the index
+		void LinkNodes(bool relink);
+
+	public:
+		/// <summary>
+		/// Create an index backed by the given file
+		/// </summary>
+		/// <param name="indexPath">Location of the index file</param>
+		explicit TypeIndex(const std::filesystem::path& indexPath);
+
+		/// <summary>
+		/// Read the index file and link its nodes to each other. A missing, unreadable or outdated index leaves the index empty
+		/// </summary>
+		/// <returns>True if nodes were loaded</returns>
+		bool Load();
+
+		/// <summary>
+		/// Write the index file if it changed, through a temporary file so an interrupted run never leaves a partial index
+		/// </summary>
+		/// <returns>True on success</returns>
+		bool Save();
+
+		/// <summary>
+		/// Replace the index entries with freshly parsed nodes. Types that were indexed from one of the given files but are no
+		/// longer found in it are dropped, and the remaining nodes are relinked to the fresh ones
+		/// </summary>
+		/// <param name="nodes">Nodes parsed this run, keyed by qualified name, their source files normalized</param>
+		/// <param name="parsedFiles">Normalized paths of the files parsed this run</param>
+		void Update(const std::unordered_map<std::string, std::shared_ptr<SASTNode>>& nodes, const std::vector<std::string>& parsedFiles);
+
+		/// <summary>
+		/// Drop the types indexed from files that no longer exist. A source removed from the build is never parsed again, its types
+		/// would otherwise stay linkable forever
+		/// </summary>
+		void PruneMissingFiles();
+
+		/// <returns>Every indexed node, keyed by qualified name</returns>
+		const std::unordered_map<std::string, std::shared_ptr<SASTNode>>& GetNodes() const noexcept;
+
+		TypeIndex(const TypeIndex&) = delete;
+		TypeIndex& operator=(const TypeIndex&) = delete;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_TYPE_INDEX_H
@@ -0,0 +1,170 @@
+#include <TypeIndex.h>
+
+#include <SASTArchive.h>
+#include <SASTLinker.h>
+#include <AtomicFile.h>
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <PlatformInterface.h>
+
+namespace GenTools::GenSerialize
+{
+	namespace
+	{
+		// The archive carries its own version
+		constexpr std::string_view INDEX_MAGIC = "GenSerializeTypeIndex";
+	}
+
+	TypeIndex::TypeIndex(const std::filesystem::path& indexPath)
+		: m_indexPath(indexPath)
+	{}
+
+	void TypeIndex::LinkNodes(bool relink)
+	{
+		std::vector<std::shared_ptr<SASTNode>> nodes;
+		nodes.reserve(m_nodes.size());
+		for (const auto& [name, node] : m_nodes)
+		{
+			nodes.push_back(node);
+		}
+
+		SASTLinker linker(nodes, m_nodes);
+		linker.Link(relink);
+
+		if (!relink)
+			return;
+
+		for (auto& node : nodes)
+		{
+			for (auto& baseNode : node->baseNodes)
+			{
+				auto current = m_nodes.find(baseNode->name);
+				if (current != m_nodes.end())
+					baseNode = current->second;
+			}
+		}
+	}
+
+	bool TypeIndex::Load()
+	{
+		m_nodes.clear();
+
+		std::ifstream file(m_indexPath, std::ios::binary);
+		if (!file.is_open())
+			return false;
+
+		std::stringstream buffer;
+		buffer << file.rdbuf();
+		std::string data = buffer.str();
+
+		if (!data.starts_with(INDEX_MAGIC))
+		{
+			m_dirty = true;
+			return false;
+		}
+
+		// Links between the nodes are stored in the archive, no relinking needed
+		try
+		{
+			for (auto& node : SASTArchive::Read(std::string_view(data).substr(INDEX_MAGIC.size())))
+			{
+				m_nodes[node->name] = std::move(node);
+			}
+		}
+		catch (const std::runtime_error& ex)
+		{
+			TERMINAL::PRINT_WARNING("Warning: Ignoring type index " + m_indexPath.string() + ": " + ex.what());
+			m_nodes.clear();
+			m_dirty = true;
+			return false;
+		}
+
+		return true;
+	}
+
+	bool TypeIndex::Save()
+	{
+		if (!m_dirty)
+			return true;
+
+		std::vector<std::shared_ptr<SASTNode>> nodes;
+		nodes.reserve(m_nodes.size());
+		for (const auto& [name, node] : m_nodes)
+		{
+			nodes.push_back(node);
+		}
+
+		std::string data(INDEX_MAGIC);
+		data += SASTArchive::Write(nodes);
+
+		if (std::error_code ec = WriteFileAtomically(m_indexPath, data))
+		{
+			TERMINAL::PRINT_WARNING("Warning: Could not write type index " + m_indexPath.string() + ": " + ec.message());
+			return false;
+		}
+
+		m_dirty = false;
+		return true;
+	}
+
+	void TypeIndex::Update(const std::unordered_map<std::string, std::shared_ptr<SASTNode>>& nodes, const std::vector<std::string>& parsedFiles)
+	{
+		// Every type of a parsed file was seen again if it still exists
+		std::unordered_set<std::string> refreshedFiles(parsedFiles.begin(), parsedFiles.end());
+		for (const auto& [name, node] : nodes)
+		{
+			refreshedFiles.insert(node->sourceFile);
+		}
+
+		std::erase_if(m_nodes, [&](const auto& entry) {
+			return refreshedFiles.contains(entry.second->sourceFile) && !nodes.contains(entry.first);
+		});
+
+		for (const auto& [name, node] : nodes)
+		{
+			m_nodes[name] = node;
+		}
+
+		if (!nodes.empty() || !parsedFiles.empty())
+			m_dirty = true;
+
+		LinkNodes(true);
+	}
+
+	void TypeIndex::PruneMissingFiles()
+	{
+		// Several types usually share a file, each file is checked once
+		std::unordered_map<std::string, bool> fileExists;
+		size_t erased = std::erase_if(m_nodes, [&](const auto& entry) {
+			const std::string& sourceFile = entry.second->sourceFile;
+			if (sourceFile.empty())
+				return false;
+
+			auto [exists, inserted] = fileExists.try_emplace(sourceFile, true);
+			if (inserted)
+			{
+				std::error_code ec;
+				exists->second = std::filesystem::exists(sourceFile, ec) || ec;
+			}
+			return !exists->second;
+		});
+
+		if (erased == 0)
+			return;
+
+		m_dirty = true;
+		LinkNodes(true);
+	}
+
+	const std::unordered_map<std::string, std::shared_ptr<SASTNode>>& TypeIndex::GetNodes() const noexcept
+	{
+		return m_nodes;
+	}
+}
@@ -0,0 +1,45 @@
+#ifndef GENTOOLS_GENSERIALIZE_WORKING_DIRECTORY_FILE_SYSTEM_H
+#define GENTOOLS_GENSERIALIZE_WORKING_DIRECTORY_FILE_SYSTEM_H
+
+#include <string>
+
+#include <llvm/ADT/IntrusiveRefCntPtr.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/VirtualFileSystem.h>
+
+namespace GenTools::GenSerialize
+{
+	/// <summary>
+	/// File system holding a working directory of its own over a file system shared between threads. Relative paths are resolved
+	/// here and only absolute paths reach the shared file system, so each parse thread can move into the directory of its compile
+	/// command without changing where the paths of another thread resolve
+	/// </summary>
+	class WorkingDirectoryFileSystem : public llvm::vfs::ProxyFileSystem
+	{
+	private:
+		std::string m_workingDirectory;
+
+		// The path made absolute against the working directory, with "." and ".." removed
+		llvm::SmallString<256> Resolve(const llvm::Twine& path) const;
+
+	public:
+		/// <param name="fileSystem">The shared file system</param>
+		/// <param name="workingDirectory">Absolute path of the initial working directory</param>
+		WorkingDirectoryFileSystem(llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fileSystem, std::string workingDirectory);
+
+		llvm::ErrorOr<llvm::vfs::Status> status(const llvm::Twine& path) override;
+#if LLVM_VERSION_MAJOR >= 17
+		bool exists(const llvm::Twine& path) override;
+#endif
+		llvm::ErrorOr<std::unique_ptr<llvm::vfs::File>> openFileForRead(const llvm::Twine& path) override;
+		llvm::vfs::directory_iterator dir_begin(const llvm::Twine& directory, std::error_code& errorCode) override;
+		std::error_code getRealPath(const llvm::Twine& path, llvm::SmallVectorImpl<char>& output) const override;
+		std::error_code isLocal(const llvm::Twine& path, bool& result) override;
+
+		llvm::ErrorOr<std::string> getCurrentWorkingDirectory() const override;
+		std::error_code setCurrentWorkingDirectory(const llvm::Twine& path) override;
+	};
+}
+
+#endif // !GENTOOLS_GENSERIALIZE_WORKING_DIRECTORY_FILE_SYSTEM_H
@@ -0,0 +1,80 @@
+#include <WorkingDirectoryFileSystem.h>
+
+#include <llvm/Support/Path.h>
+
+namespace GenTools::GenSerialize
+{
+	WorkingDirectoryFileSystem::WorkingDirectoryFileSystem(llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fileSystem, std::string workingDirectory)
+		: llvm::vfs::ProxyFileSystem(std::move(fileSystem)), m_workingDirectory(std::move(workingDirectory))
+	{}
+
+	llvm::SmallString<256> WorkingDirectoryFileSystem::Resolve(const llvm::Twine& path) const
+	{
+		llvm::SmallString<256> absolutePath;
+		path.toVector(absolutePath);
+		if (!llvm::sys::path::is_absolute(absolutePath))
+		{
+			llvm::SmallString<256> relativePath = std::move(absolutePath);
+			absolutePath = m_workingDirectory;
+			llvm::sys::path::append(absolutePath, relativePath);
+		}
+		llvm::sys::path::remove_dots(absolutePath, true);
+		return absolutePath;
+	}
+
+	llvm::ErrorOr<llvm::vfs::Status> WorkingDirectoryFileSystem::status(const llvm::Twine& path)
+	{
+		auto result = llvm::vfs::ProxyFileSystem::status(Resolve(path));
+		if (!result)
+			return result;
+
+		// Callers expect the status to carry the path they asked for
+		return llvm::vfs::Status::copyWithNewName(*result, path);
+	}
+
+#if LLVM_VERSION_MAJOR >= 17
+	bool WorkingDirectoryFileSystem::exists(const llvm::Twine& path)
+	{
+		return llvm::vfs::ProxyFileSystem::exists(Resolve(path));
+	}
+#endif
+
+	llvm::ErrorOr<std::unique_ptr<llvm::vfs::File>> WorkingDirectoryFileSystem::openFileForRead(const llvm::Twine& path)
+	{
+		return llvm::vfs::ProxyFileSystem::openFileForRead(Resolve(path));
+	}
+
+	llvm::vfs::directory_iterator WorkingDirectoryFileSystem::dir_begin(const llvm::Twine& directory, std::error_code& errorCode)
+	{
+		return llvm::vfs::ProxyFileSystem::dir_begin(Resolve(directory), errorCode);
+	}
+
+	std::error_code WorkingDirectoryFileSystem::getRealPath(const llvm::Twine& path, llvm::SmallVectorImpl<char>& output) const
+	{
+		return llvm::vfs::ProxyFileSystem::getRealPath(Resolve(path), output);
+	}
+
+	std::error_code WorkingDirectoryFileSystem::isLocal(const llvm::Twine& path, bool& result)
+	{
+		return llvm::vfs::ProxyFileSystem::isLocal(Resolve(path), result);
+	}
+
+	llvm::ErrorOr<std::string> WorkingDirectoryFileSystem::getCurrentWorkingDirectory() const
+	{
+		return m_workingDirectory;
+	}
+
+	std::error_code WorkingDirectoryFileSystem::setCurrentWorkingDirectory(const llvm::Twine& path)
+	{
+		// Like the real file system, only an existing directory can become the working directory
+		llvm::SmallString<256> directory = Resolve(path);
+		auto directoryStatus = llvm::vfs::ProxyFileSystem::status(directory);
+		if (!directoryStatus)
+			return directoryStatus.getError();
+		if (!directoryStatus->isDirectory())
+			return std::make_error_code(std::errc::not_a_directory);
+
+		m_workingDirectory = std::string(directory.str());
+		return {};
+	}
+}
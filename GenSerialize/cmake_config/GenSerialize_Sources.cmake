@@ -0,0 +1,56 @@
+# gen_serialize_sources(<target> SOURCES <source>... [OPTIONS <option>...])
+#
+# Generate the serialization headers of the sources before <target> is built, "generated/<name>.generated.h" next to each
+# source. GenSerialize runs once for all of the sources and touches a stamp file, with a depfile naming every file the sources
+# included, so the build only runs it again when one of them changed, and its generation cache limits that run to the
+# affected sources. The headers are byproducts, a header left unchanged or not generated never makes the build run it again.
+#
+# OPTIONS are passed to GenSerialize as they are, e.g. --compile_commands=${CMAKE_BINARY_DIR}. GenSerialize runs in
+# "<target>_GenSerialize" under the current binary directory, where it also keeps its caches, relative paths in OPTIONS are
+# resolved from there.
+function(gen_serialize_sources TARGET)
+    cmake_parse_arguments(PARSE_ARGV 1 GEN_SERIALIZE "" "" "SOURCES;OPTIONS")
+
+    if (NOT GEN_SERIALIZE_SOURCES)
+        message(FATAL_ERROR "gen_serialize_sources: no SOURCES given for ${TARGET}")
+    endif()
+
+    # Built in this tree, or imported from an installed package
+    if (TARGET GenSerialize)
+        set(GEN_SERIALIZE_EXECUTABLE GenSerialize)
+    elseif (TARGET GenToolsPackage::GenSerializeGenSerialize)
+        set(GEN_SERIALIZE_EXECUTABLE GenToolsPackage::GenSerializeGenSerialize)
+    else()
+        message(FATAL_ERROR "gen_serialize_sources: no GenSerialize executable target found")
+    endif()
+
+    set(GEN_SERIALIZE_WORKING_DIR "${CMAKE_CURRENT_BINARY_DIR}/${TARGET}_GenSerialize")
+    set(GEN_SERIALIZE_DEPFILE "${GEN_SERIALIZE_WORKING_DIR}/generated.d")
+    set(GEN_SERIALIZE_STAMP "${GEN_SERIALIZE_WORKING_DIR}/generated.stamp")
+    file(MAKE_DIRECTORY "${GEN_SERIALIZE_WORKING_DIR}")
+
+    set(GEN_SERIALIZE_INPUTS "")
+    set(GEN_SERIALIZE_OUTPUTS "")
+    foreach (source IN LISTS GEN_SERIALIZE_SOURCES)
+        cmake_path(ABSOLUTE_PATH source BASE_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}" NORMALIZE OUTPUT_VARIABLE source_path)
+        cmake_path(GET source_path PARENT_PATH source_dir)
+        cmake_path(GET source_path STEM LAST_ONLY source_stem)
+
+        list(APPEND GEN_SERIALIZE_INPUTS "${source_path}")
+        list(APPEND GEN_SERIALIZE_OUTPUTS "${source_dir}/generated/${source_stem}.generated.h")
+    endforeach()
+
+    add_custom_command(
+        OUTPUT ${GEN_SERIALIZE_STAMP}
+        BYPRODUCTS ${GEN_SERIALIZE_OUTPUTS}
+        COMMAND ${GEN_SERIALIZE_EXECUTABLE} --depfile=${GEN_SERIALIZE_DEPFILE} --stamp=${GEN_SERIALIZE_STAMP} ${GEN_SERIALIZE_OPTIONS} ${GEN_SERIALIZE_INPUTS}
+        DEPENDS ${GEN_SERIALIZE_INPUTS} ${GEN_SERIALIZE_EXECUTABLE}
+        DEPFILE ${GEN_SERIALIZE_DEPFILE}
+        WORKING_DIRECTORY ${GEN_SERIALIZE_WORKING_DIR}
+        COMMENT "Generating serialization code for ${TARGET}"
+        VERBATIM
+    )
+
+    # Listed as sources of the target so they are generated before anything of it compiles
+    target_sources(${TARGET} PRIVATE ${GEN_SERIALIZE_STAMP} ${GEN_SERIALIZE_OUTPUTS})
+endfunction()
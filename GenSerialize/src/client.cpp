@@ -0,0 +1,101 @@
+#include <DaemonProtocol.h>
+
+#include <PlatformInterface.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Program.h>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+using namespace GenTools;
+using namespace GenTools::GenSerialize;
+
+// GenSerializeClient - Forward a GenSerialize run to the daemon started with GenSerialize --server
+//
+// Takes the command line of GenSerialize, plus --daemon_socket=<path> to name the socket of the daemon, which otherwise comes
+// from GEN_SERIALIZE_SOCKET or defaults to .gen_serialize.sock. Without a reachable daemon the run falls back to the
+// GenSerialize executable next to the client, so a build never depends on the daemon being up
+
+static const std::string_view SocketOption = "--daemon_socket=";
+static const char* const SocketVariable = "GEN_SERIALIZE_SOCKET";
+static const char* const DefaultSocket = ".gen_serialize.sock";
+
+// Anchor used to locate the running executable
+static void ExecutableAnchor() {}
+
+// Run the GenSerialize executable installed next to the client with the same command line
+static int RunDirectly(const char* argv0, const std::vector<std::string>& arguments)
+{
+	llvm::SmallString<256> executablePath(llvm::sys::fs::getMainExecutable(argv0, reinterpret_cast<void*>(&ExecutableAnchor)));
+	llvm::sys::path::remove_filename(executablePath);
+#if defined(_WIN32)
+	llvm::sys::path::append(executablePath, "GenSerialize.exe");
+#else
+	llvm::sys::path::append(executablePath, "GenSerialize");
+#endif
+
+	std::vector<llvm::StringRef> commandLine = { executablePath.str() };
+	commandLine.insert(commandLine.end(), arguments.begin(), arguments.end());
+
+	std::string errorMessage;
+	int exitCode = llvm::sys::ExecuteAndWait(executablePath.str(), commandLine, std::nullopt, {}, 0, 0, &errorMessage);
+	if (exitCode < 0)
+	{
+		TERMINAL::PRINT_ERROR("ERROR: Could not run " + std::string(executablePath.str()) + ": " + errorMessage);
+		return 1;
+	}
+	return exitCode;
+}
+
+int main(int argc, const char** argv)
+{
+	std::string socketPath;
+	if (const char* socketVariable = std::getenv(SocketVariable))
+		socketPath = socketVariable;
+
+	[[maybe_unused]] bool servedByDaemon = true;
+	std::vector<std::string> arguments;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view argument = argv[i];
+		if (argument.starts_with(SocketOption))
+		{
+			socketPath = argument.substr(SocketOption.size());
+			continue;
+		}
+
+		// The help and version printers only run in the executable itself
+		std::string_view option = argument;
+		while (option.starts_with('-'))
+			option.remove_prefix(1);
+		if (option.starts_with("help") || option == "version")
+			servedByDaemon = false;
+
+		arguments.emplace_back(argument);
+	}
+
+	if (socketPath.empty())
+		socketPath = DefaultSocket;
+
+#if !defined(_WIN32)
+	if (servedByDaemon)
+	{
+		if (auto exitCode = DaemonClient::Run(socketPath, std::filesystem::current_path().string(), arguments, STDOUT_FILENO, STDERR_FILENO))
+			return *exitCode;
+	}
+#endif
+
+	return RunDirectly(argv[0], arguments);
+}
@@ -3,7 +3,23 @@
 #include <FileValidator.h>
 #include <CodeGenerator.h>
 #include <GeneratedFileManager.h>
+#include <GenerationCache.h>
 #include <DynamicPluginLoader.h>
+#include <FileWorkList.h>
+#include <WorkQueue.h>
+#include <PrecompiledPrelude.h>
+#include <SourceScanner.h>
+#include <CompilationGroups.h>
+#include <TypeIndex.h>
+#include <SASTCache.h>
+#include <TrackingFileSystem.h>
+#include <CachingFileSystem.h>
+#include <WorkingDirectoryFileSystem.h>
+#include <DaemonProtocol.h>
+#include <FileWatcher.h>
+#include <DependencyFile.h>
+#include <AtomicFile.h>
+#include <RunStatistics.h>
 
 #include <PlatformInterface.h>
 
@@ -15,17 +31,29 @@
 #include <unordered_map>
 #include <thread>
 #include <mutex>
+#include <atomic>
 #include <algorithm>
+#include <unordered_set>
+#include <optional>
+#include <cstdio>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
 
 #include <llvm/Support/CommandLine.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/VirtualFileSystem.h>
 #include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
 #include <llvm/ADT/IntrusiveRefCntPtr.h>
 #include <clang/Tooling/CommonOptionsParser.h>
 #include <clang/Tooling/Tooling.h>
 #include <clang/Tooling/CompilationDatabase.h>
+#include <clang/Tooling/JSONCompilationDatabase.h>
 
 #include <JSONFormatPlugin.h>
+#include <BinaryViewFormatPlugin.h>
 
 using namespace GenTools;
 using namespace GenTools::GenSerialize;
@@ -61,44 +89,162 @@ IncludePaths("include_path",
 	llvm::cl::desc("Additional include paths to pass to Clang"),
 	llvm::cl::ZeroOrMore, llvm::cl::cat(AllCategories));
 
+static llvm::cl::opt<std::string>
+CompileCommands("compile_commands",
+	llvm::cl::desc("compile_commands.json, or the directory holding it, to take the flags of each source from. Sources missing from it take the flags of the closest entry"),
+	llvm::cl::init(""), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<std::string>
+Prelude("prelude",
+	llvm::cl::desc("Header including the heavy headers common to the sources, precompiled once and loaded by every source parse"),
+	llvm::cl::init(""), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<std::string>
+PreludePCH("prelude_pch",
+	llvm::cl::desc("Where to write the precompiled prelude"),
+	llvm::cl::init(".gen_serialize_prelude.pch"), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<std::string>
+CacheFile("cache_file",
+	llvm::cl::desc("File recording the inputs of each generated header, sources whose inputs did not change are skipped"),
+	llvm::cl::init(".gen_serialize.cache"), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<std::string>
+TypeIndexFile("type_index",
+	llvm::cl::desc("File keeping the serializable types of previous runs, so sources can link against types of sources that are not parsed"),
+	llvm::cl::init(".gen_serialize.types"), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<std::string>
+SASTCacheDir("sast_cache_dir",
+	llvm::cl::desc("Directory keeping the parsed SAST of each source, sources whose headers are regenerated skip Clang when their inputs did not change"),
+	llvm::cl::init(".gen_serialize_sast"), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<bool>
+NoCache("no_cache",
+	llvm::cl::desc("Parse and generate every source file, ignoring and not updating the generation cache"),
+	llvm::cl::init(false), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<bool>
+NoPrefilter("no_prefilter",
+	llvm::cl::desc("Parse every source file, including those whose text contains no SERIALIZABLE marker"),
+	llvm::cl::init(false), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<std::string>
+ServerSocket("server",
+	llvm::cl::desc("Run as a daemon serving the requests of GenSerializeClient on this socket, keeping parsed file state, plugins and caches warm between runs. Plugins stay loaded for the lifetime of the daemon"),
+	llvm::cl::init(""), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<std::string>
+DepFile("depfile",
+	llvm::cl::desc("Write a Makefile style dependency file here, with a rule for the generated header of each source naming the source and every file it included"),
+	llvm::cl::init(""), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<std::string>
+Stamp("stamp",
+	llvm::cl::desc("Touch this file at the end of every successful run and make it the only target of the dependency file, naming every input. Build systems depend on the stamp, which is always newer than the inputs, even when a header was left unchanged. Sources without serializable types get an empty generated header, so every header exists as a byproduct of the run"),
+	llvm::cl::init(""), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<bool>
+Stats("stats",
+	llvm::cl::desc("Time each phase of the run and count the types, fields and bytes generated, printing a summary and writing a Chrome trace of the threads"),
+	llvm::cl::init(false), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<std::string>
+StatsTrace("stats_trace",
+	llvm::cl::desc("Where --stats writes its Chrome trace event file"),
+	llvm::cl::init(".gen_serialize_trace.json"), llvm::cl::cat(AllCategories));
+
+static llvm::cl::opt<bool>
+WatchSources("watch",
+	llvm::cl::desc("Keep running, regenerating the headers of the sources whose contents or includes change. Linux only"),
+	llvm::cl::init(false), llvm::cl::cat(AllCategories));
+
+// Optional on the command line since a daemon takes none, every run requires at least one
 static llvm::cl::list<std::string> SourceFiles(
 	llvm::cl::Positional,
 	llvm::cl::desc("<source files>..."),
-	llvm::cl::OneOrMore,
+	llvm::cl::ZeroOrMore,
 	llvm::cl::cat(AllCategories)
 );
 
 REGISTER_STATIC_PLUGIN(JSONFormatPlugin, 0);
+REGISTER_STATIC_PLUGIN(BinaryViewFormatPlugin, 0);
 
-int main(int argc, const char** argv)
+static const char* const Overview = "GenSerialize - Generate serialization code for C++ classes\n";
+
+// Anchor used to locate the running executable
+static void ExecutableAnchor() {}
+
+// What a run leaves behind for the next one. A single run starts from an empty state, a daemon keeps one for its lifetime
+struct WarmState
+{
+	// Set by the daemon, makes each run record what the next one needs to tell whether the state is still valid
+	bool persistent = false;
+
+	DynamicPluginLoader pluginLoader;
+	// Plugin directories and files already loaded, each is only loaded once
+	std::unordered_set<std::string> pluginSources;
+	bool pluginResolverSet = false;
+
+	// The virtual file system the sources are parsed from, kept while the working directory, the contents of the virtual files
+	// and every file the parses looked at are unchanged
+	std::string workingDirectory;
+	std::unordered_map<std::string, uint64_t> virtualFileHashes;
+	llvm::IntrusiveRefCntPtr<CachingFileSystem> fileSystem;
+	llvm::IntrusiveRefCntPtr<TrackingFileSystem> trackingFileSystem;
+	// Precompiled preludes built on the file system, by the prelude, its PCH and the hash of the compile flags of their group
+	std::unordered_map<std::string, std::shared_ptr<PrecompiledPrelude>> preludes;
+	std::shared_ptr<clang::PCHContainerOperations> PCHContainerOps = std::make_shared<clang::PCHContainerOperations>();
+
+	// Caches, kept while their file is the one the previous run loaded or saved
+	std::unique_ptr<GenerationCache> cache;
+	std::string cachePath;
+	uint64_t cacheConfigHash = 0;
+	std::optional<uint64_t> cacheStamp;
+
+	std::unique_ptr<TypeIndex> typeIndex;
+	std::string typeIndexPath;
+	std::optional<uint64_t> typeIndexStamp;
+
+	std::unique_ptr<SASTCache> sastCache;
+	std::string sastCacheDir;
+};
+
+// Generate the headers of the sources on the command line
+static int Generate(WarmState& state, const char* argv0)
 {
 	try
 	{
+		RunStatistics& statistics = RunStatistics::GetInstance();
+		if (Stats)
+			statistics.Start();
+		else
+			statistics.Stop();
+
 		// Used to set virtual path for virtual files
 		const std::string virtualIncludeDir = "/__virtual_includes"; // must be absolute or look like it
 
-		// Compiler args for ClangTool
-		std::vector<std::string> compilationArgs = {
+		// Compiler args for ClangTool, used for every source when no compilation database is given
+		std::vector<std::string> defaultArgs = {
 			"-xc++",                            // Treat all input as C++
 			"-std=c++20",                       // Use C++20
-			"-fsyntax-only",                    // Don't generate code, just parse
-			"-Wno-pragma-once-outside-header",  // Silence warnings for #pragma once
 			"-nostdinc++",                      // Skip system C++ headers (for speed/stability)
 			"-fno-exceptions",                  // Optional: disable exceptions
 			"-fno-rtti",                        // Optional: disable RTTI
+		};
+
+		// Args every parse needs on top of the flags of the source
+		std::vector<std::string> toolArgs = {
+			"-fsyntax-only",                    // Don't generate code, just parse
+			"-Wno-pragma-once-outside-header",  // Silence warnings for #pragma once
 			"-I" + virtualIncludeDir,			// Include the virtual include directory
 		};
 		// Add include paths
 		for (const auto& path : IncludePaths)
 		{
-			compilationArgs.push_back("-I" + path);
+			toolArgs.push_back("-I" + path);
 		}
 
-		auto Compilations = std::make_unique<clang::tooling::FixedCompilationDatabase>(".", compilationArgs);
-
-		llvm::cl::HideUnrelatedOptions(AllCategories);
-		llvm::cl::ParseCommandLineOptions(argc, argv, "GenSerialize - Generate serialization code for C++ classes\n");
-
 		if (SourceFiles.empty())
 		{
 			TERMINAL::PRINT_ERROR("No source files provided. Use --help for usage information.");
@@ -107,59 +253,219 @@ int main(int argc, const char** argv)
 
 		const auto& sourcePaths = SourceFiles;
 
+		RunStatistics::Scope flagsPhase("Compile flags");
+		std::unique_ptr<clang::tooling::CompilationDatabase> commandDatabase;
+		if (!CompileCommands.empty())
+		{
+			std::filesystem::path databasePath(CompileCommands.getValue());
+			if (std::filesystem::is_directory(databasePath))
+				databasePath /= "compile_commands.json";
+
+			std::string errorMessage;
+			auto jsonDatabase = clang::tooling::JSONCompilationDatabase::loadFromFile(databasePath.string(), errorMessage, clang::tooling::JSONCommandLineSyntax::AutoDetect);
+			if (!jsonDatabase)
+			{
+				TERMINAL::PRINT_ERROR("ERROR: Could not load compilation database " + databasePath.string() + ": " + errorMessage);
+				return 1;
+			}
+
+			// Headers are rarely in a compilation database, they take the flags of the source that best matches their path
+			commandDatabase = clang::tooling::inferMissingCompileCommands(std::move(jsonDatabase));
+		}
+
+		// Sources with identical flags share a compilation database, a file manager and a precompiled prelude
+		CompilationGroups compilationGroups;
+		for (const auto& sourcePath : sourcePaths)
+		{
+			std::string directory = ".";
+			std::vector<std::string> arguments = defaultArgs;
+			if (commandDatabase)
+			{
+				auto commands = commandDatabase->getCompileCommands(GenerationCache::NormalizePath(sourcePath));
+				if (commands.empty())
+				{
+					TERMINAL::PRINT_WARNING("Warning: No compile command for " + sourcePath + ", using the default flags");
+				}
+				else
+				{
+					directory = commands.front().Directory;
+					arguments = CompilationGroups::ArgumentsFromCommand(commands.front());
+				}
+			}
+
+			arguments.insert(arguments.end(), toolArgs.begin(), toolArgs.end());
+			compilationGroups.Assign(sourcePath, std::move(directory), std::move(arguments));
+		}
+
+		if (compilationGroups.Size() > 1)
+		{
+			TERMINAL::GREEN_TEXT();
+			std::cout << "[INFO] " << sourcePaths.size() << " source files use " << compilationGroups.Size() << " distinct sets of compile flags" << std::endl;
+			TERMINAL::DEFAULT_TEXT();
+		}
+		flagsPhase.End();
+
+		// Check the ParseThreads and GenThreads config. If 0 set to hardware concurrency level
+		if (ParseThreads == 0)
+		{
+			ParseThreads = std::thread::hardware_concurrency();
+			if (ParseThreads == 0) // Fallback safety
+				ParseThreads = 1;
+		}
+
+		if (GenThreads == 0)
+		{
+			GenThreads = std::thread::hardware_concurrency();
+			if (GenThreads == 0) // Fallback safety
+				GenThreads = 1;
+		}
+
 		// --------------------------------------------------------------------------
 		// 1. Create a shared virtual file system overlay
 		// --------------------------------------------------------------------------
-		// Get the real file system.
-		llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> RealFS = llvm::vfs::getRealFileSystem();
-		// Create an in-memory file system for virtual file mappings.
-		llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem> InMemFS =
-			llvm::makeIntrusiveRefCnt<llvm::vfs::InMemoryFileSystem>();
+		RunStatistics::Scope fileSystemPhase("VFS setup");
+
+		// Files mapped into the virtual include directory, "SerializationMacros.h" maps to an empty file.
+		std::vector<std::pair<std::string, std::unique_ptr<llvm::MemoryBuffer>>> virtualFiles;
+		virtualFiles.emplace_back(virtualIncludeDir + "/SerializationMacros.h", llvm::MemoryBuffer::getMemBuffer("", "EmptyBuffer"));
+
+		// Hash of the contents and compile flags of each source, and the source behind each virtual path, for the generation cache
+		std::unordered_map<std::string, uint64_t> sourceHashes;
+		std::unordered_map<std::string, std::string> virtualSourcePaths;
+		// Sources whose text has no serialization marker, they cannot produce a generated header
+		std::unordered_set<std::string> unmarkedSources;
+
+		// Sources are read, hashed and scanned by the parse threads, then mapped in the order they were given
+		struct SourceRead
+		{
+			std::unique_ptr<llvm::MemoryBuffer> buffer;
+			uint64_t hash = 0;
+			bool marked = false;
+		};
 
-		// Map "SerializationMacros.h" to an empty file.
-		auto EmptyBuffer = llvm::MemoryBuffer::getMemBuffer("", "EmptyBuffer");
-		InMemFS->addFile(virtualIncludeDir + "/SerializationMacros.h", /*ModificationTime=*/0, std::move(EmptyBuffer));
+		std::vector<SourceRead> sourceReads(sourcePaths.size());
+		{
+			std::atomic<size_t> nextSource{ 0 };
+			auto readSources = [&]() {
+				for (size_t i = nextSource++; i < sourcePaths.size(); i = nextSource++)
+				{
+					auto buffer = llvm::MemoryBuffer::getFileAsStream(sourcePaths[i]);
+					if (!buffer)
+						continue;
+
+					std::string_view text((*buffer)->getBufferStart(), (*buffer)->getBufferSize());
+					uint64_t flagsHash = compilationGroups.GetGroup(compilationGroups.GetSourceGroup(sourcePaths[i])).flagsHash;
+					sourceReads[i].hash = GenerationCache::HashBytes(text, flagsHash);
+					sourceReads[i].marked = SourceScanner::ContainsSerializationMarkers(text);
+					sourceReads[i].buffer = std::move(*buffer);
+				}
+			};
+
+			std::vector<std::thread> readThreads;
+			size_t readThreadCount = std::min<size_t>(ParseThreads, sourcePaths.size());
+			for (size_t i = 1; i < readThreadCount; i++)
+			{
+				readThreads.emplace_back(readSources);
+			}
+			readSources();
+			for (auto& t : readThreads)
+			{
+				t.join();
+			}
+		}
 
 		// For each source file, map its corresponding .generated.h file to an empty file.
-		for (const auto& sourcePath : sourcePaths)
+		for (size_t i = 0; i < sourcePaths.size(); i++)
 		{
+			const std::string& sourcePath = sourcePaths[i];
 			std::filesystem::path path(sourcePath);
 
 			// Relative path inside the virtual include dir
 			std::filesystem::path virtualHeaderPath = virtualIncludeDir / path.filename();
 
-			// Map the source file into InMemFS
-			auto buffer = llvm::MemoryBuffer::getFileAsStream(sourcePath);
-			if (std::error_code ec = buffer.getError())
+			// Map the source file into the virtual include dir
+			SourceRead& read = sourceReads[i];
+			if (!read.buffer)
 			{
 				TERMINAL::PRINT_WARNING("Warning: Failed to read " + sourcePath);
 				continue;
 			}
 
-			InMemFS->addFile(virtualHeaderPath.string(), 0, std::move(*buffer));
+			std::string normalizedPath = GenerationCache::NormalizePath(path);
+			sourceHashes[normalizedPath] = read.hash;
+			virtualSourcePaths[virtualHeaderPath.string()] = normalizedPath;
+			if (!read.marked)
+				unmarkedSources.insert(normalizedPath);
+
+			virtualFiles.emplace_back(virtualHeaderPath.string(), std::move(read.buffer));
 
 			// Also map the associated .generated.h file to an empty buffer
-			auto emptyGenHeader = llvm::MemoryBuffer::getMemBuffer("", "EmptyGeneratedHeader");
 			std::filesystem::path virtualGenPath = virtualIncludeDir / path.filename().replace_extension(".generated.h");
-			InMemFS->addFile(virtualGenPath.string(), 0, std::move(emptyGenHeader));
+			virtualFiles.emplace_back(virtualGenPath.string(), llvm::MemoryBuffer::getMemBuffer("", "EmptyGeneratedHeader"));
+		}
+
+		// The file system caches every lookup, including the files that were not found, so the one of the previous run is only
+		// reused if nothing it looked at changed since
+		std::string workingDirectory = std::filesystem::current_path().string();
+		std::unordered_map<std::string, uint64_t> virtualFileHashes;
+		if (state.persistent)
+		{
+			for (const auto& [virtualPath, buffer] : virtualFiles)
+			{
+				virtualFileHashes[virtualPath] = GenerationCache::HashBytes(std::string_view(buffer->getBufferStart(), buffer->getBufferSize()));
+			}
 		}
 
-		// Create an overlay that first consults the in-memory FS, then the real FS.
-		auto OverlayFS = llvm::makeIntrusiveRefCnt<llvm::vfs::OverlayFileSystem>(InMemFS);
-		OverlayFS->pushOverlay(RealFS);
+		bool reuseFileSystem = state.trackingFileSystem && state.workingDirectory == workingDirectory &&
+			state.virtualFileHashes == virtualFileHashes && state.trackingFileSystem->IsUnchanged();
+		if (!reuseFileSystem)
+		{
+			// Get a physical file system with a working directory of its own, the shared layers are never moved out of the
+			// directory of the run, each parse thread keeps its working directory above them
+			llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> RealFS(llvm::vfs::createPhysicalFileSystem().release());
+			// Create an in-memory file system for virtual file mappings.
+			llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem> InMemFS =
+				llvm::makeIntrusiveRefCnt<llvm::vfs::InMemoryFileSystem>();
+			for (auto& [virtualPath, buffer] : virtualFiles)
+			{
+				InMemFS->addFile(virtualPath, /*ModificationTime=*/0, std::move(buffer));
+			}
+
+			// Create an overlay that first consults the in-memory FS, then the real FS.
+			auto OverlayFS = llvm::makeIntrusiveRefCnt<llvm::vfs::OverlayFileSystem>(InMemFS);
+			OverlayFS->pushOverlay(RealFS);
+
+			// Every parse thread looks files up through one cache, the tracking layer under it sees the first lookup of each
+			llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> baseFS = OverlayFS;
+			state.trackingFileSystem = state.persistent ? llvm::makeIntrusiveRefCnt<TrackingFileSystem>(OverlayFS) : nullptr;
+			if (state.trackingFileSystem)
+				baseFS = state.trackingFileSystem;
+			state.fileSystem = llvm::makeIntrusiveRefCnt<CachingFileSystem>(baseFS);
+
+			state.workingDirectory = std::move(workingDirectory);
+			state.virtualFileHashes = std::move(virtualFileHashes);
+			state.preludes.clear();
+		}
+		else
+		{
+			TERMINAL::GREEN_TEXT();
+			std::cout << "[INFO] Reusing the file state of the previous run" << std::endl;
+			TERMINAL::DEFAULT_TEXT();
+		}
 
+		// File managers are not thread-safe, each parse thread gets its own on top of the shared cache
 		clang::FileSystemOptions fsOpts;
-		auto FileMgr = llvm::makeIntrusiveRefCnt<clang::FileManager>(fsOpts, OverlayFS);
+		fileSystemPhase.End();
 
-		// Global storage for per-file SAST trees
-		std::unordered_map<std::string, std::vector<std::shared_ptr<SASTNode>>> globalSASTTrees;
+		// Global storage for the parsed types, by name
 		std::unordered_map<std::string, std::shared_ptr<SASTNode>> globalSASTMap;
-		std::mutex globalsMutex;
 
-		DynamicPluginLoader pluginLoader;
+		RunStatistics::Scope pluginPhase("Plugin load");
+		auto& pluginLoader = state.pluginLoader;
+		size_t loadedPluginCount = pluginLoader.GetLoadedPluginPaths().size();
 
 		// 1. Load plugins from directory, if provided
-		if (!PluginDirectory.empty())
+		if (!PluginDirectory.empty() && state.pluginSources.insert(GenerationCache::NormalizePath(PluginDirectory.getValue())).second)
 		{
 			TERMINAL::GREEN_TEXT();
 			std::cout << "[INFO] Scanning plugin directory: " << PluginDirectory << std::endl;
@@ -171,6 +477,9 @@ int main(int argc, const char** argv)
 		// 2. Load plugins from explicit paths, if provided
 		for (const auto& pluginPath : PluginFiles)
 		{
+			if (!state.pluginSources.insert(GenerationCache::NormalizePath(pluginPath)).second)
+				continue;
+
 			TERMINAL::GREEN_TEXT();
 			std::cout << "[INFO] Loading plugin from file: " << pluginPath << std::endl;
 			TERMINAL::DEFAULT_TEXT();
@@ -183,84 +492,571 @@ int main(int argc, const char** argv)
 			}
 		}
 
-		// Check the ParseThreads and GenThreads config. If 0 set to hardware concurrency level
-		if (ParseThreads == 0)
+		// 3. Only plugins for formats some type actually requests get created, on the first lookup of the format. The loader
+		// outlives every lookup, generation finishes before the state is destroyed. Setting the resolver again after a request
+		// of the daemon loads new plugins makes every format resolve once more, so a new plugin for a format an earlier request
+		// looked up is created and replaces the old one
+		if (!state.pluginResolverSet || pluginLoader.GetLoadedPluginPaths().size() != loadedPluginCount)
 		{
-			ParseThreads = std::thread::hardware_concurrency();
-			if (ParseThreads == 0) // Fallback safety
-				ParseThreads = 1;
+			FileFormatRegistry::GetInstance().SetPluginResolver([&pluginLoader](const std::string& formatName) {
+				pluginLoader.CreatePluginsForFormat(formatName);
+				});
+
+			// Lookups from the generation threads read an immutable table from here on
+			if (!state.pluginResolverSet)
+			{
+				FileFormatRegistry::GetInstance().Freeze();
+				state.pluginResolverSet = true;
+			}
 		}
+		pluginPhase.End();
 
-		// Step 1: Parallel Parsing
-		std::vector<std::thread> parseThreads;
-		size_t chunkSize = (sourcePaths.size() + ParseThreads - 1) / ParseThreads;
-		for (size_t i = 0; i < sourcePaths.size(); i += chunkSize)
+		// A parsed source on its way to the code generation workers
+		struct ParsedSource
+		{
+			std::string filePath;
+			std::vector<std::shared_ptr<SASTNode>> SASTTree;
+			std::vector<std::string> dependencies;
+			bool failed = false;
+			// Restored from the SAST cache, no need to store it again
+			bool stored = false;
+		};
+
+		// Sources whose inputs match the previous run already have an up to date generated header, skip parsing them
+		GenerationCache* cache = nullptr;
+		TypeIndex* typeIndex = nullptr;
+		SASTCache* sastCache = nullptr;
+		std::vector<std::string> pendingSources;
+		RunStatistics::Scope cachePhase("Cache check");
+		if (NoCache)
+		{
+			pendingSources.assign(sourcePaths.begin(), sourcePaths.end());
+		}
+		else
 		{
-			std::vector<std::string> fileChunk(sourcePaths.begin() + i, sourcePaths.begin() + std::min(i + chunkSize, sourcePaths.size()));
+			// Plugins change the output of every source, so they key the whole cache, compile flags are part of each source hash.
+			// The static plugins are part of the executable, dynamic plugins are identified by their files
+			uint64_t configHash = GenerationCache::HashBytes({});
 
-			parseThreads.emplace_back([&, fileChunk = std::move(fileChunk)]() {	
-				SASTGeneratorActionFactory factory;
-				ClangTool tool(*Compilations, fileChunk, std::make_shared<clang::PCHContainerOperations>(), OverlayFS, FileMgr);
+			// The prelude contents are tracked through the dependencies of each source, only whether one is used is config
+			std::string preludePath = Prelude.empty() ? std::string() : GenerationCache::NormalizePath(Prelude.getValue());
+			configHash = GenerationCache::HashBytes(std::string_view(preludePath.c_str(), preludePath.size() + 1), configHash);
 
-				int result = tool.run(&factory);
-				if (result)
-					TERMINAL::PRINT_WARNING_S("Error while processing a file chunk");
+			std::string executablePath = llvm::sys::fs::getMainExecutable(argv0, reinterpret_cast<void*>(&ExecutableAnchor));
+			std::vector<std::string> pluginPaths = pluginLoader.GetLoadedPluginPaths();
+			pluginPaths.push_back(executablePath);
+			for (const auto& pluginPath : pluginPaths)
+			{
+				configHash = GenerationCache::HashBytes(std::string_view(pluginPath.c_str(), pluginPath.size() + 1), configHash);
+				uint64_t stamp = GenerationCache::HashFileStamp(pluginPath).value_or(0);
+				configHash = GenerationCache::HashBytes(std::string_view(reinterpret_cast<const char*>(&stamp), sizeof(stamp)), configHash);
+			}
+
+			// Another process may have written the files since the previous run of a daemon saw them
+			std::string cachePath = GenerationCache::NormalizePath(CacheFile.getValue());
+			auto cacheStamp = GenerationCache::HashFileStamp(cachePath);
+			if (!state.cache || state.cachePath != cachePath || state.cacheConfigHash != configHash || state.cacheStamp != cacheStamp)
+			{
+				state.cache = std::make_unique<GenerationCache>(cachePath, configHash);
+				state.cache->Load();
+				state.cachePath = std::move(cachePath);
+				state.cacheConfigHash = configHash;
+				state.cacheStamp = cacheStamp;
+			}
+			cache = state.cache.get();
 
-				// Merge per-file SASTs into global storage
-				std::lock_guard<std::mutex> lock(globalsMutex);
-				factory.MergeResults(globalSASTTrees, globalSASTMap);
+			std::string typeIndexPath = GenerationCache::NormalizePath(TypeIndexFile.getValue());
+			auto typeIndexStamp = GenerationCache::HashFileStamp(typeIndexPath);
+			if (!state.typeIndex || state.typeIndexPath != typeIndexPath || state.typeIndexStamp != typeIndexStamp)
+			{
+				state.typeIndex = std::make_unique<TypeIndex>(typeIndexPath);
+				state.typeIndex->Load();
+				state.typeIndexPath = std::move(typeIndexPath);
+				state.typeIndexStamp = typeIndexStamp;
+			}
+			typeIndex = state.typeIndex.get();
+
+			// Stored SASTs only depend on the parser, not on the plugins. A daemon also keeps the entries it read or wrote in memory
+			std::string sastCacheDir = GenerationCache::NormalizePath(SASTCacheDir.getValue());
+			if (!state.sastCache || state.sastCacheDir != sastCacheDir)
+			{
+				state.sastCache = std::make_unique<SASTCache>(sastCacheDir, GenerationCache::HashFileStamp(executablePath).value_or(0), state.persistent);
+				state.sastCacheDir = std::move(sastCacheDir);
+			}
+			sastCache = state.sastCache.get();
+
+			for (const auto& sourcePath : sourcePaths)
+			{
+				auto hash = sourceHashes.find(GenerationCache::NormalizePath(sourcePath));
+				if (hash == sourceHashes.end() ||
+					!cache->IsUpToDate(hash->first, hash->second, GeneratedFileManager(std::filesystem::path{sourcePath}).GetGeneratedHeaderPath()))
+				{
+					pendingSources.push_back(sourcePath);
+				}
+			}
+
+			if (pendingSources.size() != sourcePaths.size())
+			{
+				TERMINAL::GREEN_TEXT();
+				std::cout << "[INFO] " << sourcePaths.size() - pendingSources.size() << " of " << sourcePaths.size() << " source files are up to date" << std::endl;
+				TERMINAL::DEFAULT_TEXT();
+			}
+		}
+
+		cachePhase.End();
+
+		// A source without types keeps no header of an earlier run, whose stale macros would keep being compiled into the build.
+		// With a stamp it gets an empty header instead, the build system expects every header as a byproduct of the run
+		auto clearGeneratedFile = [&](const std::filesystem::path& sourceFile, uint64_t* outputHash) {
+			GeneratedFileManager fileManager(sourceFile);
+			if (!Stamp.empty())
+				return fileManager.UpdateGeneratedFile(GeneratedCode{}, outputHash);
+			return fileManager.RemoveGeneratedFile();
+		};
+
+		// Most sources fed in have no serializable types, skip Clang for them entirely. They are still mapped into the virtual
+		// file system above, since marked sources may include them
+		if (!NoPrefilter)
+		{
+			size_t pendingCount = pendingSources.size();
+			std::erase_if(pendingSources, [&](const std::string& sourcePath) {
+				std::string normalizedPath = GenerationCache::NormalizePath(sourcePath);
+				if (!unmarkedSources.contains(normalizedPath))
+					return false;
+
+				// The entry is not recorded until the header is cleared, so the next run tries again
+				GenerationCacheEntry cacheEntry;
+				if (!clearGeneratedFile(std::filesystem::path{ sourcePath }, &cacheEntry.outputHash))
+					return true;
+
+				// Without markers the output does not depend on any include
+				if (cache)
+				{
+					cacheEntry.sourceHash = sourceHashes[normalizedPath];
+					cache->Update(normalizedPath, std::move(cacheEntry));
+				}
+				return true;
 			});
+
+			if (pendingSources.size() != pendingCount)
+			{
+				TERMINAL::GREEN_TEXT();
+				std::cout << "[INFO] Skipping " << pendingCount - pendingSources.size() << " source files without serialization markers" << std::endl;
+				TERMINAL::DEFAULT_TEXT();
+			}
 		}
 
-		// Wait for all parse threads to finish
-		for (auto& t : parseThreads)
+		// Sources that need a new header but whose SAST was stored from the same inputs go straight to code generation
+		std::vector<ParsedSource> cachedSources;
+		RunStatistics::Scope sastCachePhase("SAST cache load");
+		if (sastCache)
 		{
-			t.join();
+			std::erase_if(pendingSources, [&](const std::string& sourcePath) {
+				std::string normalizedPath = GenerationCache::NormalizePath(sourcePath);
+				auto hash = sourceHashes.find(normalizedPath);
+				if (hash == sourceHashes.end())
+					return false;
+
+				auto entry = sastCache->Load(normalizedPath, hash->second);
+				if (!entry)
+					return false;
+
+				cachedSources.push_back({ std::move(normalizedPath), std::move(entry->SASTTree), std::move(entry->dependencies), false, true });
+				return true;
+			});
+
+			if (!cachedSources.empty())
+			{
+				TERMINAL::GREEN_TEXT();
+				std::cout << "[INFO] Generating " << cachedSources.size() << " source files from stored SASTs" << std::endl;
+				TERMINAL::DEFAULT_TEXT();
+			}
 		}
 
-		if (GenThreads == 0)
+		sastCachePhase.End();
+
+		// Parse workers claim one source at a time, largest first, so a heavy file never holds up a batch of others.
+		// Each parsed source goes straight to the code generation workers, generation overlaps with the remaining parses
+		FileWorkList parseWork(std::move(pendingSources));
+		WorkQueue<ParsedSource> generationQueue;
+		size_t generationCount = parseWork.Size() + cachedSources.size();
+		for (auto& cachedSource : cachedSources)
 		{
-			GenThreads = std::thread::hardware_concurrency();
-			if (GenThreads == 0) // Fallback safety
-				GenThreads = 1;
+			generationQueue.Push(std::move(cachedSource));
 		}
 
-		// Step 2: Parallel Code Generation
-		std::vector<std::thread> codeGenThreads;
-		chunkSize = (globalSASTTrees.size() + GenThreads - 1) / GenThreads;
-		auto iterator = globalSASTTrees.begin();
-		for (size_t i = 0; i < globalSASTTrees.size(); i += chunkSize)
+		// Shared by every ClangTool of the run
+		const auto& PCHContainerOps = state.PCHContainerOps;
+
+		// Precompile the prelude once per set of compile flags that has sources to parse, ahead of the parse workers. A prelude
+		// built on a file system that is reused is still up to date
+		std::vector<std::shared_ptr<PrecompiledPrelude>> groupPreludes(compilationGroups.Size());
+		if (!Prelude.empty())
 		{
-			std::vector<std::pair<std::string, std::vector<std::shared_ptr<SASTNode>>>> localChunk;
+			std::vector<bool> groupPending(compilationGroups.Size(), false);
+			for (const auto& sourcePath : parseWork.Files())
+			{
+				groupPending[compilationGroups.GetSourceGroup(sourcePath)] = true;
+			}
 
-			for (size_t j = 0; j < chunkSize && iterator != globalSASTTrees.end(); j++, iterator++)
+			for (size_t i = 0; i < compilationGroups.Size(); i++)
 			{
-				localChunk.emplace_back(*iterator);
+				if (!groupPending[i])
+					continue;
+
+				// Absolute, the PCH is written relative to the process but read through the file system of the parse
+				std::string pchPath = GenerationCache::NormalizePath(PreludePCH.getValue());
+				if (compilationGroups.Size() > 1)
+					pchPath += "." + std::to_string(i);
+
+				std::string preludeKey = Prelude.getValue() + '\0' + pchPath + '\0' + std::to_string(compilationGroups.GetGroup(i).flagsHash);
+				if (auto builtPrelude = state.preludes.find(preludeKey); builtPrelude != state.preludes.end())
+				{
+					groupPreludes[i] = builtPrelude->second;
+					continue;
+				}
+
+				RunStatistics::Scope preludePhase("Prelude build", pchPath);
+				auto prelude = std::make_shared<PrecompiledPrelude>(GenerationCache::NormalizePath(Prelude.getValue()), pchPath);
+				auto preludeFileSystem = llvm::makeIntrusiveRefCnt<WorkingDirectoryFileSystem>(state.fileSystem, state.workingDirectory);
+				auto preludeFileManager = llvm::makeIntrusiveRefCnt<clang::FileManager>(fsOpts, preludeFileSystem);
+				if (prelude->Build(*compilationGroups.GetGroup(i).compilations, preludeFileSystem, preludeFileManager, PCHContainerOps))
+				{
+					// The PCH was written during the run, what the cache knew of an earlier one is stale
+					state.fileSystem->Invalidate(pchPath);
+					groupPreludes[i] = prelude;
+					state.preludes[preludeKey] = std::move(prelude);
+				}
 			}
+		}
+
+		// Types parsed by one thread, merged into the global storage once every parse is done
+		using SASTShard = std::unordered_map<std::string, std::shared_ptr<SASTNode>>;
+
+		// Step 1: Parallel Parsing
+		std::vector<std::thread> parseThreads;
+		size_t parseThreadCount = std::min<size_t>(ParseThreads, parseWork.Size());
+		std::vector<SASTShard> parseShards(parseThreadCount);
+		for (size_t i = 0; i < parseThreadCount; i++)
+		{
+			parseThreads.emplace_back([&, &shard = parseShards[i]]() {
+				// Each ClangTool moves into the directory of its compile command, on this thread's view of the shared file system
+				auto threadFileSystem = llvm::makeIntrusiveRefCnt<WorkingDirectoryFileSystem>(state.fileSystem, state.workingDirectory);
 
-			codeGenThreads.emplace_back([&, localChunk = std::move(localChunk)]() {
-				for (const auto& [filePath, SASTTree] : localChunk)
+				// Created for a set of compile flags the first time this thread parses a source using it
+				std::vector<llvm::IntrusiveRefCntPtr<clang::FileManager>> fileManagers(compilationGroups.Size());
+
+				while (auto sourcePath = parseWork.Next())
 				{
-					if (SASTTree.empty())
-						continue;
+					size_t groupIndex = compilationGroups.GetSourceGroup(*sourcePath);
+					if (!fileManagers[groupIndex])
+						fileManagers[groupIndex] = llvm::makeIntrusiveRefCnt<clang::FileManager>(fsOpts, threadFileSystem);
+					const auto& prelude = groupPreludes[groupIndex];
+
+					RunStatistics::Scope parsePhase("Parse", *sourcePath);
+					SASTGeneratorActionFactory factory;
+					ClangTool tool(*compilationGroups.GetGroup(groupIndex).compilations, { GenerationCache::NormalizePath(*sourcePath) }, PCHContainerOps, threadFileSystem, fileManagers[groupIndex]);
+					if (prelude)
+						tool.appendArgumentsAdjuster(prelude->GetArgumentsAdjuster());
+
+					int result = tool.run(&factory);
+					parsePhase.End();
+					if (result)
+						TERMINAL::PRINT_WARNING_S("Error while processing " + *sourcePath);
+
+					// Output of a source with errors is not trusted for the next run, and the headers loaded from the prelude PCH
+					// are dependencies of the source too
+					for (auto& parsed : factory.TakeResults())
+					{
+						// Relink the types into this thread's shard, no other thread touches it
+						shard.merge(parsed.SASTMap);
+
+						ParsedSource parsedSource{ std::move(parsed.filePath), std::move(parsed.SASTTree), std::move(parsed.dependencies), result != 0 };
+						if (prelude)
+							parsedSource.dependencies.insert(parsedSource.dependencies.end(), prelude->GetDependencies().begin(), prelude->GetDependencies().end());
+
+						generationQueue.Push(std::move(parsedSource));
+					}
+				}
+			});
+		}
+
+		// Threads left over when there are fewer sources than generation threads help with the types of each source
+		size_t genThreadCount = std::min<size_t>(GenThreads, generationCount);
+		size_t codeGenThreadBudget = std::max<size_t>(1, GenThreads / std::max<size_t>(genThreadCount, 1));
+
+		// The includes of each generated source, for the dependency file
+		std::unordered_map<std::string, std::vector<std::string>> sourceDependencies;
+		std::mutex sourceDependenciesMutex;
+
+		// Generate the header of a parsed source and record it in the generation cache
+		auto generateSource = [&](const ParsedSource& parsedSource) {
+			const auto& [filePath, SASTTree, dependencies, failed, stored] = parsedSource;
+
+			GenerationCacheEntry cacheEntry;
+			GeneratedFileManager fileManager(std::filesystem::path{filePath});
+
+			if (!SASTTree.empty())
+			{
+				CodeGenerator codeGen(SASTTree, codeGenThreadBudget);
+				GeneratedCode generatedCode = codeGen.GenerateCode();
+
+				if (statistics.IsEnabled())
+				{
+					size_t fieldCount = 0;
+					for (const auto& node : SASTTree)
+					{
+						fieldCount += node->fields.size();
+					}
+
+					size_t codeSize = 0;
+					for (const auto& [typeName, formats] : generatedCode.code)
+					{
+						for (const auto& [format, code] : formats)
+						{
+							codeSize += code.size();
+						}
+					}
+
+					statistics.AddCount("Generated headers", 1);
+					statistics.AddCount("Types", SASTTree.size());
+					statistics.AddCount("Fields", fieldCount);
+					statistics.AddCount("Generated code bytes", codeSize);
+				}
+
+				RunStatistics::Scope writePhase("Write", filePath);
+				if (!fileManager.UpdateGeneratedFile(generatedCode, &cacheEntry.outputHash))
+				{
+					TERMINAL::PRINT_ERROR_S("ERROR: Failed to update generated header for " + filePath);
+					return;
+				}
+			}
+			else if (!failed && !clearGeneratedFile(std::filesystem::path{ filePath }, &cacheEntry.outputHash))
+			{
+				TERMINAL::PRINT_ERROR_S("ERROR: Failed to clear generated header for " + filePath);
+				return;
+			}
+
+			std::string sourcePath = GenerationCache::NormalizePath(filePath);
+
+			// Record the includes by their real path, the virtual copies of sources map back to the source file
+			std::vector<std::string> dependencyPaths;
+			for (const auto& dependency : dependencies)
+			{
+				std::string dependencyPath;
+				if (auto virtualSource = virtualSourcePaths.find(dependency); virtualSource != virtualSourcePaths.end())
+					dependencyPath = virtualSource->second;
+				else if (dependency.starts_with(virtualIncludeDir))
+					continue;
+				else
+					dependencyPath = GenerationCache::NormalizePath(dependency);
 
-					CodeGenerator codeGen(SASTTree);
-					GeneratedCode generatedCode = codeGen.GenerateCode();
+				if (dependencyPath == sourcePath)
+					continue;
 
-					GeneratedFileManager fileManager(std::filesystem::path{filePath});
-					if (!fileManager.UpdateGeneratedFile(generatedCode))
+				dependencyPaths.push_back(std::move(dependencyPath));
+			}
+
+			// A source that failed to parse still reruns when one of its includes is fixed
+			if (!DepFile.empty())
+			{
+				std::lock_guard<std::mutex> lock(sourceDependenciesMutex);
+				sourceDependencies[sourcePath] = dependencyPaths;
+			}
+
+			if (!cache || failed)
+				return;
+
+			auto sourceHash = sourceHashes.find(sourcePath);
+			if (sourceHash == sourceHashes.end())
+				return;
+			cacheEntry.sourceHash = sourceHash->second;
+
+			for (auto& dependencyPath : dependencyPaths)
+			{
+				auto dependencyHash = GenerationCache::HashFile(dependencyPath);
+				if (!dependencyHash)
+					return;
+				cacheEntry.dependencies.emplace_back(std::move(dependencyPath), *dependencyHash);
+			}
+
+			if (sastCache && !stored && !SASTTree.empty())
+				sastCache->Store(sourcePath, cacheEntry.sourceHash, cacheEntry.dependencies, SASTTree);
+
+			cache->Update(sourcePath, std::move(cacheEntry));
+		};
+
+		// Sources referencing types their translation unit does not define wait for the complete set of types
+		std::vector<ParsedSource> unlinkedSources;
+		std::mutex unlinkedSourcesMutex;
+
+		// Step 2: Parallel Code Generation
+		std::vector<std::thread> codeGenThreads;
+		for (size_t i = 0; i < genThreadCount; i++)
+		{
+			codeGenThreads.emplace_back([&]() {
+				while (auto parsedSource = generationQueue.Pop())
+				{
+					if (!SASTLinker::IsLinked(parsedSource->SASTTree))
 					{
-						TERMINAL::PRINT_ERROR_S("ERROR: Failed to update generated header for " + filePath);
+						std::lock_guard<std::mutex> lock(unlinkedSourcesMutex);
+						unlinkedSources.push_back(std::move(*parsedSource));
+						continue;
 					}
+
+					generateSource(*parsedSource);
 				}
 			});
 		}
 
+		// Wait for all parse threads to finish, then let the code generation threads drain the queue
+		for (auto& t : parseThreads)
+		{
+			t.join();
+		}
+		generationQueue.Close();
+
+		// Splice the shards into the global storage, starting from the largest. Nodes are relinked rather than copied or
+		// reallocated, and no lock is needed now that the parse threads are done
+		std::sort(parseShards.begin(), parseShards.end(), [](const SASTShard& a, const SASTShard& b) { return a.size() > b.size(); });
+		if (!parseShards.empty())
+			globalSASTMap = std::move(parseShards.front());
+		for (size_t i = 1; i < parseShards.size(); i++)
+		{
+			globalSASTMap.merge(parseShards[i]);
+		}
+
 		for (auto& t : codeGenThreads)
 		{
 			t.join();
 		}
 
+		// The types of the sources parsed this run, with their files named like the sources, update the type index
+		for (auto& [name, node] : globalSASTMap)
+		{
+			if (auto virtualSource = virtualSourcePaths.find(node->sourceFile); virtualSource != virtualSourcePaths.end())
+				node->sourceFile = virtualSource->second;
+			else if (!node->sourceFile.empty())
+				node->sourceFile = GenerationCache::NormalizePath(node->sourceFile);
+		}
+
+		if (typeIndex)
+		{
+			RunStatistics::Scope indexPhase("Type index update");
+			std::vector<std::string> refreshedFiles;
+			refreshedFiles.reserve(parseWork.Size() + unmarkedSources.size());
+			for (const auto& sourcePath : parseWork.Files())
+			{
+				refreshedFiles.push_back(GenerationCache::NormalizePath(sourcePath));
+			}
+
+			// A source without markers defines no types, whatever an earlier run indexed from it is stale even though it was
+			// not parsed. Sources restored from the SAST cache always define types, they were indexed when they were stored
+			refreshedFiles.insert(refreshedFiles.end(), unmarkedSources.begin(), unmarkedSources.end());
+
+			typeIndex->PruneMissingFiles();
+			typeIndex->Update(globalSASTMap, refreshedFiles);
+		}
+
+		// Link the remaining sources against every known type, including those of sources that were not parsed this run. The
+		// files defining the linked types become dependencies of the source
+		const auto& linkMap = typeIndex ? typeIndex->GetNodes() : globalSASTMap;
+		for (auto& parsedSource : unlinkedSources)
+		{
+			RunStatistics::Scope linkPhase("Link", parsedSource.filePath);
+			SASTLinker linker(parsedSource.SASTTree, linkMap);
+			linker.Link();
+			linkPhase.End();
+
+			for (const auto& linkedNode : linker.GetLinkedNodes())
+			{
+				if (!linkedNode->sourceFile.empty())
+					parsedSource.dependencies.push_back(linkedNode->sourceFile);
+			}
+
+			generateSource(parsedSource);
+		}
+
+		RunStatistics::Scope savePhase("Cache save");
+		if (cache)
+		{
+			cache->Save();
+			state.cacheStamp = GenerationCache::HashFileStamp(state.cachePath);
+		}
+
+		if (typeIndex)
+		{
+			typeIndex->Save();
+			state.typeIndexStamp = GenerationCache::HashFileStamp(state.typeIndexPath);
+		}
+		savePhase.End();
+
+		// Every source gets a rule, those that were not generated this run keep the includes recorded by the cache. With a stamp
+		// the inputs of every source go into the one rule of the stamp
+		if (!DepFile.empty())
+		{
+			DependencyFile depfile;
+			std::vector<std::string> stampInputs;
+			std::unordered_set<std::string> stampInputSet;
+			for (const auto& sourceFile : sourcePaths)
+			{
+				std::string sourcePath = GenerationCache::NormalizePath(sourceFile);
+				std::vector<std::string> inputs = { sourcePath };
+				if (auto generated = sourceDependencies.find(sourcePath); generated != sourceDependencies.end())
+				{
+					inputs.insert(inputs.end(), generated->second.begin(), generated->second.end());
+				}
+				else if (cache)
+				{
+					std::vector<std::string> recorded = cache->GetDependencies(sourcePath);
+					inputs.insert(inputs.end(), recorded.begin(), recorded.end());
+				}
+
+				if (Stamp.empty())
+				{
+					depfile.AddRule(GenerationCache::NormalizePath(GeneratedFileManager(std::filesystem::path{sourceFile}).GetGeneratedHeaderPath()), inputs);
+					continue;
+				}
+
+				for (auto& input : inputs)
+				{
+					if (stampInputSet.insert(input).second)
+						stampInputs.push_back(std::move(input));
+				}
+			}
+
+			if (!Stamp.empty())
+				depfile.AddRule(GenerationCache::NormalizePath(Stamp.getValue()), stampInputs);
+
+			if (!depfile.Write(DepFile.getValue()))
+			{
+				TERMINAL::PRINT_ERROR("ERROR: Failed to write dependency file " + DepFile.getValue());
+				return 1;
+			}
+		}
+
+		// Rewritten even when empty, only its modification time matters
+		if (!Stamp.empty())
+		{
+			if (std::error_code ec = WriteFileAtomically(Stamp.getValue(), {}))
+			{
+				TERMINAL::PRINT_ERROR("ERROR: Failed to touch stamp file " + Stamp.getValue() + ": " + ec.message());
+				return 1;
+			}
+		}
+
+		if (Stats)
+		{
+			statistics.Stop();
+			statistics.PrintSummary(std::cout);
+			if (statistics.WriteChromeTrace(StatsTrace.getValue()))
+			{
+				TERMINAL::GREEN_TEXT();
+				std::cout << "[INFO] Wrote the trace of the run to " << StatsTrace.getValue() << std::endl;
+				TERMINAL::DEFAULT_TEXT();
+			}
+		}
+
 		return 0;
 	}
 	catch (const std::exception& ex)
@@ -269,4 +1065,173 @@ int main(int argc, const char** argv)
 
 		return 1;
 	}
-}
\ No newline at end of file
+}
+#if !defined(_WIN32)
+// Parse the command line of a request and run it
+static int RunRequest(WarmState& state, const DaemonRequest& request, const char* argv0)
+{
+	// The help and version printers exit the process, they are only served by the executable itself
+	for (const auto& argument : request.arguments)
+	{
+		std::string_view option = argument;
+		while (option.starts_with('-'))
+			option.remove_prefix(1);
+
+		if (option.starts_with("help") || option == "version")
+		{
+			TERMINAL::PRINT_ERROR("ERROR: " + argument + " is not served by the daemon, run GenSerialize directly");
+			return 1;
+		}
+	}
+
+	std::vector<const char*> argv = { argv0 };
+	for (const auto& argument : request.arguments)
+	{
+		argv.push_back(argument.c_str());
+	}
+
+	// Options keep the values of the previous request until reset
+	llvm::cl::ResetAllOptionOccurrences();
+	if (!llvm::cl::ParseCommandLineOptions(static_cast<int>(argv.size()), argv.data(), Overview, &llvm::errs()))
+		return 1;
+
+	if (!ServerSocket.empty() || WatchSources)
+	{
+		TERMINAL::PRINT_ERROR("ERROR: --server and --watch are not accepted by a running daemon");
+		return 1;
+	}
+
+	return Generate(state, argv0);
+}
+#endif
+
+// Serve the runs requested through the socket one at a time, each starts from the state the previous one left behind
+static int Serve(const std::string& socketPath, const char* argv0)
+{
+#if defined(_WIN32)
+	TERMINAL::PRINT_ERROR("ERROR: --server is only supported on POSIX systems");
+	return 1;
+#else
+	DaemonServer server(socketPath);
+	if (!server.Listen())
+	{
+		TERMINAL::PRINT_ERROR("ERROR: Could not listen on " + socketPath + ", is another daemon running?");
+		return 1;
+	}
+
+	TERMINAL::GREEN_TEXT();
+	std::cout << "[INFO] Serving generation requests on " << socketPath << std::endl;
+	TERMINAL::DEFAULT_TEXT();
+
+	std::filesystem::path serverDirectory = std::filesystem::current_path();
+	int serverOutput = dup(STDOUT_FILENO);
+	int serverError = dup(STDERR_FILENO);
+
+	WarmState state;
+	state.persistent = true;
+
+	while (auto request = server.Accept())
+	{
+		// The run writes to the streams of the client and resolves its paths against the directory of the client
+		dup2(request->outputFd, STDOUT_FILENO);
+		dup2(request->errorFd, STDERR_FILENO);
+
+		int exitCode = 1;
+		std::error_code errorCode;
+		std::filesystem::current_path(request->workingDirectory, errorCode);
+		if (errorCode)
+			TERMINAL::PRINT_ERROR("ERROR: Could not enter " + request->workingDirectory + ": " + errorCode.message());
+		else
+			exitCode = RunRequest(state, *request, argv0);
+
+		std::cout.flush();
+		std::cerr.flush();
+		llvm::outs().flush();
+		llvm::errs().flush();
+		std::fflush(nullptr);
+
+		dup2(serverOutput, STDOUT_FILENO);
+		dup2(serverError, STDERR_FILENO);
+		std::filesystem::current_path(serverDirectory, errorCode);
+
+		if (!request->Reply(exitCode))
+			TERMINAL::PRINT_WARNING("Warning: Client disconnected before its run finished");
+	}
+
+	close(serverOutput);
+	close(serverError);
+	return 0;
+#endif
+}
+
+// Regenerate whenever a source or a file it included changes, each run starts from the state the previous one left behind so
+// only the affected sources are parsed again
+static int Watch(const char* argv0)
+{
+	FileWatcher watcher;
+	WarmState state;
+	state.persistent = true;
+
+	while (true)
+	{
+		int exitCode = Generate(state, argv0);
+
+		// The includes of each source are known from its cache entry, without the cache only the sources are watched
+		std::vector<std::string> watchedPaths;
+		for (const auto& sourcePath : SourceFiles)
+		{
+			std::string normalizedPath = GenerationCache::NormalizePath(sourcePath);
+			if (state.cache)
+			{
+				std::vector<std::string> dependencies = state.cache->GetDependencies(normalizedPath);
+				watchedPaths.insert(watchedPaths.end(), dependencies.begin(), dependencies.end());
+			}
+			watchedPaths.push_back(std::move(normalizedPath));
+		}
+		std::sort(watchedPaths.begin(), watchedPaths.end());
+		watchedPaths.erase(std::unique(watchedPaths.begin(), watchedPaths.end()), watchedPaths.end());
+
+		if (watchedPaths.empty())
+			return exitCode;
+
+		if (!watcher.Watch(watchedPaths))
+		{
+			TERMINAL::PRINT_ERROR("ERROR: Could not watch the sources, --watch is only supported on Linux");
+			return 1;
+		}
+
+		TERMINAL::GREEN_TEXT();
+		std::cout << "[INFO] Watching " << watchedPaths.size() << " files for changes" << std::endl;
+		TERMINAL::DEFAULT_TEXT();
+
+		std::vector<std::string> changes = watcher.WaitForChanges();
+		if (changes.empty())
+			return exitCode;
+
+		TERMINAL::GREEN_TEXT();
+		std::cout << "[INFO] " << changes.size() << " watched files changed, regenerating" << std::endl;
+		TERMINAL::DEFAULT_TEXT();
+	}
+}
+
+int main(int argc, const char** argv)
+{
+	llvm::cl::HideUnrelatedOptions(AllCategories);
+	llvm::cl::ParseCommandLineOptions(argc, argv, Overview);
+
+	if (!ServerSocket.empty())
+	{
+		if (WatchSources)
+		{
+			TERMINAL::PRINT_ERROR("ERROR: --server and --watch cannot be combined");
+			return 1;
+		}
+		return Serve(ServerSocket.getValue(), argv[0]);
+	}
+
+	if (WatchSources)
+		return Watch(argv[0]);
+
+	WarmState state;
+	return Generate(state, argv[0]);
+}
@@ -197,20 +197,40 @@ class SERIALIZABLE(JSON) TestType {
  \
 static void JSONSerialize(JSONObject& jsonReceiver, const TestType& objSource) \
 { \
-	jsonReceiver.AddMember("value", JSONNumber(static_cast<double>(objSource.value))); \
+	jsonReceiver.AddMember("value", JSONNumber(static_cast<int32_t>(objSource.value))); \
  \
 } \
  \
 static void JSONDeserialize(TestType& objReceiver, const JSONObject& jsonSource) \
 { \
-	objReceiver.value = jsonSource.GetMember("value").as<JSONNumber>().value; \
- \
+	uint64_t found_1[1] = {}; \
+	for(const auto& [key_1, value_1] : jsonSource.GetMembers()) \
+	{ \
+		switch(key_1.size()) \
+		{ \
+		case 5: \
+			if(key_1 == "value") \
+			{ \
+				objReceiver.value = value_1.as<JSONNumber>().Get<int32_t>(); \
+				found_1[0] |= 0x1ull; \
+			} \
+			break; \
+		default: \
+			break; \
+		} \
+	} \
+	if((found_1[0] & 0x1ull) != 0x1ull) \
+	{ \
+		std::string missing_1; \
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " value"; \
+		throw std::runtime_error("Missing required key(s) in JSON object for TestType:" + missing_1); \
+	} \
 } \
  \
 static void JSONSerialize(std::ostream& osReceiver, const TestType& objSource) \
 { \
 	JSONStructure jsonRep; \
-	jsonRep.AddMember("value", JSONNumber(static_cast<double>(objSource.value))); \
+	jsonRep.AddMember("value", JSONNumber(static_cast<int32_t>(objSource.value))); \
  \
 	osReceiver << jsonRep.Stringify(); \
 } \
@@ -218,8 +238,28 @@ static void JSONSerialize(std::ostream& osReceiver, const TestType& objSource) \
 static void JSONDeserialize(TestType& objReceiver, const std::istream& isSource) \
 { \
 	JSONStructure jsonRep = JSONStructure::Parse(isSource); \
-	objReceiver.value = jsonRep.GetMember("value").as<JSONNumber>().value; \
- \
+	uint64_t found_1[1] = {}; \
+	for(const auto& [key_1, value_1] : jsonRep.GetMembers()) \
+	{ \
+		switch(key_1.size()) \
+		{ \
+		case 5: \
+			if(key_1 == "value") \
+			{ \
+				objReceiver.value = value_1.as<JSONNumber>().Get<int32_t>(); \
+				found_1[0] |= 0x1ull; \
+			} \
+			break; \
+		default: \
+			break; \
+		} \
+	} \
+	if((found_1[0] & 0x1ull) != 0x1ull) \
+	{ \
+		std::string missing_1; \
+		if((found_1[0] & 0x1ull) == 0) missing_1 += " value"; \
+		throw std::runtime_error("Missing required key(s) in JSON object for TestType:" + missing_1); \
+	} \
 } \
 
 
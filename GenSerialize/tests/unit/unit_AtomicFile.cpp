@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <AtomicFile.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+namespace fs = std::filesystem;
+
+class AtomicFileTests : public ::testing::Test
+{
+protected:
+    fs::path tempDir;
+
+    void SetUp() override
+    {
+        tempDir = fs::temp_directory_path() / "GenSerialize_AtomicFile";
+        fs::remove_all(tempDir);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(tempDir);
+    }
+
+    static std::string ReadFile(const fs::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+};
+
+TEST_F(AtomicFileTests, CreatesAndReplacesTheFile)
+{
+    fs::path path = tempDir / "nested" / "file.txt";
+
+    EXPECT_FALSE(WriteFileAtomically(path, "first"));
+    EXPECT_EQ(ReadFile(path), "first");
+
+    EXPECT_FALSE(WriteFileAtomically(path, std::string("second\0binary", 13)));
+    EXPECT_EQ(ReadFile(path), std::string("second\0binary", 13));
+
+    // No temporary file is left behind
+    EXPECT_EQ(std::distance(fs::directory_iterator(tempDir / "nested"), fs::directory_iterator()), 1);
+}
+
+TEST_F(AtomicFileTests, ReportsFailures)
+{
+    // The parent of the file is a regular file, the directory cannot be created
+    ASSERT_FALSE(WriteFileAtomically(tempDir / "blocker", "x"));
+    EXPECT_TRUE(WriteFileAtomically(tempDir / "blocker" / "file.txt", "contents"));
+}
+
+TEST_F(AtomicFileTests, ConcurrentWritersNeverTearTheFile)
+{
+    fs::path path = tempDir / "shared.txt";
+    std::vector<std::string> contents;
+    for (int i = 0; i < 8; i++)
+    {
+        contents.push_back(std::string(64 * 1024, static_cast<char>('a' + i)));
+    }
+
+    std::vector<std::thread> writers;
+    for (const auto& content : contents)
+    {
+        writers.emplace_back([&path, &content]() {
+            for (int round = 0; round < 10; round++)
+            {
+                EXPECT_FALSE(WriteFileAtomically(path, content));
+            }
+        });
+    }
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+
+    // The file is whole, written by exactly one of the writers
+    std::string result = ReadFile(path);
+    EXPECT_NE(std::find(contents.begin(), contents.end(), result), contents.end());
+    EXPECT_EQ(std::distance(fs::directory_iterator(tempDir), fs::directory_iterator()), 1);
+}
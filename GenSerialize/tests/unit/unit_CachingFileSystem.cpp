@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <CachingFileSystem.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <llvm/Support/MemoryBuffer.h>
+
+using namespace GenTools::GenSerialize;
+
+namespace
+{
+    // Counts the lookups that reach the file system under the cache
+    class CountingFileSystem : public llvm::vfs::ProxyFileSystem
+    {
+    public:
+        std::atomic<int> statusCount{ 0 };
+        std::atomic<int> openCount{ 0 };
+
+        explicit CountingFileSystem(llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fileSystem)
+            : llvm::vfs::ProxyFileSystem(std::move(fileSystem))
+        {}
+
+        llvm::ErrorOr<llvm::vfs::Status> status(const llvm::Twine& path) override
+        {
+            statusCount++;
+            return llvm::vfs::ProxyFileSystem::status(path);
+        }
+
+        llvm::ErrorOr<std::unique_ptr<llvm::vfs::File>> openFileForRead(const llvm::Twine& path) override
+        {
+            openCount++;
+            return llvm::vfs::ProxyFileSystem::openFileForRead(path);
+        }
+    };
+
+    std::string ReadAll(llvm::vfs::FileSystem& fileSystem, const std::string& path)
+    {
+        auto file = fileSystem.openFileForRead(path);
+        if (!file)
+            return {};
+        auto buffer = (*file)->getBuffer(path);
+        return buffer ? (*buffer)->getBuffer().str() : std::string();
+    }
+}
+
+class CachingFileSystemTests : public ::testing::Test
+{
+protected:
+    llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem> memoryFS;
+    llvm::IntrusiveRefCntPtr<CountingFileSystem> countingFS;
+    llvm::IntrusiveRefCntPtr<CachingFileSystem> cachingFS;
+
+    void SetUp() override
+    {
+        memoryFS = llvm::makeIntrusiveRefCnt<llvm::vfs::InMemoryFileSystem>();
+        memoryFS->addFile("/include/Type.h", 0, llvm::MemoryBuffer::getMemBuffer("struct Type {};"));
+        memoryFS->setCurrentWorkingDirectory("/include");
+
+        countingFS = llvm::makeIntrusiveRefCnt<CountingFileSystem>(memoryFS);
+        cachingFS = llvm::makeIntrusiveRefCnt<CachingFileSystem>(countingFS);
+    }
+};
+
+TEST_F(CachingFileSystemTests, RepeatedLookupsReachTheFileSystemOnce)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        auto status = cachingFS->status("/include/Type.h");
+        ASSERT_TRUE(status);
+        EXPECT_EQ(status->getName(), "/include/Type.h");
+        EXPECT_EQ(ReadAll(*cachingFS, "/include/Type.h"), "struct Type {};");
+    }
+
+    EXPECT_EQ(countingFS->statusCount, 1);
+    EXPECT_EQ(countingFS->openCount, 1);
+}
+
+TEST_F(CachingFileSystemTests, FilesNotFoundAreRemembered)
+{
+    EXPECT_FALSE(cachingFS->status("/include/Missing.h"));
+    EXPECT_FALSE(cachingFS->status("/include/Missing.h"));
+    EXPECT_EQ(countingFS->statusCount, 1);
+
+    // Added after the lookup, the cache assumes files do not change while it is in use
+    memoryFS->addFile("/include/Missing.h", 0, llvm::MemoryBuffer::getMemBuffer("struct Missing {};"));
+    EXPECT_FALSE(cachingFS->status("/include/Missing.h"));
+
+    cachingFS->Invalidate("/include/Missing.h");
+    EXPECT_TRUE(cachingFS->status("/include/Missing.h"));
+}
+
+TEST_F(CachingFileSystemTests, RelativePathsShareTheEntryOfTheAbsolutePath)
+{
+    EXPECT_EQ(ReadAll(*cachingFS, "/include/Type.h"), "struct Type {};");
+
+    auto status = cachingFS->status("Type.h");
+    ASSERT_TRUE(status);
+    EXPECT_EQ(status->getName(), "Type.h");
+    EXPECT_EQ(ReadAll(*cachingFS, "Type.h"), "struct Type {};");
+
+    EXPECT_EQ(countingFS->statusCount, 0);
+    EXPECT_EQ(countingFS->openCount, 1);
+}
+
+TEST_F(CachingFileSystemTests, ThreadsShareTheCachedContents)
+{
+    for (int i = 0; i < 32; i++)
+    {
+        memoryFS->addFile("/include/Header" + std::to_string(i) + ".h", 0, llvm::MemoryBuffer::getMemBufferCopy("// " + std::to_string(i)));
+    }
+
+    std::atomic<int> mismatches{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++)
+    {
+        threads.emplace_back([&]() {
+            for (int round = 0; round < 4; round++)
+            {
+                for (int i = 0; i < 32; i++)
+                {
+                    std::string path = "/include/Header" + std::to_string(i) + ".h";
+                    if (!cachingFS->status(path) || ReadAll(*cachingFS, path) != "// " + std::to_string(i))
+                        mismatches++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(mismatches, 0);
+    // Only threads racing on the first lookup of a file reach the file system
+    EXPECT_LE(countingFS->openCount, 32 * 8);
+    EXPECT_GE(countingFS->openCount, 32);
+}
+
+TEST_F(CachingFileSystemTests, WorkingDirectoryChangesNeverReachTheSharedFileSystem)
+{
+    EXPECT_EQ(cachingFS->setCurrentWorkingDirectory("/"), std::errc::operation_not_permitted);
+    EXPECT_EQ(cachingFS->getCurrentWorkingDirectory().get(), "/include");
+    EXPECT_EQ(memoryFS->getCurrentWorkingDirectory().get(), "/include");
+
+    // Moving the file system under the cache does not move the root relative paths resolve against
+    memoryFS->setCurrentWorkingDirectory("/");
+    auto status = cachingFS->status("Type.h");
+    ASSERT_TRUE(status);
+    EXPECT_EQ(status->getName(), "Type.h");
+    EXPECT_EQ(ReadAll(*cachingFS, "Type.h"), "struct Type {};");
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <CodeGenerator.h>
+#include <FileFormatRegistry.h>
+#include <IStreamingFormatPlugin.h>
+
+#include <sstream>
+#include <string>
+
+using namespace GenTools::GenSerialize;
+
+namespace
+{
+    class TestFormatPlugin : public IFormatPlugin
+    {
+    public:
+        std::string FORMAT_PLUGIN_CALL GenerateCode(const std::shared_ptr<SASTNode> sastNode) override
+        {
+            return "// " + sastNode->name + "\nvoid Serialize();\n";
+        }
+
+        std::string FORMAT_PLUGIN_CALL GetFormatName() const noexcept override
+        {
+            return "UnitTestFormat";
+        }
+
+        uint8_t FORMAT_PLUGIN_CALL GetPluginPriority() const noexcept override
+        {
+            return 0;
+        }
+    };
+
+    class TestFlatFormatPlugin : public TestFormatPlugin
+    {
+    public:
+        std::string FORMAT_PLUGIN_CALL GetFormatName() const noexcept override
+        {
+            return "UnitTestFlatFormat";
+        }
+
+        bool FORMAT_PLUGIN_CALL ConsumesFlatSAST() const noexcept override
+        {
+            return true;
+        }
+
+        std::string FORMAT_PLUGIN_CALL GenerateFlatCode(const FlatSAST::NodeView node) override
+        {
+            return "// flat " + std::string(node.GetName()) + " " + std::to_string(node.GetFields().size());
+        }
+    };
+
+    class TestStreamingFormatPlugin : public IStreamingFormatPlugin
+    {
+    public:
+        void FORMAT_PLUGIN_CALL EmitCode(const std::shared_ptr<SASTNode>& sastNode, CodeSink& sink) override
+        {
+            sink << "// streamed " << sastNode->name << "\n";
+            sink.Indent(1) << "size_t fieldCount = " << sastNode->fields.size() << ";";
+        }
+
+        std::string FORMAT_PLUGIN_CALL GetFormatName() const noexcept override
+        {
+            return "UnitTestStreamingFormat";
+        }
+
+        uint8_t FORMAT_PLUGIN_CALL GetPluginPriority() const noexcept override
+        {
+            return 0;
+        }
+    };
+
+    PluginRegistrar testRegistrar(std::make_shared<TestFormatPlugin>());
+    PluginRegistrar testFlatRegistrar(std::make_shared<TestFlatFormatPlugin>());
+    PluginRegistrar testStreamingRegistrar(std::make_shared<TestStreamingFormatPlugin>());
+
+    // What the generator produced before escaping was done in one pass
+    std::string EscapeLineByLine(const std::string& code)
+    {
+        std::ostringstream escapedStream;
+        std::istringstream rawStream(code);
+        std::string line;
+        while (std::getline(rawStream, line))
+        {
+            escapedStream << line << " \\\n";
+        }
+        return escapedStream.str();
+    }
+}
+
+TEST(CodeGeneratorTest, EscapesEveryLine)
+{
+    for (const std::string code : { "", "a", "a\n", "a\nb", "a\n\nb\n", "\n", "\n\n" })
+    {
+        EXPECT_EQ(CodeGenerator::EscapeMacroLines(code), EscapeLineByLine(code)) << "code: " << code;
+    }
+}
+
+TEST(CodeGeneratorTest, GeneratesEveryTypeAndFormatInParallel)
+{
+    std::vector<std::shared_ptr<SASTNode>> nodes;
+    for (int i = 0; i < 100; i++)
+    {
+        auto node = std::make_shared<SASTNode>();
+        node->name = "Type" + std::to_string(i);
+        node->formats = { "UnitTestFormat", "UnitTestFlatFormat" };
+        node->fields.resize(i % 3);
+        nodes.push_back(node);
+    }
+
+    CodeGenerator generator(nodes, 4);
+    GeneratedCode generated = generator.GenerateCode();
+
+    ASSERT_EQ(generated.code.size(), nodes.size());
+    for (int i = 0; i < 100; i++)
+    {
+        std::string name = "Type" + std::to_string(i);
+        const auto& formats = generated.code.at(name);
+        EXPECT_EQ(formats.at("UnitTestFormat"), "// " + name + " \\\nvoid Serialize(); \\\n");
+        EXPECT_EQ(formats.at("UnitTestFlatFormat"), "// flat " + name + " " + std::to_string(i % 3) + " \\\n");
+    }
+}
+
+TEST(CodeGeneratorTest, SinkWritesTextAndNumbers)
+{
+    CodeSink sink;
+    sink << "int a[" << size_t(16) << "] = {" << -3 << ", " << uint16_t(7) << "};" << '\n';
+    EXPECT_EQ(sink.View(), "int a[16] = {-3, 7};\n");
+    EXPECT_EQ(sink.Take(), "int a[16] = {-3, 7};\n");
+}
+
+TEST(CodeGeneratorTest, StreamingPluginsWriteIntoTheGeneratedCode)
+{
+    auto node = std::make_shared<SASTNode>();
+    node->name = "Streamed";
+    node->formats = { "UnitTestStreamingFormat" };
+    node->fields.resize(2);
+
+    std::vector<std::shared_ptr<SASTNode>> nodes = { node };
+    CodeGenerator generator(nodes);
+    GeneratedCode generated = generator.GenerateCode();
+    EXPECT_EQ(generated.code.at("Streamed").at("UnitTestStreamingFormat"), "// streamed Streamed \\\n\tsize_t fieldCount = 2; \\\n");
+
+    // Callers of the string interface get the same code without continuations
+    TestStreamingFormatPlugin plugin;
+    EXPECT_EQ(plugin.GenerateCode(node), "// streamed Streamed\n\tsize_t fieldCount = 2;");
+}
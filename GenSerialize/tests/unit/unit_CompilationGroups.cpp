@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <CompilationGroups.h>
+
+#include <string>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+
+TEST(CompilationGroupsTests, ArgumentsFromCommandKeepOnlyParseFlags)
+{
+    clang::tooling::CompileCommand command("/project/build", "../src/Type.cpp",
+        { "/usr/bin/clang++", "-DFEATURE=1", "-I../include", "-MD", "-MF", "Type.d", "-o", "Type.o", "-c", "../src/Type.cpp" },
+        "Type.o");
+
+    std::vector<std::string> expected = { "--driver-mode=g++", "-DFEATURE=1", "-I../include" };
+    EXPECT_EQ(CompilationGroups::ArgumentsFromCommand(command), expected);
+}
+
+TEST(CompilationGroupsTests, ArgumentsFromCommandKeepClDriverMode)
+{
+    clang::tooling::CompileCommand command("C:/project/build", "C:/project/src/Type.cpp",
+        { "C:/MSVC/bin/cl.exe", "/DFEATURE=1", "-c", "C:/project/src/Type.cpp" }, "");
+
+    std::vector<std::string> arguments = CompilationGroups::ArgumentsFromCommand(command);
+    ASSERT_FALSE(arguments.empty());
+    EXPECT_EQ(arguments.front(), "--driver-mode=cl");
+}
+
+TEST(CompilationGroupsTests, SourcesWithIdenticalFlagsShareAGroup)
+{
+    CompilationGroups groups;
+    size_t first = groups.Assign("A.h", "/project", { "-std=c++20", "-DA" });
+    size_t second = groups.Assign("B.h", "/project", { "-std=c++20", "-DA" });
+    size_t otherFlags = groups.Assign("C.h", "/project", { "-std=c++20", "-DC" });
+    size_t otherDirectory = groups.Assign("D.h", "/elsewhere", { "-std=c++20", "-DA" });
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, otherFlags);
+    EXPECT_NE(first, otherDirectory);
+    EXPECT_EQ(groups.Size(), 3u);
+
+    EXPECT_EQ(groups.GetSourceGroup("B.h"), first);
+    EXPECT_EQ(groups.GetGroup(first).flagsHash, groups.GetGroup(second).flagsHash);
+    EXPECT_NE(groups.GetGroup(first).flagsHash, groups.GetGroup(otherFlags).flagsHash);
+
+    auto commands = groups.GetGroup(otherFlags).compilations->getCompileCommands("C.h");
+    ASSERT_EQ(commands.size(), 1u);
+    EXPECT_EQ(commands.front().Directory, "/project");
+}
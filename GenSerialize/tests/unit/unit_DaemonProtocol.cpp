@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <DaemonProtocol.h>
+
+#if !defined(_WIN32)
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace GenTools::GenSerialize;
+namespace fs = std::filesystem;
+
+namespace
+{
+    class DaemonProtocolTest : public ::testing::Test
+    {
+    protected:
+        fs::path tempDir;
+        std::string socketPath;
+
+        void SetUp() override
+        {
+            tempDir = fs::temp_directory_path() / "GenSerialize_Daemon";
+            fs::remove_all(tempDir);
+            fs::create_directories(tempDir);
+
+            socketPath = (tempDir / "daemon.sock").string();
+        }
+
+        void TearDown() override
+        {
+            fs::remove_all(tempDir);
+        }
+
+        static std::string ReadAll(int fd)
+        {
+            std::string contents;
+            char buffer[256];
+            ssize_t count;
+            while ((count = read(fd, buffer, sizeof(buffer))) > 0)
+            {
+                contents.append(buffer, static_cast<size_t>(count));
+            }
+            return contents;
+        }
+    };
+}
+
+TEST_F(DaemonProtocolTest, RequestReachesTheServerWithTheClientOutput)
+{
+    DaemonServer server(socketPath);
+    ASSERT_TRUE(server.Listen());
+
+    std::vector<std::string> received;
+    std::string receivedDirectory;
+    std::thread serverThread([&]() {
+        auto request = server.Accept();
+        ASSERT_TRUE(request.has_value());
+        receivedDirectory = request->workingDirectory;
+        received = request->arguments;
+
+        std::string output = "generated\n";
+        ASSERT_EQ(write(request->outputFd, output.data(), output.size()), static_cast<ssize_t>(output.size()));
+        EXPECT_TRUE(request->Reply(3));
+        });
+
+    int outputPipe[2];
+    ASSERT_EQ(pipe(outputPipe), 0);
+
+    std::vector<std::string> arguments = { "--gen_threads=2", "Source.h", std::string(100000, 'x') };
+    auto exitCode = DaemonClient::Run(socketPath, "/work", arguments, outputPipe[1], STDERR_FILENO);
+    serverThread.join();
+    close(outputPipe[1]);
+
+    ASSERT_TRUE(exitCode.has_value());
+    EXPECT_EQ(*exitCode, 3);
+    EXPECT_EQ(receivedDirectory, "/work");
+    EXPECT_EQ(received, arguments);
+    EXPECT_EQ(ReadAll(outputPipe[0]), "generated\n");
+    close(outputPipe[0]);
+}
+
+TEST_F(DaemonProtocolTest, ClientReportsMissingDaemon)
+{
+    EXPECT_FALSE(DaemonClient::Run(socketPath, "/work", { "Source.h" }, STDOUT_FILENO, STDERR_FILENO).has_value());
+}
+
+TEST_F(DaemonProtocolTest, SecondDaemonCannotTakeALiveSocket)
+{
+    DaemonServer first(socketPath);
+    ASSERT_TRUE(first.Listen());
+
+    DaemonServer second(socketPath);
+    EXPECT_FALSE(second.Listen());
+}
+#endif
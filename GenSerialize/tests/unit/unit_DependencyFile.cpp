@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <DependencyFile.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+namespace fs = std::filesystem;
+
+TEST(DependencyFileTests, RulesListEveryInput)
+{
+    DependencyFile depfile;
+    depfile.AddRule("/src/generated/Type.generated.h", { "/src/Type.h", "/include/Included.h" });
+    depfile.AddRule("/src/generated/Empty.generated.h", {});
+
+    EXPECT_EQ(depfile.GetContents(),
+        "/src/generated/Type.generated.h: \\\n  /src/Type.h \\\n  /include/Included.h\n"
+        "/src/generated/Empty.generated.h:\n");
+}
+
+TEST(DependencyFileTests, SpecialCharactersAreEscaped)
+{
+    DependencyFile depfile;
+    depfile.AddRule("/out/A.generated.h", { "/my dir/A#1.h", "/cost$.h", "C:\\dir\\ x.h" });
+
+    EXPECT_EQ(depfile.GetContents(),
+        "/out/A.generated.h: \\\n  /my\\ dir/A\\#1.h \\\n  /cost$$.h \\\n  C:\\dir\\\\\\ x.h\n");
+}
+
+TEST(DependencyFileTests, WrittenFileMatchesTheContents)
+{
+    fs::path tempDir = fs::temp_directory_path() / "GenSerialize_DependencyFile";
+    fs::remove_all(tempDir);
+
+    DependencyFile depfile;
+    depfile.AddRule("/src/generated/Type.generated.h", { "/src/Type.h" });
+    ASSERT_TRUE(depfile.Write(tempDir / "deps" / "Type.d"));
+
+    std::ifstream file(tempDir / "deps" / "Type.d", std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_EQ(contents.str(), depfile.GetContents());
+    // No temporary file is left behind
+    EXPECT_EQ(std::distance(fs::directory_iterator(tempDir / "deps"), fs::directory_iterator()), 1);
+
+    fs::remove_all(tempDir);
+}
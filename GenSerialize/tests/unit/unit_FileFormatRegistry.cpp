@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <FileFormatRegistry.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+
+namespace
+{
+    class NamedFormatPlugin : public IFormatPlugin
+    {
+    private:
+        std::string m_formatName;
+        std::string m_code;
+
+    public:
+        NamedFormatPlugin(std::string formatName, std::string code)
+            : m_formatName(std::move(formatName)), m_code(std::move(code))
+        {}
+
+        std::string FORMAT_PLUGIN_CALL GenerateCode([[maybe_unused]] const std::shared_ptr<SASTNode> sastNode) override
+        {
+            return m_code;
+        }
+
+        std::string FORMAT_PLUGIN_CALL GetFormatName() const noexcept override
+        {
+            return m_formatName;
+        }
+
+        uint8_t FORMAT_PLUGIN_CALL GetPluginPriority() const noexcept override
+        {
+            return 0;
+        }
+    };
+
+    class FileFormatRegistryTest : public ::testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            FileFormatRegistry::GetInstance().SetPluginResolver(nullptr);
+        }
+    };
+}
+
+TEST_F(FileFormatRegistryTest, ResolverRegistersPluginsOnFirstLookup)
+{
+    auto& registry = FileFormatRegistry::GetInstance();
+    std::atomic<int> resolveCount = 0;
+    registry.SetPluginResolver([&](const std::string& formatName) {
+        resolveCount++;
+        if (formatName == "RegistryLazyFormat")
+            registry.RegisterPlugin(std::make_shared<NamedFormatPlugin>("RegistryLazyFormat", "lazy"));
+        });
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&]() {
+            for (int lookup = 0; lookup < 100; lookup++)
+            {
+                auto plugin = registry.GetPlugin("RegistryLazyFormat");
+                ASSERT_NE(plugin, nullptr);
+                EXPECT_EQ(plugin->GenerateCode(nullptr), "lazy");
+            }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Threads racing on the first lookup may each resolve, later lookups do not
+    EXPECT_GE(resolveCount.load(), 1);
+    EXPECT_LE(resolveCount.load(), 4);
+
+    EXPECT_EQ(registry.GetPlugin("RegistryUnknownFormat"), nullptr);
+    int countAfterMiss = resolveCount.load();
+    EXPECT_EQ(registry.GetPlugin("RegistryUnknownFormat"), nullptr);
+    EXPECT_EQ(resolveCount.load(), countAfterMiss);
+}
+
+TEST_F(FileFormatRegistryTest, ResolvedPluginsCanOverrideRegisteredOnes)
+{
+    auto& registry = FileFormatRegistry::GetInstance();
+    registry.RegisterPlugin(std::make_shared<NamedFormatPlugin>("RegistryOverriddenFormat", "static"), 0);
+
+    registry.SetPluginResolver([&](const std::string& formatName) {
+        registry.RegisterPlugin(std::make_shared<NamedFormatPlugin>(formatName, "dynamic"), 1);
+        });
+
+    auto plugin = registry.GetPlugin("RegistryOverriddenFormat");
+    ASSERT_NE(plugin, nullptr);
+    EXPECT_EQ(plugin->GenerateCode(nullptr), "dynamic");
+}
+
+TEST_F(FileFormatRegistryTest, FrozenRegistryPublishesLaterRegistrations)
+{
+    auto& registry = FileFormatRegistry::GetInstance();
+    registry.RegisterPlugin(std::make_shared<NamedFormatPlugin>("RegistryFrozenFormat", "first"), 0);
+    registry.Freeze();
+
+    FormatId formatId = registry.GetFormatId("RegistryFrozenFormat");
+    EXPECT_EQ(registry.GetFormatId("RegistryFrozenFormat"), formatId);
+    EXPECT_NE(registry.GetFormatId("RegistryOtherFrozenFormat"), formatId);
+
+    IFormatPlugin* first = registry.GetPlugin(formatId);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->GenerateCode(nullptr), "first");
+
+    // A replaced plugin stays usable by whoever looked it up before
+    registry.RegisterPlugin(std::make_shared<NamedFormatPlugin>("RegistryFrozenFormat", "second"), 1);
+    IFormatPlugin* second = registry.GetPlugin(formatId);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->GenerateCode(nullptr), "second");
+    EXPECT_EQ(first->GenerateCode(nullptr), "first");
+
+    EXPECT_EQ(registry.GetPlugin(INVALID_FORMAT_ID), nullptr);
+}
+
+TEST_F(FileFormatRegistryTest, SettingTheResolverAgainResolvesFormatsOnceMore)
+{
+    auto& registry = FileFormatRegistry::GetInstance();
+    registry.Freeze();
+
+    registry.SetPluginResolver([&](const std::string& formatName) {
+        if (formatName == "RegistryReloadedFormat")
+            registry.RegisterPlugin(std::make_shared<NamedFormatPlugin>(formatName, "old"), 0);
+        });
+    auto oldPlugin = registry.GetPlugin("RegistryReloadedFormat");
+    ASSERT_NE(oldPlugin, nullptr);
+    EXPECT_EQ(oldPlugin->GenerateCode(nullptr), "old");
+
+    // As when the daemon loads a new plugin for a format an earlier request already resolved
+    registry.SetPluginResolver([&](const std::string& formatName) {
+        if (formatName == "RegistryReloadedFormat")
+            registry.RegisterPlugin(std::make_shared<NamedFormatPlugin>(formatName, "new"), 0);
+        });
+    auto newPlugin = registry.GetPlugin("RegistryReloadedFormat");
+    ASSERT_NE(newPlugin, nullptr);
+    EXPECT_EQ(newPlugin->GenerateCode(nullptr), "new");
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <FileWatcher.h>
+
+#if defined(__linux__)
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+namespace fs = std::filesystem;
+
+namespace
+{
+    void WriteFile(const fs::path& path, const std::string& content)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    class FileWatcherTest : public ::testing::Test
+    {
+    protected:
+        fs::path tempDir;
+        std::string sourcePath;
+        std::string includePath;
+
+        void SetUp() override
+        {
+            tempDir = fs::temp_directory_path() / "GenSerialize_FileWatcher";
+            fs::remove_all(tempDir);
+            fs::create_directories(tempDir / "include");
+
+            sourcePath = (tempDir / "Type.h").string();
+            includePath = (tempDir / "include" / "Included.h").string();
+            WriteFile(sourcePath, "class Type {};");
+            WriteFile(includePath, "struct Included {};");
+        }
+
+        void TearDown() override
+        {
+            fs::remove_all(tempDir);
+        }
+    };
+}
+
+TEST_F(FileWatcherTest, WrittenFileIsReported)
+{
+    FileWatcher watcher;
+    ASSERT_TRUE(watcher.Watch({ sourcePath, includePath }));
+
+    WriteFile(includePath, "struct Included { int value; };");
+    EXPECT_EQ(watcher.WaitForChanges(5000), std::vector<std::string>{ includePath });
+}
+
+TEST_F(FileWatcherTest, FileReplacedByARenameIsReported)
+{
+    FileWatcher watcher;
+    ASSERT_TRUE(watcher.Watch({ sourcePath }));
+
+    WriteFile(tempDir / "Type.h.tmp", "class Type { int value; };");
+    fs::rename(tempDir / "Type.h.tmp", sourcePath);
+    EXPECT_EQ(watcher.WaitForChanges(5000), std::vector<std::string>{ sourcePath });
+}
+
+TEST_F(FileWatcherTest, UnwatchedFilesAreIgnored)
+{
+    FileWatcher watcher;
+    ASSERT_TRUE(watcher.Watch({ sourcePath }));
+
+    WriteFile(tempDir / "Type.generated.h", "#define GENERATED_SERIALIZATION_BODY()");
+    WriteFile(includePath, "struct Included { int value; };");
+    EXPECT_TRUE(watcher.WaitForChanges(100).empty());
+}
+#endif
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <FlatSAST.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+
+namespace
+{
+    std::shared_ptr<SASTNode> MakeNode(const std::string& name, const std::string& sourceFile)
+    {
+        auto node = std::make_shared<SASTNode>();
+        node->name = name;
+        node->sourceFile = sourceFile;
+        node->formats = { "JSON", "BinaryView" };
+        return node;
+    }
+
+    SASTField MakeField(const std::string& name, SASTType type)
+    {
+        SASTField field;
+        field.access = SASTField::Access::Public;
+        field.name = name;
+        field.formattedName = name;
+        field.type = type;
+        return field;
+    }
+}
+
+TEST(FlatSASTTest, ViewsMirrorTheGraph)
+{
+    auto base = MakeNode("ns::Base", "/src/Base.h");
+    base->fields = { MakeField("id", SASTType::Int) };
+    base->fields[0].arithmeticBits = 64;
+    base->fields[0].fieldId = 3;
+
+    auto node = MakeNode("ns::Type", "/src/Type.h");
+    node->serializationPolicy = SASTNode::SerializationPolicy::Private;
+    node->baseNodes = { base };
+
+    SASTField values = MakeField("values", SASTType::Map);
+    values.originalTypeName = "std::map<std::string, ns::Base>";
+    values.defaultValue = "{}";
+    values.keyType = std::make_shared<SASTField>(MakeField("", SASTType::String));
+    values.valueType = std::make_shared<SASTField>(MakeField("", SASTType::Object));
+    values.valueType->objectTypeName = "ns::Base";
+    values.valueType->objectNode = base;
+    node->fields = { MakeField("name", SASTType::String), values };
+
+    FlatSAST sast = FlatSAST::Build({ node });
+
+    ASSERT_EQ(sast.GetRoots().size(), 1u);
+    EXPECT_EQ(sast.GetNodes().size(), 2u);
+
+    FlatSAST::NodeView type = sast.GetRoots()[0];
+    EXPECT_EQ(type.GetName(), "ns::Type");
+    EXPECT_EQ(type.GetSourceFile(), "/src/Type.h");
+    EXPECT_EQ(type.GetSerializationPolicy(), SASTNode::SerializationPolicy::Private);
+    EXPECT_TRUE(type.HasFormat("BinaryView"));
+    EXPECT_FALSE(type.HasFormat("XML"));
+
+    std::vector<std::string_view> fieldNames;
+    for (auto field : type.GetFields())
+    {
+        fieldNames.push_back(field.GetName());
+    }
+    EXPECT_EQ(fieldNames, (std::vector<std::string_view>{ "name", "values" }));
+
+    FlatSAST::FieldView map = type.GetFields()[1];
+    EXPECT_EQ(map.GetType(), SASTType::Map);
+    EXPECT_EQ(map.GetDefaultValue(), "{}");
+    EXPECT_FALSE(map.GetElementType());
+    EXPECT_FALSE(map.GetFieldId());
+    ASSERT_TRUE(map.GetKeyType());
+    EXPECT_EQ(map.GetKeyType()->GetType(), SASTType::String);
+    ASSERT_TRUE(map.GetValueType());
+    EXPECT_EQ(map.GetValueType()->GetObjectTypeName(), "ns::Base");
+
+    // Links resolve to the same node as the base class list
+    ASSERT_EQ(type.GetBaseNodes().size(), 1u);
+    FlatSAST::NodeView baseView = type.GetBaseNodes()[0];
+    ASSERT_TRUE(map.GetValueType()->GetObjectNode());
+    EXPECT_EQ(*map.GetValueType()->GetObjectNode(), baseView);
+    EXPECT_EQ(baseView.GetFields()[0].GetArithmeticBits(), 64);
+    EXPECT_EQ(baseView.GetFields()[0].GetFieldId(), 3u);
+}
+
+TEST(FlatSASTTest, StringsAreInterned)
+{
+    std::vector<std::shared_ptr<SASTNode>> roots;
+    for (int i = 0; i < 8; i++)
+    {
+        auto node = MakeNode("Type" + std::to_string(i), "/src/Types.h");
+        node->fields = { MakeField("value", SASTType::Int) };
+        roots.push_back(node);
+    }
+
+    FlatSAST sast = FlatSAST::Build(roots);
+
+    // 8 type names, the shared source file, 2 formats, the field name and the empty string
+    EXPECT_EQ(sast.GetStringCount(), 13u);
+    EXPECT_EQ(sast.GetRoots()[7].GetName(), "Type7");
+    EXPECT_EQ(sast.GetRoots()[3].GetFields()[0].GetName().data(), sast.GetRoots()[5].GetFields()[0].GetName().data());
+}
+
+TEST(FlatSASTTest, RootsKeepTheirOrder)
+{
+    auto inner = MakeNode("Inner", "/src/Inner.h");
+    auto outer = MakeNode("Outer", "/src/Outer.h");
+    SASTField field = MakeField("inner", SASTType::Object);
+    field.objectNode = inner;
+    outer->fields = { field };
+
+    // Inner is reached through Outer first, the roots still come back as given
+    FlatSAST sast = FlatSAST::Build({ outer, inner });
+    auto roots = sast.GetRoots();
+    ASSERT_EQ(roots.size(), 2u);
+    EXPECT_EQ(roots[0].GetName(), "Outer");
+    EXPECT_EQ(roots[1].GetName(), "Inner");
+    EXPECT_EQ(*roots[0].GetFields()[0].GetObjectNode(), roots[1]);
+    EXPECT_TRUE(std::all_of(roots.begin(), roots.end(), [](FlatSAST::NodeView view) { return view.GetBaseNodes().empty(); }));
+}
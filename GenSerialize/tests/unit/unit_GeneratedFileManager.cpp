@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <GeneratedFileManager.h>
+#include <GenerationCache.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace GenTools::GenSerialize;
+namespace fs = std::filesystem;
+
+namespace
+{
+    std::string ReadFile(const fs::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return buffer.str();
+    }
+
+    class GeneratedFileManagerTest : public ::testing::Test
+    {
+    protected:
+        fs::path tempDir;
+        fs::path sourcePath;
+
+        void SetUp() override
+        {
+            tempDir = fs::temp_directory_path() / "GenSerialize_GeneratedFileManager";
+            fs::remove_all(tempDir);
+            fs::create_directories(tempDir);
+
+            sourcePath = tempDir / "Type.h";
+        }
+
+        void TearDown() override
+        {
+            fs::remove_all(tempDir);
+        }
+
+        static GeneratedCode MakeCode(const std::string& body)
+        {
+            GeneratedCode generatedCode;
+            generatedCode.code["Type"]["JSON"] = body;
+            return generatedCode;
+        }
+    };
+}
+
+TEST_F(GeneratedFileManagerTest, WritesHeaderAndReportsHash)
+{
+    GeneratedFileManager fileManager(sourcePath);
+    GeneratedCode generatedCode = MakeCode("int a;");
+
+    uint64_t contentHash = 0;
+    ASSERT_TRUE(fileManager.UpdateGeneratedFile(generatedCode, &contentHash));
+
+    auto genPath = fileManager.GetGeneratedHeaderPath();
+    ASSERT_TRUE(fs::exists(genPath));
+    EXPECT_EQ(ReadFile(genPath), fileManager.RenderGeneratedFile(generatedCode));
+    EXPECT_EQ(GenerationCache::HashFile(genPath), contentHash);
+}
+
+TEST_F(GeneratedFileManagerTest, UnchangedHeaderIsNotRewritten)
+{
+    GeneratedFileManager fileManager(sourcePath);
+    GeneratedCode generatedCode = MakeCode("int a;");
+    ASSERT_TRUE(fileManager.UpdateGeneratedFile(generatedCode));
+
+    auto genPath = fileManager.GetGeneratedHeaderPath();
+    auto pastTime = fs::last_write_time(genPath) - std::chrono::hours(1);
+    fs::last_write_time(genPath, pastTime);
+
+    ASSERT_TRUE(fileManager.UpdateGeneratedFile(generatedCode));
+    EXPECT_EQ(fs::last_write_time(genPath), pastTime);
+}
+
+TEST_F(GeneratedFileManagerTest, ChangedHeaderIsReplaced)
+{
+    GeneratedFileManager fileManager(sourcePath);
+    ASSERT_TRUE(fileManager.UpdateGeneratedFile(MakeCode("int a;")));
+
+    // Same size, different contents, so the hash comparison has to catch it
+    GeneratedCode changedCode = MakeCode("int b;");
+    ASSERT_TRUE(fileManager.UpdateGeneratedFile(changedCode));
+    EXPECT_EQ(ReadFile(fileManager.GetGeneratedHeaderPath()), fileManager.RenderGeneratedFile(changedCode));
+
+    // No temporary files are left behind next to the header
+    size_t fileCount = 0;
+    for (const auto& entry : fs::directory_iterator(fileManager.GetGeneratedHeaderPath().parent_path()))
+    {
+        (void)entry;
+        fileCount++;
+    }
+    EXPECT_EQ(fileCount, 1u);
+}
+
+TEST_F(GeneratedFileManagerTest, RenderingIsIndependentOfInsertionOrder)
+{
+    GeneratedFileManager fileManager(sourcePath);
+
+    GeneratedCode first;
+    first.code["Alpha"]["JSON"] = "int a;";
+    first.code["Beta"]["JSON"] = "int b;";
+    first.code["Beta"]["Binary"] = "int c;";
+
+    GeneratedCode second;
+    second.code["Beta"]["Binary"] = "int c;";
+    second.code["Beta"]["JSON"] = "int b;";
+    second.code["Alpha"]["JSON"] = "int a;";
+
+    EXPECT_EQ(fileManager.RenderGeneratedFile(first), fileManager.RenderGeneratedFile(second));
+}
+
+TEST_F(GeneratedFileManagerTest, StaleHeaderOfSourceWithoutTypesIsRemoved)
+{
+    GeneratedFileManager fileManager(sourcePath);
+    ASSERT_TRUE(fileManager.UpdateGeneratedFile(MakeCode("int a;")));
+    ASSERT_TRUE(fs::exists(fileManager.GetGeneratedHeaderPath()));
+
+    EXPECT_TRUE(fileManager.RemoveGeneratedFile());
+    EXPECT_FALSE(fs::exists(fileManager.GetGeneratedHeaderPath()));
+
+    // Nothing left to remove
+    EXPECT_TRUE(fileManager.RemoveGeneratedFile());
+}
+
+TEST_F(GeneratedFileManagerTest, HeaderOfSourceWithTheSameStemIsKept)
+{
+    GeneratedFileManager headerManager(sourcePath);
+    ASSERT_TRUE(headerManager.UpdateGeneratedFile(MakeCode("int a;")));
+
+    // Type.cpp maps to the same generated header as Type.h, which still owns it
+    GeneratedFileManager sourceManager(tempDir / "Type.cpp");
+    ASSERT_EQ(sourceManager.GetGeneratedHeaderPath(), headerManager.GetGeneratedHeaderPath());
+    EXPECT_TRUE(sourceManager.RemoveGeneratedFile());
+    EXPECT_TRUE(fs::exists(headerManager.GetGeneratedHeaderPath()));
+}
+
+TEST_F(GeneratedFileManagerTest, SourceWithoutTypesRendersAnEmptyHeader)
+{
+    GeneratedFileManager fileManager(sourcePath);
+    ASSERT_TRUE(fileManager.UpdateGeneratedFile(MakeCode("int a;")));
+    ASSERT_TRUE(fileManager.UpdateGeneratedFile(GeneratedCode{}));
+
+    std::string contents = ReadFile(fileManager.GetGeneratedHeaderPath());
+    EXPECT_EQ(contents.find("#define"), std::string::npos);
+    EXPECT_NE(contents.find("Type.h"), std::string::npos);
+}
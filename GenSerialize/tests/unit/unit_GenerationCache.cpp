@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <GenerationCache.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+namespace fs = std::filesystem;
+
+namespace
+{
+    void WriteFile(const fs::path& path, const std::string& content)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    class GenerationCacheTest : public ::testing::Test
+    {
+    protected:
+        fs::path tempDir;
+        fs::path cachePath;
+        fs::path sourcePath;
+        fs::path includePath;
+        fs::path generatedPath;
+
+        void SetUp() override
+        {
+            tempDir = fs::temp_directory_path() / "GenSerialize_GenerationCache";
+            fs::remove_all(tempDir);
+            fs::create_directories(tempDir);
+
+            cachePath = tempDir / "gen.cache";
+            sourcePath = tempDir / "Type.h";
+            includePath = tempDir / "Included.h";
+            generatedPath = tempDir / "Type.generated.h";
+
+            WriteFile(sourcePath, "class Type {};");
+            WriteFile(includePath, "struct Included {};");
+            WriteFile(generatedPath, "#define GENERATED_SERIALIZATION_BODY()");
+        }
+
+        void TearDown() override
+        {
+            fs::remove_all(tempDir);
+        }
+
+        GenerationCacheEntry MakeEntry() const
+        {
+            GenerationCacheEntry entry;
+            entry.sourceHash = *GenerationCache::HashFile(sourcePath);
+            entry.outputHash = *GenerationCache::HashFile(generatedPath);
+            entry.dependencies.emplace_back(GenerationCache::NormalizePath(includePath), *GenerationCache::HashFile(includePath));
+            return entry;
+        }
+    };
+}
+
+TEST_F(GenerationCacheTest, HashesMatchAcrossBlocks)
+{
+    EXPECT_EQ(GenerationCache::HashBytes("serialize"), GenerationCache::HashBytes("ize", GenerationCache::HashBytes("serial")));
+    EXPECT_NE(GenerationCache::HashBytes("serialize"), GenerationCache::HashBytes("serialise"));
+    EXPECT_EQ(*GenerationCache::HashFile(sourcePath), GenerationCache::HashBytes("class Type {};"));
+    EXPECT_FALSE(GenerationCache::HashFile(tempDir / "missing.h").has_value());
+}
+
+TEST_F(GenerationCacheTest, UnchangedInputsAreUpToDateAfterReload)
+{
+    std::string source = GenerationCache::NormalizePath(sourcePath);
+    {
+        GenerationCache cache(cachePath, 42);
+        EXPECT_FALSE(cache.Load());
+        cache.Update(source, MakeEntry());
+        ASSERT_TRUE(cache.Save());
+    }
+
+    GenerationCache cache(cachePath, 42);
+    ASSERT_TRUE(cache.Load());
+    EXPECT_TRUE(cache.IsUpToDate(source, *GenerationCache::HashFile(sourcePath), generatedPath));
+
+    // A changed source is stale
+    EXPECT_FALSE(cache.IsUpToDate(source, GenerationCache::HashBytes("class Type { int a; };"), generatedPath));
+}
+
+TEST_F(GenerationCacheTest, ChangedDependencyOrOutputIsStale)
+{
+    std::string source = GenerationCache::NormalizePath(sourcePath);
+    uint64_t sourceHash = *GenerationCache::HashFile(sourcePath);
+
+    GenerationCache cache(cachePath, 42);
+    cache.Update(source, MakeEntry());
+    ASSERT_TRUE(cache.IsUpToDate(source, sourceHash, generatedPath));
+
+    WriteFile(includePath, "struct Included { int b; };");
+    EXPECT_FALSE(cache.IsUpToDate(source, sourceHash, generatedPath));
+
+    cache.Update(source, MakeEntry());
+    fs::remove(generatedPath);
+    EXPECT_FALSE(cache.IsUpToDate(source, sourceHash, generatedPath));
+}
+
+TEST_F(GenerationCacheTest, DifferentConfigurationDropsEntries)
+{
+    std::string source = GenerationCache::NormalizePath(sourcePath);
+    {
+        GenerationCache cache(cachePath, 42);
+        cache.Update(source, MakeEntry());
+        ASSERT_TRUE(cache.Save());
+    }
+
+    GenerationCache cache(cachePath, 43);
+    EXPECT_FALSE(cache.Load());
+    EXPECT_FALSE(cache.IsUpToDate(source, *GenerationCache::HashFile(sourcePath), generatedPath));
+}
+
+TEST_F(GenerationCacheTest, CorruptCacheIsIgnored)
+{
+    WriteFile(cachePath, "GenSerializeCache 1\nconfig 2a\nsource /a.h\nhash zz 0\n");
+
+    GenerationCache cache(cachePath, 42);
+    EXPECT_FALSE(cache.Load());
+    EXPECT_FALSE(cache.IsUpToDate("/a.h", 0, generatedPath));
+}
+
+TEST_F(GenerationCacheTest, DependenciesOfAnEntryAreListed)
+{
+    std::string source = GenerationCache::NormalizePath(sourcePath);
+    GenerationCache cache(cachePath, 42);
+    EXPECT_TRUE(cache.GetDependencies(source).empty());
+
+    cache.Update(source, MakeEntry());
+    EXPECT_EQ(cache.GetDependencies(source), std::vector<std::string>{ GenerationCache::NormalizePath(includePath) });
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <RunStatistics.h>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+namespace fs = std::filesystem;
+
+namespace
+{
+    class RunStatisticsTest : public ::testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            RunStatistics::GetInstance().Stop();
+        }
+    };
+}
+
+TEST_F(RunStatisticsTest, NothingIsRecordedWhileDisabled)
+{
+    auto& statistics = RunStatistics::GetInstance();
+    statistics.Start();
+    statistics.Stop();
+
+    {
+        RunStatistics::Scope scope("Parse", "Type.h");
+    }
+    statistics.AddCount("Types", 3);
+
+    EXPECT_TRUE(statistics.GetSpans().empty());
+    EXPECT_EQ(statistics.GetCount("Types"), 0u);
+}
+
+TEST_F(RunStatisticsTest, PhasesOfEveryThreadAreRecorded)
+{
+    auto& statistics = RunStatistics::GetInstance();
+    statistics.Start();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 3; i++)
+    {
+        threads.emplace_back([i]() {
+            RunStatistics::Scope scope("Parse", "Source" + std::to_string(i) + ".h");
+            RunStatistics::GetInstance().AddCount("Types", 2);
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    RunStatistics::Scope link("Link");
+    link.End();
+    link.End();
+
+    auto spans = statistics.GetSpans();
+    ASSERT_EQ(spans.size(), 4u);
+
+    std::set<uint32_t> parseThreads;
+    for (const auto& span : spans)
+    {
+        EXPECT_GE(span.start, 0);
+        EXPECT_GE(span.wallTime, 0);
+        if (span.phase == "Parse")
+            parseThreads.insert(span.threadId);
+    }
+    EXPECT_EQ(parseThreads.size(), 3u);
+    EXPECT_EQ(spans.back().phase, "Link");
+    EXPECT_EQ(statistics.GetCount("Types"), 6u);
+
+    std::ostringstream summary;
+    statistics.PrintSummary(summary);
+    EXPECT_NE(summary.str().find("Parse"), std::string::npos);
+    EXPECT_NE(summary.str().find("Link"), std::string::npos);
+    EXPECT_NE(summary.str().find("Types"), std::string::npos);
+}
+
+TEST_F(RunStatisticsTest, TraceHoldsAnEventPerPhase)
+{
+    auto& statistics = RunStatistics::GetInstance();
+    statistics.Start();
+    {
+        RunStatistics::Scope scope("Write", "C:\\src\\\"Type\".h");
+    }
+    statistics.AddCount("Generated bytes", 128);
+
+    fs::path tracePath = fs::temp_directory_path() / "GenSerialize_RunStatistics" / "trace.json";
+    ASSERT_TRUE(statistics.WriteChromeTrace(tracePath));
+
+    std::ifstream file(tracePath, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::string trace = contents.str();
+
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(trace.find("\"name\":\"Write\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"detail\":\"C:\\\\src\\\\\\\"Type\\\".h\""), std::string::npos);
+    EXPECT_NE(trace.find("\"Generated bytes\":\"128\""), std::string::npos);
+
+    fs::remove_all(tracePath.parent_path());
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <SASTArchive.h>
+
+#include <stdexcept>
+#include <string>
+
+using namespace GenTools::GenSerialize;
+
+namespace
+{
+    std::shared_ptr<SASTNode> MakeNode(const std::string& name, const std::string& sourceFile)
+    {
+        auto node = std::make_shared<SASTNode>();
+        node->name = name;
+        node->sourceFile = sourceFile;
+        node->formats = { "JSON" };
+        return node;
+    }
+}
+
+TEST(SASTArchiveTest, RoundTripsNodesAndLinks)
+{
+    auto base = MakeNode("ns::Base", "/src/Base.h");
+    auto node = MakeNode("ns::Type", "/src/Type.h");
+    node->serializationPolicy = SASTNode::SerializationPolicy::Public;
+    node->baseNodes = { base };
+
+    SASTField values;
+    values.access = SASTField::Access::Protected;
+    values.name = "values";
+    values.formattedName = "vals";
+    values.type = SASTType::Unordered_Map;
+    values.originalTypeName = "std::unordered_map<int, ns::Base>";
+    values.fieldId = 7;
+    values.defaultValue = "{}";
+    values.keyType = std::make_shared<SASTField>();
+    values.keyType->type = SASTType::Int;
+    values.keyType->arithmeticBits = 32;
+    values.keyType->arithmeticSigned = true;
+    values.valueType = std::make_shared<SASTField>();
+    values.valueType->type = SASTType::Object;
+    values.valueType->objectTypeName = "ns::Base";
+    values.valueType->objectNode = base;
+    node->fields = { values };
+
+    auto roots = SASTArchive::Read(SASTArchive::Write({ node }));
+
+    ASSERT_EQ(roots.size(), 1u);
+    const auto& read = roots[0];
+    EXPECT_EQ(read->name, "ns::Type");
+    EXPECT_EQ(read->sourceFile, "/src/Type.h");
+    EXPECT_EQ(read->serializationPolicy, SASTNode::SerializationPolicy::Public);
+    EXPECT_EQ(read->formats, node->formats);
+
+    ASSERT_EQ(read->fields.size(), 1u);
+    const SASTField& field = read->fields[0];
+    EXPECT_EQ(field.access, SASTField::Access::Protected);
+    EXPECT_EQ(field.formattedName, "vals");
+    EXPECT_EQ(field.type, SASTType::Unordered_Map);
+    EXPECT_EQ(field.fieldId, 7u);
+    EXPECT_EQ(field.defaultValue, "{}");
+    ASSERT_TRUE(field.keyType);
+    EXPECT_EQ(field.keyType->arithmeticBits, 32);
+    EXPECT_TRUE(field.keyType->arithmeticSigned);
+    EXPECT_FALSE(field.keyType->fieldId);
+    EXPECT_FALSE(field.elementType);
+
+    // Linked nodes come along and stay shared between the links pointing at them
+    ASSERT_EQ(read->baseNodes.size(), 1u);
+    EXPECT_EQ(read->baseNodes[0]->name, "ns::Base");
+    ASSERT_TRUE(field.valueType);
+    EXPECT_EQ(field.valueType->objectTypeName, "ns::Base");
+    EXPECT_EQ(field.valueType->objectNode, read->baseNodes[0]);
+}
+
+TEST(SASTArchiveTest, RestoresSelfReferences)
+{
+    auto tree = MakeNode("Tree", "/src/Tree.h");
+    SASTField children;
+    children.access = SASTField::Access::Public;
+    children.name = "children";
+    children.type = SASTType::Vector;
+    children.elementType = std::make_shared<SASTField>();
+    children.elementType->type = SASTType::Object;
+    children.elementType->objectTypeName = "Tree";
+    children.elementType->objectNode = tree;
+    tree->fields = { children };
+
+    auto roots = SASTArchive::Read(SASTArchive::Write({ tree }));
+
+    ASSERT_EQ(roots.size(), 1u);
+    EXPECT_EQ(roots[0]->fields[0].elementType->objectNode, roots[0]);
+
+    // Break the cycle so the test does not leak
+    tree->fields.clear();
+    roots[0]->fields.clear();
+}
+
+TEST(SASTArchiveTest, StoresRepeatedStringsOnce)
+{
+    std::string longName(4096, 'x');
+    std::vector<std::shared_ptr<SASTNode>> roots;
+    for (int i = 0; i < 16; i++)
+    {
+        auto node = MakeNode("Type" + std::to_string(i), "/src/Types.h");
+        SASTField field;
+        field.access = SASTField::Access::Public;
+        field.name = longName;
+        field.formattedName = longName;
+        field.type = SASTType::String;
+        node->fields = { field };
+        roots.push_back(node);
+    }
+
+    std::string data = SASTArchive::Write(roots);
+    EXPECT_LT(data.size(), 2 * longName.size());
+    EXPECT_EQ(SASTArchive::Read(data).size(), roots.size());
+}
+
+TEST(SASTArchiveTest, RejectsTruncatedData)
+{
+    std::string data = SASTArchive::Write({ MakeNode("Type", "/src/Type.h") });
+
+    EXPECT_THROW(SASTArchive::Read(std::string_view(data).substr(0, data.size() / 2)), std::runtime_error);
+    EXPECT_THROW(SASTArchive::Read("not an archive"), std::runtime_error);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <SASTCache.h>
+#include <GenerationCache.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace GenTools::GenSerialize;
+namespace fs = std::filesystem;
+
+namespace
+{
+    class SASTCacheTest : public ::testing::Test
+    {
+    protected:
+        fs::path tempDir;
+        fs::path cacheDir;
+        std::string sourcePath;
+        std::string includePath;
+
+        void SetUp() override
+        {
+            tempDir = fs::temp_directory_path() / "GenSerialize_SASTCache";
+            fs::remove_all(tempDir);
+            fs::create_directories(tempDir);
+
+            cacheDir = tempDir / "sast";
+            sourcePath = (tempDir / "Type.h").string();
+            includePath = (tempDir / "Include.h").string();
+            WriteFile(includePath, "struct Include {};");
+        }
+
+        void TearDown() override
+        {
+            fs::remove_all(tempDir);
+        }
+
+        static void WriteFile(const std::string& path, const std::string& contents)
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << contents;
+        }
+
+        std::vector<std::pair<std::string, uint64_t>> Dependencies() const
+        {
+            return { { includePath, *GenerationCache::HashFile(includePath) } };
+        }
+
+        static std::vector<std::shared_ptr<SASTNode>> MakeTree()
+        {
+            auto node = std::make_shared<SASTNode>();
+            node->name = "Type";
+            node->formats = { "JSON" };
+            return { node };
+        }
+    };
+}
+
+TEST_F(SASTCacheTest, StoredTreeIsLoaded)
+{
+    SASTCache cache(cacheDir, 1);
+    ASSERT_TRUE(cache.Store(sourcePath, 42, Dependencies(), MakeTree()));
+
+    auto entry = cache.Load(sourcePath, 42);
+    ASSERT_TRUE(entry);
+    ASSERT_EQ(entry->SASTTree.size(), 1u);
+    EXPECT_EQ(entry->SASTTree[0]->name, "Type");
+    EXPECT_EQ(entry->dependencies, std::vector<std::string>{ includePath });
+}
+
+TEST_F(SASTCacheTest, ChangedInputsInvalidateTheEntry)
+{
+    SASTCache cache(cacheDir, 1);
+    ASSERT_TRUE(cache.Store(sourcePath, 42, Dependencies(), MakeTree()));
+
+    EXPECT_FALSE(cache.Load(sourcePath, 43));
+    EXPECT_FALSE(SASTCache(cacheDir, 2).Load(sourcePath, 42));
+    EXPECT_FALSE(cache.Load((tempDir / "Other.h").string(), 42));
+
+    WriteFile(includePath, "struct Include { int changed; };");
+    EXPECT_FALSE(cache.Load(sourcePath, 42));
+}
+
+TEST_F(SASTCacheTest, CorruptEntryIsIgnored)
+{
+    SASTCache cache(cacheDir, 1);
+    ASSERT_TRUE(cache.Store(sourcePath, 42, {}, MakeTree()));
+
+    auto entryPath = cache.GetEntryPath(sourcePath);
+    fs::resize_file(entryPath, fs::file_size(entryPath) - 4);
+    EXPECT_FALSE(cache.Load(sourcePath, 42));
+}
+
+TEST_F(SASTCacheTest, KeptEntriesAreServedWithoutTheFile)
+{
+    SASTCache cache(cacheDir, 1, true);
+    ASSERT_TRUE(cache.Store(sourcePath, 42, Dependencies(), MakeTree()));
+    fs::remove_all(cacheDir);
+
+    auto entry = cache.Load(sourcePath, 42);
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->SASTTree[0]->name, "Type");
+
+    // Kept entries are validated like stored ones
+    EXPECT_FALSE(cache.Load(sourcePath, 43));
+    WriteFile(includePath, "struct Include { int changed; };");
+    EXPECT_FALSE(cache.Load(sourcePath, 42));
+}
@@ -48,4 +48,26 @@ TEST(SASTGeneratorFactoryTests, MergesMultipleFiles)
     // Check that both ClassOne and ClassTwo are present.
     EXPECT_NE(globalSASTMap.find("ClassOne"), globalSASTMap.end());
     EXPECT_NE(globalSASTMap.find("ClassTwo"), globalSASTMap.end());
-}
\ No newline at end of file
+}
+
+TEST(SASTGeneratorFactoryTests, TakeResultsMovesTheResultsOut)
+{
+    const char* code = R"cpp(
+        class SERIALIZABLE(JSON) Taken {
+        public:
+        SERIALIZE_FIELD
+            int a;
+        };
+    )cpp";
+
+    SASTGeneratorActionFactory factory;
+    EXPECT_TRUE(runToolOnCode(factory.create(), code, "taken.cpp"));
+
+    std::vector<SASTResult> results = factory.TakeResults();
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_NE(results[0].SASTMap.find("Taken"), results[0].SASTMap.end());
+    EXPECT_FALSE(results[0].SASTTree.empty());
+
+    // The factory is left without results
+    EXPECT_TRUE(factory.GetResults().empty());
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <SASTLinker.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+
+namespace
+{
+    std::shared_ptr<SASTField> MakeObjectField(const std::string& typeName)
+    {
+        auto field = std::make_shared<SASTField>();
+        field->type = SASTType::Object;
+        field->originalTypeName = typeName;
+        field->objectTypeName = typeName;
+        return field;
+    }
+}
+
+TEST(SASTLinkerTests, LinksContainerElementKeyAndValueTypes)
+{
+    auto inner = std::make_shared<SASTNode>();
+    inner->name = "ns::Inner";
+    auto point = std::make_shared<SASTNode>();
+    point->name = "ns::Point";
+    point->serializationPolicy = SASTNode::SerializationPolicy::POD;
+
+    auto outer = std::make_shared<SASTNode>();
+    outer->name = "ns::Outer";
+
+    SASTField direct = *MakeObjectField("ns::Inner");
+    direct.name = "direct";
+
+    SASTField list;
+    list.name = "list";
+    list.type = SASTType::Vector;
+    list.elementType = MakeObjectField("ns::Inner");
+
+    SASTField lookup;
+    lookup.name = "lookup";
+    lookup.type = SASTType::Map;
+    lookup.keyType = std::make_shared<SASTField>();
+    lookup.keyType->type = SASTType::String;
+    lookup.valueType = MakeObjectField("ns::Point");
+
+    outer->fields = { direct, list, lookup };
+
+    std::vector<std::shared_ptr<SASTNode>> tree = { outer };
+    EXPECT_FALSE(SASTLinker::IsLinked(tree));
+
+    std::unordered_map<std::string, std::shared_ptr<SASTNode>> globalMap = { { inner->name, inner }, { point->name, point } };
+    SASTLinker linker(tree, globalMap);
+    linker.Link();
+
+    EXPECT_TRUE(SASTLinker::IsLinked(tree));
+    EXPECT_EQ(outer->fields[0].objectNode, inner);
+    EXPECT_EQ(outer->fields[1].elementType->objectNode, inner);
+    EXPECT_EQ(outer->fields[2].valueType->objectNode, point);
+    EXPECT_EQ(outer->fields[2].valueType->type, SASTType::POD);
+    EXPECT_EQ(linker.GetLinkedNodes().size(), 3u);
+}
+
+TEST(SASTLinkerTests, RelinkReplacesExistingLinks)
+{
+    auto stale = std::make_shared<SASTNode>();
+    stale->name = "Inner";
+    auto fresh = std::make_shared<SASTNode>();
+    fresh->name = "Inner";
+
+    auto outer = std::make_shared<SASTNode>();
+    SASTField field = *MakeObjectField("Inner");
+    field.objectNode = stale;
+    outer->fields = { field };
+
+    std::vector<std::shared_ptr<SASTNode>> tree = { outer };
+    std::unordered_map<std::string, std::shared_ptr<SASTNode>> globalMap = { { "Inner", fresh } };
+
+    SASTLinker linker(tree, globalMap);
+    linker.Link();
+    EXPECT_EQ(outer->fields[0].objectNode, stale);
+
+    linker.Link(true);
+    EXPECT_EQ(outer->fields[0].objectNode, fresh);
+}
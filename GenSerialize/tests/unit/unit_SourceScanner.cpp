@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <SourceScanner.h>
+
+#include <string>
+
+using namespace GenTools::GenSerialize;
+
+TEST(SourceScannerTests, DetectsSerializationMacros)
+{
+    EXPECT_TRUE(SourceScanner::ContainsSerializationMarkers("class SERIALIZABLE(JSON) Type {};"));
+    EXPECT_TRUE(SourceScanner::ContainsSerializationMarkers("class SERIALIZABLE_POD Point { int x; };"));
+    EXPECT_TRUE(SourceScanner::ContainsSerializationMarkers("struct MY_SERIALIZABLE_TYPE Wrapped {};"));
+}
+
+TEST(SourceScannerTests, DetectsRawAnnotation)
+{
+    EXPECT_TRUE(SourceScanner::ContainsSerializationMarkers(R"(class __attribute__((annotate("serializable:all"))) Type {};)"));
+}
+
+TEST(SourceScannerTests, IgnoresSourcesWithoutMarkers)
+{
+    EXPECT_FALSE(SourceScanner::ContainsSerializationMarkers(""));
+    EXPECT_FALSE(SourceScanner::ContainsSerializationMarkers("#include <vector>\nclass Plain { std::vector<int> values; };\n"));
+    EXPECT_FALSE(SourceScanner::ContainsSerializationMarkers("bool serializable = true; // Serializable"));
+    EXPECT_FALSE(SourceScanner::ContainsSerializationMarkers("SERIALIZABL"));
+}
+
+TEST(SourceScannerTests, FindsMarkerAtEndOfLargeSource)
+{
+    std::string source(1 << 20, 'x');
+    EXPECT_FALSE(SourceScanner::ContainsSerializationMarkers(source));
+
+    source += "SERIALIZABLE";
+    EXPECT_TRUE(SourceScanner::ContainsSerializationMarkers(source));
+}
+
+TEST(SourceScannerTests, DetectsGeneratedHeaderInclude)
+{
+    EXPECT_TRUE(SourceScanner::IncludesGeneratedHeader("#include \"Type.generated.h\"\n", "Type"));
+    EXPECT_TRUE(SourceScanner::IncludesGeneratedHeader("#include <dir/sub/Type.generated.h>", "Type"));
+    EXPECT_TRUE(SourceScanner::IncludesGeneratedHeader("#include<Type.generated.h>", "Type"));
+    EXPECT_TRUE(SourceScanner::IncludesGeneratedHeader("#include \"Other.generated.h\"\n#include \"Type.generated.h\"", "Type"));
+
+    EXPECT_FALSE(SourceScanner::IncludesGeneratedHeader("#include \"Other.generated.h\"", "Type"));
+    EXPECT_FALSE(SourceScanner::IncludesGeneratedHeader("#include \"Type.h\"", "Type"));
+    EXPECT_FALSE(SourceScanner::IncludesGeneratedHeader("#include \"dir-name/Type.generated.h\"", "Type"));
+    EXPECT_FALSE(SourceScanner::IncludesGeneratedHeader("#include \"Type.generated.hpp\"", "Type"));
+    EXPECT_FALSE(SourceScanner::IncludesGeneratedHeader("#include \"Type.generated.h", "Type"));
+}
+
+TEST(SourceScannerTests, DetectsGeneratedBody)
+{
+    EXPECT_TRUE(SourceScanner::ContainsGeneratedBody("class Type { GENERATED_SERIALIZATION_BODY() };"));
+    EXPECT_TRUE(SourceScanner::ContainsGeneratedBody("GENERATED_SERIALIZATION_BODY ( \n )"));
+
+    EXPECT_FALSE(SourceScanner::ContainsGeneratedBody("GENERATED_SERIALIZATION_BODY"));
+    EXPECT_FALSE(SourceScanner::ContainsGeneratedBody("GENERATED_SERIALIZATION_BODY(x)"));
+    EXPECT_FALSE(SourceScanner::ContainsGeneratedBody("GENERATED_SERIALIZATION_BODY("));
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <FileWorkList.h>
+#include <WorkQueue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GenTools::GenSerialize;
+namespace fs = std::filesystem;
+
+namespace
+{
+    class FileWorkListTest : public ::testing::Test
+    {
+    protected:
+        fs::path tempDir;
+
+        void SetUp() override
+        {
+            tempDir = fs::temp_directory_path() / "GenSerialize_FileWorkList";
+            fs::remove_all(tempDir);
+            fs::create_directories(tempDir);
+        }
+
+        void TearDown() override
+        {
+            fs::remove_all(tempDir);
+        }
+
+        std::string MakeFile(const std::string& name, size_t size)
+        {
+            fs::path path = tempDir / name;
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << std::string(size, 'x');
+            return path.string();
+        }
+    };
+}
+
+TEST_F(FileWorkListTest, HandsOutLargestFilesFirst)
+{
+    std::string small = MakeFile("Small.h", 10);
+    std::string large = MakeFile("Large.h", 1000);
+    std::string medium = MakeFile("Medium.h", 100);
+    std::string missing = (tempDir / "Missing.h").string();
+
+    FileWorkList workList({ small, missing, large, medium });
+    ASSERT_EQ(workList.Size(), 4u);
+
+    EXPECT_EQ(workList.Next(), large);
+    EXPECT_EQ(workList.Next(), medium);
+    EXPECT_EQ(workList.Next(), small);
+    EXPECT_EQ(workList.Next(), missing);
+    EXPECT_FALSE(workList.Next().has_value());
+    EXPECT_FALSE(workList.Next().has_value());
+}
+
+TEST_F(FileWorkListTest, EachFileIsClaimedOnceAcrossThreads)
+{
+    std::vector<std::string> files;
+    for (size_t i = 0; i < 200; i++)
+    {
+        files.push_back(MakeFile("File" + std::to_string(i) + ".h", i));
+    }
+
+    FileWorkList workList(files);
+    std::vector<std::vector<std::string>> claimed(8);
+    std::vector<std::thread> workers;
+    for (auto& claimedByWorker : claimed)
+    {
+        workers.emplace_back([&workList, &claimedByWorker]() {
+            while (auto file = workList.Next())
+            {
+                claimedByWorker.push_back(*file);
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::vector<std::string> allClaimed;
+    for (const auto& claimedByWorker : claimed)
+    {
+        allClaimed.insert(allClaimed.end(), claimedByWorker.begin(), claimedByWorker.end());
+    }
+    std::sort(allClaimed.begin(), allClaimed.end());
+    std::sort(files.begin(), files.end());
+    EXPECT_EQ(allClaimed, files);
+}
+
+TEST(WorkQueueTests, PopReturnsItemsInOrderThenEmptyOnceClosed)
+{
+    WorkQueue<int> queue;
+    EXPECT_TRUE(queue.Push(1));
+    EXPECT_TRUE(queue.Push(2));
+    queue.Close();
+    EXPECT_FALSE(queue.Push(3));
+
+    EXPECT_EQ(queue.Pop(), 1);
+    EXPECT_EQ(queue.Pop(), 2);
+    EXPECT_FALSE(queue.Pop().has_value());
+}
+
+TEST(WorkQueueTests, ConsumersReceiveEveryItemFromConcurrentProducers)
+{
+    WorkQueue<int> queue;
+    std::atomic<long long> sum{ 0 };
+    std::atomic<int> count{ 0 };
+
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < 4; i++)
+    {
+        consumers.emplace_back([&]() {
+            while (auto item = queue.Pop())
+            {
+                sum += *item;
+                count++;
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; p++)
+    {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 1; i <= 1000; i++)
+            {
+                queue.Push(p * 1000 + i);
+            }
+        });
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    queue.Close();
+
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    EXPECT_EQ(count, 4000);
+    EXPECT_EQ(sum, 4000LL * 4001 / 2);
+}
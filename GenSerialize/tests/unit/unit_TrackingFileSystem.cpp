@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+#include <TrackingFileSystem.h>
+
+#include <llvm/Support/MemoryBuffer.h>
+
+using namespace GenTools::GenSerialize;
+
+TEST(TrackingFileSystemTests, UnchangedFilesKeepTheRecordValid)
+{
+    auto memoryFS = llvm::makeIntrusiveRefCnt<llvm::vfs::InMemoryFileSystem>();
+    memoryFS->addFile("/include/Type.h", 0, llvm::MemoryBuffer::getMemBuffer("struct Type {};"));
+
+    auto trackingFS = llvm::makeIntrusiveRefCnt<TrackingFileSystem>(memoryFS);
+    EXPECT_TRUE(trackingFS->status("/include/Type.h"));
+    EXPECT_TRUE(trackingFS->openFileForRead("/include/Type.h"));
+    EXPECT_FALSE(trackingFS->exists("/include/Missing.h"));
+
+    EXPECT_EQ(trackingFS->GetObservationCount(), 2u);
+    EXPECT_TRUE(trackingFS->IsUnchanged());
+}
+
+TEST(TrackingFileSystemTests, FileCreatedAfterAFailedLookupInvalidatesTheRecord)
+{
+    auto memoryFS = llvm::makeIntrusiveRefCnt<llvm::vfs::InMemoryFileSystem>();
+    auto trackingFS = llvm::makeIntrusiveRefCnt<TrackingFileSystem>(memoryFS);
+
+    EXPECT_FALSE(trackingFS->status("/include/Late.h"));
+    EXPECT_TRUE(trackingFS->IsUnchanged());
+
+    memoryFS->addFile("/include/Late.h", 0, llvm::MemoryBuffer::getMemBuffer("struct Late {};"));
+    EXPECT_FALSE(trackingFS->IsUnchanged());
+}
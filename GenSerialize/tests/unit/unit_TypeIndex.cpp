@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <TypeIndex.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace GenTools::GenSerialize;
+namespace fs = std::filesystem;
+
+namespace
+{
+    class TypeIndexTest : public ::testing::Test
+    {
+    protected:
+        fs::path tempDir;
+        fs::path indexPath;
+
+        void SetUp() override
+        {
+            tempDir = fs::temp_directory_path() / "GenSerialize_TypeIndex";
+            fs::remove_all(tempDir);
+            fs::create_directories(tempDir);
+
+            indexPath = tempDir / "types.index";
+        }
+
+        void TearDown() override
+        {
+            fs::remove_all(tempDir);
+        }
+
+        static std::shared_ptr<SASTNode> MakeNode(const std::string& name, const std::string& sourceFile)
+        {
+            auto node = std::make_shared<SASTNode>();
+            node->name = name;
+            node->sourceFile = sourceFile;
+            node->formats = { "JSON" };
+            return node;
+        }
+    };
+}
+
+TEST_F(TypeIndexTest, SavedNodesAreLoadedAndLinked)
+{
+    auto inner = MakeNode("Inner", "/src/Inner.h");
+    auto outer = MakeNode("Outer", "/src/Outer.h");
+    SASTField items;
+    items.access = SASTField::Access::Public;
+    items.name = "items";
+    items.type = SASTType::Vector;
+    items.elementType = std::make_shared<SASTField>();
+    items.elementType->type = SASTType::Object;
+    items.elementType->objectTypeName = "Inner";
+    items.elementType->objectNode = inner;
+    outer->fields = { items };
+
+    {
+        TypeIndex index(indexPath);
+        index.Update({ { "Inner", inner }, { "Outer", outer } }, { "/src/Inner.h", "/src/Outer.h" });
+        ASSERT_TRUE(index.Save());
+    }
+
+    TypeIndex index(indexPath);
+    ASSERT_TRUE(index.Load());
+    const auto& nodes = index.GetNodes();
+    ASSERT_EQ(nodes.size(), 2u);
+    EXPECT_EQ(nodes.at("Outer")->fields[0].elementType->objectNode, nodes.at("Inner"));
+}
+
+TEST_F(TypeIndexTest, UpdateDropsTypesRemovedFromParsedFiles)
+{
+    TypeIndex index(indexPath);
+    index.Update({ { "Kept", MakeNode("Kept", "/src/A.h") }, { "Removed", MakeNode("Removed", "/src/B.h") },
+        { "Untouched", MakeNode("Untouched", "/src/C.h") } }, { "/src/A.h", "/src/B.h", "/src/C.h" });
+
+    // B.h was parsed again and no longer defines Removed, C.h was not parsed
+    index.Update({ { "Kept", MakeNode("Kept", "/src/A.h") } }, { "/src/A.h", "/src/B.h" });
+
+    const auto& nodes = index.GetNodes();
+    EXPECT_TRUE(nodes.contains("Kept"));
+    EXPECT_FALSE(nodes.contains("Removed"));
+    EXPECT_TRUE(nodes.contains("Untouched"));
+}
+
+TEST_F(TypeIndexTest, TypesOfFilesThatLoseTheirMarkersAreDropped)
+{
+    TypeIndex index(indexPath);
+    index.Update({ { "A", MakeNode("A", "/src/A.h") }, { "B", MakeNode("B", "/src/B.h") } }, { "/src/A.h", "/src/B.h" });
+
+    // A.h lost its markers so it is skipped instead of parsed, B.h is parsed again because it includes A.h
+    index.Update({ { "B", MakeNode("B", "/src/B.h") } }, { "/src/B.h", "/src/A.h" });
+
+    const auto& nodes = index.GetNodes();
+    EXPECT_FALSE(nodes.contains("A"));
+    EXPECT_TRUE(nodes.contains("B"));
+}
+
+TEST_F(TypeIndexTest, TypesOfMissingFilesArePruned)
+{
+    fs::path keptFile = tempDir / "Kept.h";
+    std::ofstream(keptFile) << "struct Kept {};";
+    std::string removedFile = (tempDir / "Removed.h").string();
+
+    {
+        TypeIndex index(indexPath);
+        index.Update({ { "Kept", MakeNode("Kept", keptFile.string()) }, { "Removed", MakeNode("Removed", removedFile) } },
+            { keptFile.string(), removedFile });
+        index.PruneMissingFiles();
+        ASSERT_TRUE(index.Save());
+    }
+
+    TypeIndex index(indexPath);
+    ASSERT_TRUE(index.Load());
+    const auto& nodes = index.GetNodes();
+    EXPECT_TRUE(nodes.contains("Kept"));
+    EXPECT_FALSE(nodes.contains("Removed"));
+}
+
+TEST_F(TypeIndexTest, CorruptIndexIsIgnored)
+{
+    {
+        std::ofstream file(indexPath, std::ios::binary);
+        file << "not an index";
+    }
+
+    TypeIndex index(indexPath);
+    EXPECT_FALSE(index.Load());
+    EXPECT_TRUE(index.GetNodes().empty());
+}
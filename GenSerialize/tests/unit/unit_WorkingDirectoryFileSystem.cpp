@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <WorkingDirectoryFileSystem.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <llvm/Support/MemoryBuffer.h>
+
+using namespace GenTools::GenSerialize;
+
+class WorkingDirectoryFileSystemTests : public ::testing::Test
+{
+protected:
+    llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem> memoryFS;
+
+    void SetUp() override
+    {
+        memoryFS = llvm::makeIntrusiveRefCnt<llvm::vfs::InMemoryFileSystem>();
+        memoryFS->addFile("/first/Type.h", 0, llvm::MemoryBuffer::getMemBuffer("struct First {};"));
+        memoryFS->addFile("/second/Type.h", 0, llvm::MemoryBuffer::getMemBuffer("struct Second {};"));
+        memoryFS->setCurrentWorkingDirectory("/");
+    }
+
+    static std::string ReadAll(llvm::vfs::FileSystem& fileSystem, const std::string& path)
+    {
+        auto file = fileSystem.openFileForRead(path);
+        if (!file)
+            return {};
+        auto buffer = (*file)->getBuffer(path);
+        return buffer ? (*buffer)->getBuffer().str() : std::string();
+    }
+};
+
+TEST_F(WorkingDirectoryFileSystemTests, RelativePathsResolveAgainstItsOwnWorkingDirectory)
+{
+    auto first = llvm::makeIntrusiveRefCnt<WorkingDirectoryFileSystem>(memoryFS, "/first");
+    auto second = llvm::makeIntrusiveRefCnt<WorkingDirectoryFileSystem>(memoryFS, "/first");
+    ASSERT_FALSE(second->setCurrentWorkingDirectory("/second"));
+
+    EXPECT_EQ(ReadAll(*first, "Type.h"), "struct First {};");
+    EXPECT_EQ(ReadAll(*second, "Type.h"), "struct Second {};");
+    EXPECT_EQ(ReadAll(*second, "../first/Type.h"), "struct First {};");
+
+    auto status = second->status("Type.h");
+    ASSERT_TRUE(status);
+    EXPECT_EQ(status->getName(), "Type.h");
+
+    // The shared file system keeps its own working directory
+    EXPECT_EQ(first->getCurrentWorkingDirectory().get(), "/first");
+    EXPECT_EQ(second->getCurrentWorkingDirectory().get(), "/second");
+    EXPECT_EQ(memoryFS->getCurrentWorkingDirectory().get(), "/");
+}
+
+TEST_F(WorkingDirectoryFileSystemTests, OnlyExistingDirectoriesBecomeTheWorkingDirectory)
+{
+    auto fileSystem = llvm::makeIntrusiveRefCnt<WorkingDirectoryFileSystem>(memoryFS, "/first");
+
+    EXPECT_TRUE(fileSystem->setCurrentWorkingDirectory("/missing"));
+    EXPECT_TRUE(fileSystem->setCurrentWorkingDirectory("Type.h"));
+    EXPECT_EQ(fileSystem->getCurrentWorkingDirectory().get(), "/first");
+
+    EXPECT_FALSE(fileSystem->setCurrentWorkingDirectory("../second"));
+    EXPECT_EQ(fileSystem->getCurrentWorkingDirectory().get(), "/second");
+}
+
+TEST_F(WorkingDirectoryFileSystemTests, ThreadsMoveBetweenDirectoriesIndependently)
+{
+    std::vector<int> mismatches(8, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto fileSystem = llvm::makeIntrusiveRefCnt<WorkingDirectoryFileSystem>(memoryFS, "/");
+            for (int round = 0; round < 64; round++)
+            {
+                bool first = (round + t) % 2 == 0;
+                fileSystem->setCurrentWorkingDirectory(first ? "/first" : "/second");
+                if (ReadAll(*fileSystem, "Type.h") != (first ? "struct First {};" : "struct Second {};"))
+                    mismatches[t]++;
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int count : mismatches)
+    {
+        EXPECT_EQ(count, 0);
+    }
+}